@@ -50,6 +50,7 @@
 #include <boost/gil/utilities.hpp>
 #include <boost/gil/virtual_locator.hpp>
 #include <boost/gil/image_processing/adaptive_histogram_equalization.hpp>
+#include <boost/gil/image_processing/binary_morphology.hpp>
 #include <boost/gil/image_processing/diffusion.hpp>
 #include <boost/gil/image_processing/filter.hpp>
 #include <boost/gil/image_processing/harris.hpp>
@@ -60,7 +61,10 @@
 #include <boost/gil/image_processing/hough_transform.hpp>
 #include <boost/gil/image_processing/morphology.hpp>
 #include <boost/gil/image_processing/numeric.hpp>
+#include <boost/gil/image_processing/pyramid.hpp>
 #include <boost/gil/image_processing/scaling.hpp>
+#include <boost/gil/image_processing/stencil.hpp>
+#include <boost/gil/image_processing/summed_area_table.hpp>
 #include <boost/gil/image_processing/threshold.hpp>
 
 #endif
@@ -11,6 +11,7 @@
 #include <boost/gil/bit_aligned_pixel_iterator.hpp>
 #include <boost/gil/color_base_algorithm.hpp>
 #include <boost/gil/concepts.hpp>
+#include <boost/gil/execution.hpp>
 #include <boost/gil/image_view.hpp>
 #include <boost/gil/image_view_factory.hpp>
 #include <boost/gil/detail/mp11.hpp>
@@ -120,6 +121,18 @@ private:
     }
 };
 
+namespace detail {
+
+/// \brief Returns view of rows [y_begin, y_end) of given view
+template <typename View>
+BOOST_FORCEINLINE
+auto row_band(View const& view, std::ptrdiff_t y_begin, std::ptrdiff_t y_end) -> View
+{
+    return View(view.width(), y_end - y_begin, view.xy_at(0, y_begin));
+}
+
+} // namespace detail
+
 }}  // namespace boost::gil
 
 //////////////////////////////////////////////////////////////////////////////////////
@@ -285,6 +298,20 @@ void copy_pixels(const View1& src, const View2& dst)
     detail::copy_with_2d_iterators(src.begin(),src.end(),dst.begin());
 }
 
+/// \ingroup ImageViewSTLAlgorithmsCopyPixels
+/// \brief std::copy for image views, bands of rows copied in parallel according to the execution policy
+template <typename Tag, typename View1, typename View2>
+void copy_pixels(execution::execution_policy<Tag> const& policy, View1 const& src, View2 const& dst)
+{
+    BOOST_ASSERT(src.dimensions() == dst.dimensions());
+    detail::for_each_row_band(policy, src.width(), src.height(),
+        [&src, &dst](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+            copy_pixels(
+                detail::row_band(src, y_begin, y_end),
+                detail::row_band(dst, y_begin, y_end));
+        });
+}
+
 //////////////////////////////////////////////////////////////////////////////////////
 // copy_and_convert_pixels
 //////////////////////////////////////////////////////////////////////////////////////
@@ -336,6 +363,39 @@ void copy_and_convert_pixels(const View1& src, const View2& dst) {
     detail::copy_and_convert_pixels_fn<default_color_converter> ccp;
     ccp(src,dst);
 }
+
+/// \ingroup ImageViewSTLAlgorithmsCopyAndConvertPixels
+/// \brief copy_and_convert_pixels with bands of rows processed in parallel according to the execution policy
+template <typename Tag, typename View1, typename View2, typename CC>
+void copy_and_convert_pixels(
+    execution::execution_policy<Tag> const& policy,
+    View1 const& src,
+    View2 const& dst,
+    CC cc)
+{
+    BOOST_ASSERT(src.dimensions() == dst.dimensions());
+    detail::for_each_row_band(policy, src.width(), src.height(),
+        [&src, &dst, &cc](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+            detail::copy_and_convert_pixels_fn<CC> ccp(cc);
+            ccp(detail::row_band(src, y_begin, y_end), detail::row_band(dst, y_begin, y_end));
+        });
+}
+
+/// \ingroup ImageViewSTLAlgorithmsCopyAndConvertPixels
+/// \brief copy_and_convert_pixels with bands of rows processed in parallel according to the execution policy
+template <typename Tag, typename View1, typename View2>
+void copy_and_convert_pixels(
+    execution::execution_policy<Tag> const& policy,
+    View1 const& src,
+    View2 const& dst)
+{
+    BOOST_ASSERT(src.dimensions() == dst.dimensions());
+    detail::for_each_row_band(policy, src.width(), src.height(),
+        [&src, &dst](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+            detail::copy_and_convert_pixels_fn<default_color_converter> ccp;
+            ccp(detail::row_band(src, y_begin, y_end), detail::row_band(dst, y_begin, y_end));
+        });
+}
 } }  // namespace boost::gil
 
 //////////////////////////////////////////////////////////////////////////////////////
@@ -422,6 +482,17 @@ void fill_pixels(View const& view, Value const& value)
     }
 }
 
+/// \ingroup ImageViewSTLAlgorithmsFillPixels
+/// \brief std::fill for image views, bands of rows filled in parallel according to the execution policy
+template <typename Tag, typename View, typename Value>
+void fill_pixels(execution::execution_policy<Tag> const& policy, View const& view, Value const& value)
+{
+    detail::for_each_row_band(policy, view.width(), view.height(),
+        [&view, &value](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+            fill_pixels(detail::row_band(view, y_begin, y_end), value);
+        });
+}
+
 //////////////////////////////////////////////////////////////////////////////////////
 // destruct_pixels
 //////////////////////////////////////////////////////////////////////////////////////
@@ -879,6 +950,21 @@ F for_each_pixel(View const& view, F fun)
     }
 }
 
+/// \ingroup ImageViewSTLAlgorithmsForEachPixel
+/// \brief std::for_each for image views, bands of rows visited in parallel according to the execution policy
+///
+/// Each band is processed by its own copy of the function object, so, like std::for_each
+/// taking an execution policy, this overload does not return the function object.
+/// The function object must be safe to invoke concurrently on distinct pixels.
+template <typename Tag, typename View, typename F>
+void for_each_pixel(execution::execution_policy<Tag> const& policy, View const& view, F fun)
+{
+    detail::for_each_row_band(policy, view.width(), view.height(),
+        [&view, &fun](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+            for_each_pixel(detail::row_band(view, y_begin, y_end), fun);
+        });
+}
+
 /// \defgroup ImageViewSTLAlgorithmsForEachPixelPosition for_each_pixel_position
 /// \ingroup ImageViewSTLAlgorithms
 /// \brief adobe::for_each_position for image views (passes locators, instead of pixel references, to the function object)
@@ -921,6 +1007,20 @@ void generate_pixels(View const& view, F fun)
     }
 }
 
+/// \ingroup ImageViewSTLAlgorithmsGeneratePixels
+/// \brief std::generate for image views, bands of rows generated in parallel according to the execution policy
+///
+/// Each band is processed by its own copy of the generator, so a stateful generator
+/// produces its sequence once per band, not once for the whole view.
+template <typename Tag, typename View, typename F>
+void generate_pixels(execution::execution_policy<Tag> const& policy, View const& view, F fun)
+{
+    detail::for_each_row_band(policy, view.width(), view.height(),
+        [&view, &fun](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+            generate_pixels(detail::row_band(view, y_begin, y_end), fun);
+        });
+}
+
 //////////////////////////////////////////////////////////////////////////////////////
 // std::equal and gil::equal_pixels for GIL constructs
 //////////////////////////////////////////////////////////////////////////////////////
@@ -1138,6 +1238,50 @@ F transform_pixels(const View1& src1, const View2& src2,const View3& dst, F fun)
     return fun;
 }
 
+/// \ingroup ImageViewSTLAlgorithmsTransformPixels
+/// \brief std::transform for image views, bands of rows transformed in parallel according to the execution policy
+///
+/// Each band is processed by its own copy of the function object, so, like std::transform
+/// taking an execution policy, this overload does not return the function object.
+template <typename Tag, typename View1, typename View2, typename F>
+void transform_pixels(
+    execution::execution_policy<Tag> const& policy,
+    View1 const& src,
+    View2 const& dst,
+    F fun)
+{
+    BOOST_ASSERT(src.dimensions() == dst.dimensions());
+    detail::for_each_row_band(policy, src.width(), src.height(),
+        [&src, &dst, &fun](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+            transform_pixels(
+                detail::row_band(src, y_begin, y_end),
+                detail::row_band(dst, y_begin, y_end),
+                fun);
+        });
+}
+
+/// \ingroup ImageViewSTLAlgorithmsTransformPixels
+/// \brief transform_pixels with two sources, bands of rows transformed in parallel
+template <typename Tag, typename View1, typename View2, typename View3, typename F>
+void transform_pixels(
+    execution::execution_policy<Tag> const& policy,
+    View1 const& src1,
+    View2 const& src2,
+    View3 const& dst,
+    F fun)
+{
+    BOOST_ASSERT(src1.dimensions() == dst.dimensions());
+    BOOST_ASSERT(src2.dimensions() == dst.dimensions());
+    detail::for_each_row_band(policy, dst.width(), dst.height(),
+        [&src1, &src2, &dst, &fun](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+            transform_pixels(
+                detail::row_band(src1, y_begin, y_end),
+                detail::row_band(src2, y_begin, y_end),
+                detail::row_band(dst, y_begin, y_end),
+                fun);
+        });
+}
+
 /// \defgroup ImageViewSTLAlgorithmsTransformPixelPositions transform_pixel_positions
 /// \ingroup ImageViewSTLAlgorithms
 /// \brief adobe::transform_positions for image views (passes locators, instead of pixel references, to the function object)
@@ -0,0 +1,346 @@
+//
+// Copyright 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#ifndef BOOST_GIL_EXECUTION_HPP
+#define BOOST_GIL_EXECUTION_HPP
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace boost { namespace gil {
+
+/// \defgroup ExecutionPolicy Execution Policies
+/// \ingroup ImageViewAlgorithm
+/// \brief Execution policies accepted by the parallel overloads of the image view algorithms
+///
+/// GIL requires C++11, so it can not rely on \p std::execution from C++17.
+/// Instead, it defines its own policy types modelled after the standard ones.
+/// An algorithm invoked with a parallel policy splits the image view into bands of
+/// contiguous rows and processes the bands on threads of a pool shared by all algorithms,
+/// which is started on first use and reused by later calls. Each band is itself
+/// a regular image view, so all the single-threaded optimizations, like the
+/// \p is_1d_traversable() fast path, are still applied within a band.
+
+namespace execution {
+
+namespace detail {
+
+struct sequenced_tag {};
+struct parallel_tag {};
+struct parallel_unsequenced_tag {};
+
+} // namespace detail
+
+/// \ingroup ExecutionPolicy
+/// \brief Execution policy with optional cap on number of threads used to run an algorithm
+///
+/// Concurrency of zero requests the number of threads to match
+/// \p std::thread::hardware_concurrency().
+template <typename Tag>
+class execution_policy
+{
+public:
+    using tag_type = Tag;
+
+    constexpr execution_policy() = default;
+    constexpr explicit execution_policy(std::size_t concurrency)
+        : concurrency_(concurrency)
+    {}
+
+    /// \brief Returns copy of this policy limited to given number of threads
+    constexpr auto operator()(std::size_t concurrency) const -> execution_policy
+    {
+        return execution_policy(concurrency);
+    }
+
+    /// \brief Returns number of threads the policy allows to use, always greater than zero
+    auto concurrency() const -> std::size_t
+    {
+        if (std::is_same<Tag, detail::sequenced_tag>::value)
+            return 1;
+
+        std::size_t const n = concurrency_ != 0
+            ? concurrency_
+            : static_cast<std::size_t>(std::thread::hardware_concurrency());
+        return n != 0 ? n : 1;
+    }
+
+private:
+    std::size_t concurrency_{0};
+};
+
+/// \ingroup ExecutionPolicy
+/// \brief Execution may not be parallelized, equivalent of std::execution::sequenced_policy
+using sequenced_policy = execution_policy<detail::sequenced_tag>;
+
+/// \ingroup ExecutionPolicy
+/// \brief Execution may be parallelized, equivalent of std::execution::parallel_policy
+using parallel_policy = execution_policy<detail::parallel_tag>;
+
+/// \ingroup ExecutionPolicy
+/// \brief Execution may be parallelized and vectorized,
+/// equivalent of std::execution::parallel_unsequenced_policy
+using parallel_unsequenced_policy = execution_policy<detail::parallel_unsequenced_tag>;
+
+constexpr sequenced_policy seq{};
+constexpr parallel_policy par{};
+constexpr parallel_unsequenced_policy par_unseq{};
+
+/// \ingroup ExecutionPolicy
+/// \brief Determines if given type is one of the GIL execution policies
+template <typename T>
+struct is_execution_policy : std::false_type {};
+
+template <typename Tag>
+struct is_execution_policy<execution_policy<Tag>> : std::true_type {};
+
+} // namespace execution
+
+namespace detail {
+
+/// \brief Minimum number of pixels processed by a single band of rows.
+///
+/// Prevents spawning threads for views too small to amortize the cost.
+constexpr std::ptrdiff_t min_pixels_per_band = 4096;
+
+/// \brief Number of bands of rows a view of given dimensions is split into
+template <typename Tag>
+inline auto row_band_count(
+    execution::execution_policy<Tag> const& policy,
+    std::ptrdiff_t width,
+    std::ptrdiff_t height) -> std::ptrdiff_t
+{
+    if (width <= 0 || height <= 0)
+        return 0;
+
+    std::ptrdiff_t const max_bands =
+        std::max<std::ptrdiff_t>(1, (width * height) / min_pixels_per_band);
+    std::ptrdiff_t const threads = static_cast<std::ptrdiff_t>(policy.concurrency());
+    return std::min(std::min(threads, max_bands), height);
+}
+
+/// \brief Pool of worker threads shared by all parallel algorithms
+///
+/// Workers are started on first use and grow in number up to the most requested,
+/// but never beyond hardware concurrency, so repeated calls on small views do not pay
+/// for spawning and joining threads. The thread submitting a job processes its tasks
+/// as well, so jobs submitted from within tasks of other jobs can not deadlock the pool.
+class row_band_thread_pool
+{
+public:
+    static auto instance() -> row_band_thread_pool&
+    {
+        static row_band_thread_pool pool;
+        return pool;
+    }
+
+    row_band_thread_pool() = default;
+    row_band_thread_pool(row_band_thread_pool const&) = delete;
+    row_band_thread_pool& operator=(row_band_thread_pool const&) = delete;
+
+    ~row_band_thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto& worker : workers_)
+            worker.join();
+    }
+
+    /// \brief Invokes task(i) for every i in [0, count) on up to count threads
+    ///
+    /// Returns once all invocations have finished. Task must not throw.
+    template <typename Task>
+    void run(std::ptrdiff_t count, Task& task)
+    {
+        job j;
+        j.task = &task;
+        j.invoke = [](void* t, std::ptrdiff_t i) { (*static_cast<Task*>(t))(i); };
+        j.count = count;
+        j.pending = count;
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        start_workers(static_cast<std::size_t>(count - 1));
+        jobs_.push_back(&j);
+        wake_.notify_all();
+
+        while (j.next < j.count)
+            execute(j, lock);
+        j.done.wait(lock, [&j] { return j.pending == 0; });
+    }
+
+private:
+    struct job
+    {
+        void* task{nullptr};
+        void (*invoke)(void*, std::ptrdiff_t){nullptr};
+        std::ptrdiff_t count{0};
+        std::ptrdiff_t next{0};
+        std::ptrdiff_t pending{0};
+        std::condition_variable done;
+    };
+
+    // Requires lock held, which is released while the task runs
+    void execute(job& j, std::unique_lock<std::mutex>& lock)
+    {
+        std::ptrdiff_t const i = j.next++;
+        if (j.next == j.count)
+            jobs_.erase(std::find(jobs_.begin(), jobs_.end(), &j));
+
+        lock.unlock();
+        j.invoke(j.task, i);
+        lock.lock();
+
+        if (--j.pending == 0)
+            j.done.notify_all();
+    }
+
+    // Requires lock held
+    void start_workers(std::size_t count)
+    {
+        std::size_t const hardware = std::thread::hardware_concurrency();
+        if (hardware != 0)
+            count = (std::min)(count, hardware);
+
+        while (workers_.size() < count)
+        {
+            try
+            {
+                workers_.emplace_back([this] { work(); });
+            }
+            catch (std::system_error const&)
+            {
+                break; // unable to spawn thread, tasks are run by the existing ones
+            }
+        }
+    }
+
+    void work()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;)
+        {
+            wake_.wait(lock, [this] { return stop_ || !jobs_.empty(); });
+            if (jobs_.empty())
+                return;
+            execute(*jobs_.front(), lock);
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::deque<job*> jobs_;
+    std::vector<std::thread> workers_;
+    bool stop_{false};
+};
+
+/// \brief Splits rows [0, height) into contiguous bands and invokes f(y_begin, y_end) for each.
+///
+/// Bands are processed by the calling thread together with workers of the shared
+/// row_band_thread_pool. The call returns once all bands have been processed. If processing
+/// of any band throws, the first exception caught is rethrown after all bands have finished.
+template <typename Tag, typename F>
+void for_each_row_band(
+    execution::execution_policy<Tag> const& policy,
+    std::ptrdiff_t width,
+    std::ptrdiff_t height,
+    F f)
+{
+    std::ptrdiff_t const bands = row_band_count(policy, width, height);
+    if (bands == 0)
+        return;
+
+    if (bands == 1)
+    {
+        f(std::ptrdiff_t(0), height);
+        return;
+    }
+
+    // Distribute remainder rows one per band, so bands differ in height by one row at most
+    std::ptrdiff_t const rows_per_band = height / bands;
+    std::ptrdiff_t const remainder = height % bands;
+    auto band_begin = [=](std::ptrdiff_t band) -> std::ptrdiff_t {
+        return band * rows_per_band + std::min(band, remainder);
+    };
+
+    std::vector<std::exception_ptr> errors(static_cast<std::size_t>(bands));
+    auto run_band = [&](std::ptrdiff_t band) {
+        try
+        {
+            f(band_begin(band), band_begin(band + 1));
+        }
+        catch (...)
+        {
+            errors[static_cast<std::size_t>(band)] = std::current_exception();
+        }
+    };
+    row_band_thread_pool::instance().run(bands, run_band);
+
+    for (auto const& e : errors)
+    {
+        if (e)
+            std::rethrow_exception(e);
+    }
+}
+
+/// \brief Keeps only max_count strongest items, all of them for zero
+///
+/// Stronger is strict total order of items, from the strongest, so that the kept items
+/// do not depend on their initial order.
+template <typename T, typename Stronger>
+void keep_strongest(std::vector<T>& items, std::size_t max_count, Stronger stronger)
+{
+    if (max_count == 0 || items.size() <= max_count)
+        return;
+    std::nth_element(items.begin(), items.begin() + static_cast<std::ptrdiff_t>(max_count),
+        items.end(), stronger);
+    items.resize(max_count);
+}
+
+/// \brief Appends to items those found in bands of rows [0, height) by
+/// find(y_begin, y_end, band_items), invoked for bands in parallel
+///
+/// Each band keeps only its max_count strongest items, all of them for zero, before they
+/// are merged, which keeps the max_count strongest items of all bands.
+template <typename Tag, typename T, typename Stronger, typename Find>
+void collect_strongest_in_row_bands(
+    execution::execution_policy<Tag> const& policy,
+    std::ptrdiff_t width,
+    std::ptrdiff_t height,
+    std::size_t max_count,
+    Stronger stronger,
+    Find const& find,
+    std::vector<T>& items)
+{
+    std::mutex items_mutex;
+    for_each_row_band(policy, width, height, [&](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+        std::vector<T> band_items;
+        find(y_begin, y_end, band_items);
+        keep_strongest(band_items, max_count, stronger);
+
+        std::lock_guard<std::mutex> lock(items_mutex);
+        items.insert(items.end(), band_items.begin(), band_items.end());
+    });
+}
+
+} // namespace detail
+
+}} // namespace boost::gil
+
+#endif
@@ -111,6 +111,63 @@ void copy_pixels(any_image_view<Types1...> const& src, any_image_view<Types2...>
     apply_operation(src, dst, detail::copy_pixels_fn());
 }
 
+namespace detail {
+
+template <typename Tag>
+struct copy_pixels_policy_fn : public binary_operation_obj<copy_pixels_policy_fn<Tag>>
+{
+    copy_pixels_policy_fn(execution::execution_policy<Tag> const& policy) : policy_(policy) {}
+
+    template <typename View1, typename View2>
+    BOOST_FORCEINLINE
+    void apply_compatible(View1 const& src, View2 const& dst) const
+    {
+        copy_pixels(policy_, src, dst);
+    }
+
+    execution::execution_policy<Tag> policy_;
+};
+
+} // namespace detail
+
+/// \ingroup ImageViewSTLAlgorithmsCopyPixels
+/// \tparam Types Model Boost.MP11-compatible list of models of ImageViewConcept
+/// \tparam View Model MutableImageViewConcept
+template <typename Tag, typename ...Types, typename View>
+void copy_pixels(
+    execution::execution_policy<Tag> const& policy,
+    any_image_view<Types...> const& src,
+    View const& dst)
+{
+    using fn_t = detail::copy_pixels_policy_fn<Tag>;
+    apply_operation(src, std::bind(fn_t{policy}, std::placeholders::_1, dst));
+}
+
+/// \ingroup ImageViewSTLAlgorithmsCopyPixels
+/// \tparam View Model ImageViewConcept
+/// \tparam Types Model Boost.MP11-compatible list of models of MutableImageViewConcept
+template <typename Tag, typename View, typename ...Types>
+void copy_pixels(
+    execution::execution_policy<Tag> const& policy,
+    View const& src,
+    any_image_view<Types...> const& dst)
+{
+    using fn_t = detail::copy_pixels_policy_fn<Tag>;
+    apply_operation(dst, std::bind(fn_t{policy}, src, std::placeholders::_1));
+}
+
+/// \ingroup ImageViewSTLAlgorithmsCopyPixels
+/// \tparam Types1 Model Boost.MP11-compatible list of models of ImageViewConcept
+/// \tparam Types2 Model Boost.MP11-compatible list of models of MutableImageViewConcept
+template <typename Tag, typename ...Types1, typename ...Types2>
+void copy_pixels(
+    execution::execution_policy<Tag> const& policy,
+    any_image_view<Types1...> const& src,
+    any_image_view<Types2...> const& dst)
+{
+    apply_operation(src, dst, detail::copy_pixels_policy_fn<Tag>{policy});
+}
+
 //forward declaration for default_color_converter (see full definition in color_convert.hpp)
 struct default_color_converter;
 
@@ -182,11 +239,123 @@ void copy_and_convert_pixels(
 
 namespace detail {
 
+template <typename Tag, typename CC>
+struct copy_and_convert_pixels_policy_fn
+{
+    using result_type = void;
+
+    copy_and_convert_pixels_policy_fn(execution::execution_policy<Tag> const& policy, CC cc)
+        : policy_(policy), cc_(cc)
+    {}
+
+    template <typename View1, typename View2>
+    result_type operator()(View1 const& src, View2 const& dst) const
+    {
+        copy_and_convert_pixels(policy_, src, dst, cc_);
+    }
+
+    execution::execution_policy<Tag> policy_;
+    CC cc_;
+};
+
+} // namespace detail
+
+/// \ingroup ImageViewSTLAlgorithmsCopyAndConvertPixels
+/// \tparam Types Model Boost.MP11-compatible list of models of ImageViewConcept
+/// \tparam View Model MutableImageViewConcept
+/// \tparam CC Model ColorConverterConcept
+template <typename Tag, typename ...Types, typename View, typename CC>
+void copy_and_convert_pixels(
+    execution::execution_policy<Tag> const& policy,
+    any_image_view<Types...> const& src,
+    View const& dst,
+    CC cc)
+{
+    using fn_t = detail::copy_and_convert_pixels_policy_fn<Tag, CC>;
+    apply_operation(src, std::bind(fn_t{policy, cc}, std::placeholders::_1, dst));
+}
+
+/// \ingroup ImageViewSTLAlgorithmsCopyAndConvertPixels
+/// \tparam Types Model Boost.MP11-compatible list of models of ImageViewConcept
+/// \tparam View Model MutableImageViewConcept
+template <typename Tag, typename ...Types, typename View>
+void copy_and_convert_pixels(
+    execution::execution_policy<Tag> const& policy,
+    any_image_view<Types...> const& src,
+    View const& dst)
+{
+    using fn_t = detail::copy_and_convert_pixels_policy_fn<Tag, default_color_converter>;
+    apply_operation(src, std::bind(fn_t{policy, {}}, std::placeholders::_1, dst));
+}
+
+/// \ingroup ImageViewSTLAlgorithmsCopyAndConvertPixels
+/// \tparam View Model ImageViewConcept
+/// \tparam Types Model Boost.MP11-compatible list of models of MutableImageViewConcept
+/// \tparam CC Model ColorConverterConcept
+template <typename Tag, typename View, typename ...Types, typename CC>
+void copy_and_convert_pixels(
+    execution::execution_policy<Tag> const& policy,
+    View const& src,
+    any_image_view<Types...> const& dst,
+    CC cc)
+{
+    using fn_t = detail::copy_and_convert_pixels_policy_fn<Tag, CC>;
+    apply_operation(dst, std::bind(fn_t{policy, cc}, src, std::placeholders::_1));
+}
+
+/// \ingroup ImageViewSTLAlgorithmsCopyAndConvertPixels
+/// \tparam View Model ImageViewConcept
+/// \tparam Types Model Boost.MP11-compatible list of models of MutableImageViewConcept
+template <typename Tag, typename View, typename ...Types>
+void copy_and_convert_pixels(
+    execution::execution_policy<Tag> const& policy,
+    View const& src,
+    any_image_view<Types...> const& dst)
+{
+    using fn_t = detail::copy_and_convert_pixels_policy_fn<Tag, default_color_converter>;
+    apply_operation(dst, std::bind(fn_t{policy, {}}, src, std::placeholders::_1));
+}
+
+/// \ingroup ImageViewSTLAlgorithmsCopyAndConvertPixels
+/// \tparam Types1 Model Boost.MP11-compatible list of models of ImageViewConcept
+/// \tparam Types2 Model Boost.MP11-compatible list of models of MutableImageViewConcept
+/// \tparam CC Model ColorConverterConcept
+template <typename Tag, typename ...Types1, typename ...Types2, typename CC>
+void copy_and_convert_pixels(
+    execution::execution_policy<Tag> const& policy,
+    any_image_view<Types1...> const& src,
+    any_image_view<Types2...> const& dst,
+    CC cc)
+{
+    apply_operation(src, dst, detail::copy_and_convert_pixels_policy_fn<Tag, CC>{policy, cc});
+}
+
+/// \ingroup ImageViewSTLAlgorithmsCopyAndConvertPixels
+/// \tparam Types1 Model Boost.MP11-compatible list of models of ImageViewConcept
+/// \tparam Types2 Model Boost.MP11-compatible list of models of MutableImageViewConcept
+template <typename Tag, typename ...Types1, typename ...Types2>
+void copy_and_convert_pixels(
+    execution::execution_policy<Tag> const& policy,
+    any_image_view<Types1...> const& src,
+    any_image_view<Types2...> const& dst)
+{
+    using fn_t = detail::copy_and_convert_pixels_policy_fn<Tag, default_color_converter>;
+    apply_operation(src, dst, fn_t{policy, {}});
+}
+
+namespace detail {
+
 template <bool IsCompatible>
 struct fill_pixels_fn1
 {
     template <typename V, typename Value>
     static void apply(V const &src, Value const &val) { fill_pixels(src, val); }
+
+    template <typename Tag, typename V, typename Value>
+    static void apply(execution::execution_policy<Tag> const& policy, V const &src, Value const &val)
+    {
+        fill_pixels(policy, src, val);
+    }
 };
 
 // copy_pixels invoked on incompatible images
@@ -195,6 +364,12 @@ struct fill_pixels_fn1<false>
 {
     template <typename V, typename Value>
     static void apply(V const &, Value const &) { throw std::bad_cast();}
+
+    template <typename Tag, typename V, typename Value>
+    static void apply(execution::execution_policy<Tag> const&, V const &, Value const &)
+    {
+        throw std::bad_cast();
+    }
 };
 
 template <typename Value>
@@ -219,6 +394,31 @@ struct fill_pixels_fn
     Value val_;
 };
 
+template <typename Tag, typename Value>
+struct fill_pixels_policy_fn
+{
+    fill_pixels_policy_fn(execution::execution_policy<Tag> const& policy, Value const& val)
+        : policy_(policy), val_(val)
+    {}
+
+    using result_type = void;
+    template <typename V>
+    result_type operator()(V const& view) const
+    {
+        fill_pixels_fn1
+        <
+            pixels_are_compatible
+            <
+                typename V::value_type,
+                Value
+            >::value
+        >::apply(policy_, view, val_);
+    }
+
+    execution::execution_policy<Tag> policy_;
+    Value val_;
+};
+
 } // namespace detail
 
 /// \ingroup ImageViewSTLAlgorithmsFillPixels
@@ -230,6 +430,146 @@ void fill_pixels(any_image_view<Types...> const& view, Value const& val)
     apply_operation(view, detail::fill_pixels_fn<Value>(val));
 }
 
+/// \ingroup ImageViewSTLAlgorithmsFillPixels
+/// \brief fill_pixels for any image view, bands of rows filled in parallel according to the execution policy
+/// \tparam Types Model Boost.MP11-compatible list of models of MutableImageViewConcept
+template <typename Tag, typename ...Types, typename Value>
+void fill_pixels(
+    execution::execution_policy<Tag> const& policy,
+    any_image_view<Types...> const& view,
+    Value const& val)
+{
+    apply_operation(view, detail::fill_pixels_policy_fn<Tag, Value>(policy, val));
+}
+
+namespace detail {
+
+template <typename Tag, typename F>
+struct for_each_pixel_policy_fn
+{
+    for_each_pixel_policy_fn(execution::execution_policy<Tag> const& policy, F fun)
+        : policy_(policy), fun_(fun)
+    {}
+
+    using result_type = void;
+    template <typename View>
+    result_type operator()(View const& view) const
+    {
+        for_each_pixel(policy_, view, fun_);
+    }
+
+    execution::execution_policy<Tag> policy_;
+    F fun_;
+};
+
+template <typename Tag, typename F>
+struct generate_pixels_policy_fn
+{
+    generate_pixels_policy_fn(execution::execution_policy<Tag> const& policy, F fun)
+        : policy_(policy), fun_(fun)
+    {}
+
+    using result_type = void;
+    template <typename View>
+    result_type operator()(View const& view) const
+    {
+        generate_pixels(policy_, view, fun_);
+    }
+
+    execution::execution_policy<Tag> policy_;
+    F fun_;
+};
+
+template <typename Tag, typename F>
+struct transform_pixels_policy_fn
+{
+    transform_pixels_policy_fn(execution::execution_policy<Tag> const& policy, F fun)
+        : policy_(policy), fun_(fun)
+    {}
+
+    using result_type = void;
+    template <typename View1, typename View2>
+    result_type operator()(View1 const& src, View2 const& dst) const
+    {
+        transform_pixels(policy_, src, dst, fun_);
+    }
+
+    execution::execution_policy<Tag> policy_;
+    F fun_;
+};
+
+} // namespace detail
+
+/// \ingroup ImageViewSTLAlgorithmsForEachPixel
+/// \brief for_each_pixel for any image view, bands of rows visited in parallel according to the execution policy
+/// \tparam Types Model Boost.MP11-compatible list of models of ImageViewConcept
+/// \tparam F Function object which accepts pixels of every view type of Types
+template <typename Tag, typename ...Types, typename F>
+void for_each_pixel(
+    execution::execution_policy<Tag> const& policy,
+    any_image_view<Types...> const& view,
+    F fun)
+{
+    apply_operation(view, detail::for_each_pixel_policy_fn<Tag, F>(policy, fun));
+}
+
+/// \ingroup ImageViewSTLAlgorithmsGeneratePixels
+/// \brief generate_pixels for any image view, bands of rows generated in parallel according to the execution policy
+/// \tparam Types Model Boost.MP11-compatible list of models of MutableImageViewConcept
+/// \tparam F Generator whose result is assignable to pixels of every view type of Types
+template <typename Tag, typename ...Types, typename F>
+void generate_pixels(
+    execution::execution_policy<Tag> const& policy,
+    any_image_view<Types...> const& view,
+    F fun)
+{
+    apply_operation(view, detail::generate_pixels_policy_fn<Tag, F>(policy, fun));
+}
+
+/// \ingroup ImageViewSTLAlgorithmsTransformPixels
+/// \brief transform_pixels for any image view, bands of rows transformed in parallel according to the execution policy
+/// \tparam Types Model Boost.MP11-compatible list of models of ImageViewConcept
+/// \tparam View Model MutableImageViewConcept
+template <typename Tag, typename ...Types, typename View, typename F>
+void transform_pixels(
+    execution::execution_policy<Tag> const& policy,
+    any_image_view<Types...> const& src,
+    View const& dst,
+    F fun)
+{
+    using fn_t = detail::transform_pixels_policy_fn<Tag, F>;
+    apply_operation(src, std::bind(fn_t{policy, fun}, std::placeholders::_1, dst));
+}
+
+/// \ingroup ImageViewSTLAlgorithmsTransformPixels
+/// \brief transform_pixels for any image view, bands of rows transformed in parallel according to the execution policy
+/// \tparam View Model ImageViewConcept
+/// \tparam Types Model Boost.MP11-compatible list of models of MutableImageViewConcept
+template <typename Tag, typename View, typename ...Types, typename F>
+void transform_pixels(
+    execution::execution_policy<Tag> const& policy,
+    View const& src,
+    any_image_view<Types...> const& dst,
+    F fun)
+{
+    using fn_t = detail::transform_pixels_policy_fn<Tag, F>;
+    apply_operation(dst, std::bind(fn_t{policy, fun}, src, std::placeholders::_1));
+}
+
+/// \ingroup ImageViewSTLAlgorithmsTransformPixels
+/// \brief transform_pixels for any image views, bands of rows transformed in parallel according to the execution policy
+/// \tparam Types1 Model Boost.MP11-compatible list of models of ImageViewConcept
+/// \tparam Types2 Model Boost.MP11-compatible list of models of MutableImageViewConcept
+template <typename Tag, typename ...Types1, typename ...Types2, typename F>
+void transform_pixels(
+    execution::execution_policy<Tag> const& policy,
+    any_image_view<Types1...> const& src,
+    any_image_view<Types2...> const& dst,
+    F fun)
+{
+    apply_operation(src, dst, detail::transform_pixels_policy_fn<Tag, F>(policy, fun));
+}
+
 }}  // namespace boost::gil
 
 #endif
@@ -108,6 +108,90 @@ boost::gil::matrix3x2<T> inverse(boost::gil::matrix3x2<T> m)
     return res;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////
+///
+/// Matrix of 2D projective transformation (homography). Elements a to f have the meaning
+/// they have in matrix3x2, u, v and w form the last column, [0 0 1] for affine transformation:
+///
+///     [x y 1] * | a b u |
+///               | c d v |   = [x' y' z'],  mapped point (x' / z', y' / z')
+///               | e f w |
+///
+////////////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class matrix3x3 {
+public:
+    matrix3x3() : a(1), b(0), u(0), c(0), d(1), v(0), e(0), f(0), w(1) {}
+    matrix3x3(T A, T B, T U, T C, T D, T V, T E, T F, T W)
+        : a(A), b(B), u(U), c(C), d(D), v(V), e(E), f(F), w(W) {}
+    matrix3x3(const matrix3x2<T>& m)
+        : a(m.a), b(m.b), u(0), c(m.c), d(m.d), v(0), e(m.e), f(m.f), w(1) {}
+
+    matrix3x3& operator*=(const matrix3x3& m) { (*this) = (*this)*m; return *this; }
+
+    T a,b,u,c,d,v,e,f,w;
+};
+
+template <typename T> BOOST_FORCEINLINE
+matrix3x3<T> operator*(const matrix3x3<T>& m1, const matrix3x3<T>& m2) {
+    return matrix3x3<T>(
+                m1.a * m2.a + m1.b * m2.c + m1.u * m2.e,
+                m1.a * m2.b + m1.b * m2.d + m1.u * m2.f,
+                m1.a * m2.u + m1.b * m2.v + m1.u * m2.w,
+                m1.c * m2.a + m1.d * m2.c + m1.v * m2.e,
+                m1.c * m2.b + m1.d * m2.d + m1.v * m2.f,
+                m1.c * m2.u + m1.d * m2.v + m1.v * m2.w,
+                m1.e * m2.a + m1.f * m2.c + m1.w * m2.e,
+                m1.e * m2.b + m1.f * m2.d + m1.w * m2.f,
+                m1.e * m2.u + m1.f * m2.v + m1.w * m2.w);
+}
+
+template <typename T, typename F>
+BOOST_FORCEINLINE
+point<F> operator*(point<T> const& p, matrix3x3<F> const& m)
+{
+    F const z = m.u * p.x + m.v * p.y + m.w;
+    return { (m.a * p.x + m.c * p.y + m.e) / z, (m.b * p.x + m.d * p.y + m.f) / z };
+}
+
+template <typename F>
+struct mapping_traits<matrix3x3<F>>
+{
+    using result_type = point<F>;
+};
+
+template <typename F, typename F2>
+BOOST_FORCEINLINE
+point<F> transform(matrix3x3<F> const& mat, point<F2> const& src)
+{
+    return src * mat;
+}
+
+/// Returns the inverse of the given projective transformation matrix
+///
+/// \warning Floating point arithmetic, use Boost.Rational if precision maters
+template <typename T>
+boost::gil::matrix3x3<T> inverse(boost::gil::matrix3x3<T> m)
+{
+    T const a = m.d * m.w - m.v * m.f;
+    T const c = m.v * m.e - m.c * m.w;
+    T const e = m.c * m.f - m.d * m.e;
+    T const determinant = m.a * a + m.b * c + m.u * e;
+
+    boost::gil::matrix3x3<T> res;
+    res.a = a / determinant;
+    res.b = (m.u * m.f - m.b * m.w) / determinant;
+    res.u = (m.b * m.v - m.u * m.d) / determinant;
+    res.c = c / determinant;
+    res.d = (m.a * m.w - m.u * m.e) / determinant;
+    res.v = (m.u * m.c - m.a * m.v) / determinant;
+    res.e = e / determinant;
+    res.f = (m.b * m.e - m.a * m.f) / determinant;
+    res.w = (m.a * m.d - m.b * m.c) / determinant;
+
+    return res;
+}
+
 /// \fn gil::matrix3x2 center_rotate 
 /// \tparam T     Data type for source image dimensions
 /// \tparam F     Data type for angle through which image is to be rotated
@@ -14,6 +14,10 @@
 #include <boost/gil/metafunctions.hpp>
 #include <boost/gil/pixel_iterator.hpp>
 #include <boost/gil/image.hpp>
+#include <boost/gil/image_view.hpp>
+#include <boost/gil/point.hpp>
+#include <boost/gil/utilities.hpp>
+#include <boost/gil/virtual_locator.hpp>
 
 #include <boost/assert.hpp>
 
@@ -262,84 +266,260 @@ enum class boundary_option
     extend_constant /// assume the source boundaries to be the boundary value
 };
 
-namespace detail
+/// \ingroup ImageAlgorithms
+/// \brief Modes of extension of image beyond its boundary, shown for row abcdefgh
+enum class boundary_mode
 {
+    constant,    /// iiiiii|abcdefgh|iiiiiii, with given pixel i
+    replicate,   /// aaaaaa|abcdefgh|hhhhhhh
+    reflect,     /// fedcba|abcdefgh|hgfedcb
+    reflect_101, /// gfedcb|abcdefgh|gfedcba
+    wrap         /// cdefgh|abcdefgh|abcdefg
+};
 
-template <typename SrcView, typename RltView>
-void extend_row_impl(
-    SrcView const& src_view,
-    RltView result_view,
-    std::size_t extend_count,
-    boundary_option option)
+/// \ingroup ImageAlgorithms
+/// \brief Maps coordinate along axis of given size into [0, size) according to boundary mode
+///
+/// Coordinates inside the axis are kept. Coordinates outside are mapped however far they
+/// are, except for constant mode, which maps them to -1.
+inline auto extend_coordinate(std::ptrdiff_t v, std::ptrdiff_t size, boundary_mode mode)
+    -> std::ptrdiff_t
+{
+    if (v >= 0 && v < size)
+        return v;
+    if (mode == boundary_mode::constant)
+        return -1;
+
+    BOOST_ASSERT(size > 0);
+    auto modulo = [](std::ptrdiff_t a, std::ptrdiff_t b) {
+        std::ptrdiff_t const m = a % b;
+        return m < 0 ? m + b : m;
+    };
+    switch (mode)
+    {
+    case boundary_mode::replicate:
+        return v < 0 ? 0 : size - 1;
+    case boundary_mode::reflect:
+    {
+        std::ptrdiff_t const m = modulo(v, 2 * size);
+        return m < size ? m : 2 * size - 1 - m;
+    }
+    case boundary_mode::reflect_101:
+    {
+        if (size == 1)
+            return 0;
+        std::ptrdiff_t const m = modulo(v, 2 * size - 2);
+        return m < size ? m : 2 * size - 2 - m;
+    }
+    case boundary_mode::wrap:
+        return modulo(v, size);
+    default:
+        BOOST_ASSERT_MSG(false, "Invalid boundary mode");
+        return -1;
+    }
+}
+
+/// \ingroup PixelDereferenceAdaptorModel
+/// \brief Function object returning pixel of view at given position, which may be anywhere
+/// outside the view, extended according to boundary mode
+///
+/// Position is relative to the view origin moved by given offset, so position equal
+/// to offset is pixel (0, 0) of the view.
+/// Models: PixelDereferenceAdaptorConcept
+template <typename View>
+class boundary_extension_deref_fn : public deref_base
+    <
+        boundary_extension_deref_fn<View>,
+        typename View::value_type,
+        typename View::value_type,
+        typename View::value_type,
+        point_t,
+        typename View::value_type,
+        false
+    >
 {
-    std::ptrdiff_t extend_count_ = static_cast<std::ptrdiff_t>(extend_count);
+public:
+    using value_type = typename View::value_type;
 
-    if (option == boundary_option::extend_constant)
+    boundary_extension_deref_fn() = default;
+
+    boundary_extension_deref_fn(
+        View const& view,
+        point_t const& offset,
+        boundary_mode mode,
+        value_type const& constant)
+        : view_(view), offset_(offset), mode_(mode), constant_(constant)
     {
-        for (std::ptrdiff_t i = 0; i < result_view.height(); i++)
-        {
-            if(i >= extend_count_ && i < extend_count_ + src_view.height())
-            {
-                assign_pixels(
-                    src_view.row_begin(i - extend_count_),
-                    src_view.row_end(i - extend_count_),
-                    result_view.row_begin(i)
-                );
-            }
-            else if(i < extend_count_)
-            {
-                assign_pixels(src_view.row_begin(0), src_view.row_end(0), result_view.row_begin(i));
-            }
-            else
-            {
-                assign_pixels(
-                    src_view.row_begin(src_view.height() - 1),
-                    src_view.row_end(src_view.height() - 1),
-                    result_view.row_begin(i)
-                );
-            }
+    }
 
-        }
+    auto operator()(point_t const& p) const -> value_type
+    {
+        std::ptrdiff_t const x = extend_coordinate(p.x - offset_.x, view_.width(), mode_);
+        std::ptrdiff_t const y = extend_coordinate(p.y - offset_.y, view_.height(), mode_);
+        if (x < 0 || y < 0)
+            return constant_;
+        return view_(x, y);
     }
-    else if (option == boundary_option::extend_zero)
+
+    auto view() const -> View const& { return view_; }
+    auto offset() const -> point_t const& { return offset_; }
+    auto mode() const -> boundary_mode { return mode_; }
+    auto constant() const -> value_type const& { return constant_; }
+
+private:
+    View view_;
+    point_t offset_;
+    boundary_mode mode_{boundary_mode::constant};
+    value_type constant_;
+};
+
+/// \ingroup ImageAlgorithms
+/// \brief Type of view returned by boundary_extended_view
+template <typename View>
+struct boundary_extended_view_type
+{
+    using deref_t = boundary_extension_deref_fn<View>;
+    using locator_t = virtual_2d_locator<deref_t, false>;
+    using type = image_view<locator_t>;
+};
+
+/// \ingroup ImageAlgorithms
+/// \brief Virtual view of source extended by extend_count pixels on each side according to
+/// boundary mode, pixels of constant mode given by constant
+///
+/// Counterpart of extend_boundary, which answers reads outside the source without
+/// allocating and filling an extended image. Pixel (extend_count, extend_count) is pixel
+/// (0, 0) of the source. Locators of the view may also read pixels beyond the extended
+/// dimensions, which are mapped by the same boundary mode.
+/// \tparam View Models ImageViewConcept
+template <typename View>
+auto boundary_extended_view(
+    View const& src_view,
+    std::size_t extend_count,
+    boundary_mode mode,
+    typename View::value_type const& constant) -> typename boundary_extended_view_type<View>::type
+{
+    using view_t = boundary_extended_view_type<View>;
+    auto const count = static_cast<std::ptrdiff_t>(extend_count);
+    point_t const offset(count, count);
+    typename view_t::locator_t const locator(
+        point_t(0, 0), point_t(1, 1),
+        typename view_t::deref_t(src_view, offset, mode, constant));
+    return typename view_t::type(src_view.dimensions() + offset + offset, locator);
+}
+
+/// \ingroup ImageAlgorithms
+/// \brief Virtual view of source extended by extend_count pixels on each side according to
+/// boundary mode, pixels of constant mode zero
+/// \tparam View Models ImageViewConcept
+template <typename View>
+auto boundary_extended_view(View const& src_view, std::size_t extend_count, boundary_mode mode)
+    -> typename boundary_extended_view_type<View>::type
+{
+    typename View::value_type zero;
+    pixel_zeros_t<typename View::value_type>()(zero);
+    return boundary_extended_view(src_view, extend_count, mode, zero);
+}
+
+/// \ingroup ImageAlgorithms
+/// \brief Rectangle [x_begin, x_end) x [y_begin, y_end) of pixels of view
+struct view_region
+{
+    std::ptrdiff_t x_begin{0};
+    std::ptrdiff_t x_end{0};
+    std::ptrdiff_t y_begin{0};
+    std::ptrdiff_t y_end{0};
+
+    auto empty() const -> bool { return x_begin >= x_end || y_begin >= y_end; }
+
+    auto contains(std::ptrdiff_t x, std::ptrdiff_t y) const -> bool
     {
-        typename SrcView::value_type acc_zero;
-        pixel_zeros_t<typename SrcView::value_type>()(acc_zero);
+        return x >= x_begin && x < x_end && y >= y_begin && y < y_end;
+    }
+};
 
-        for (std::ptrdiff_t i = 0; i < result_view.height(); i++)
+/// \ingroup ImageAlgorithms
+/// \brief Region of pixels of view, which windows reaching given numbers of pixels before
+/// (left and above) and after (right and below) them lie inside the view
+///
+/// Algorithms run unchecked loops over pixels of the interior, reading the view directly,
+/// and read boundary_extended_view only for the remaining border strips. Region is empty,
+/// if windows are larger than the view.
+/// \tparam View Models ImageViewConcept
+template <typename View>
+auto interior_region(View const& view, point_t const& before, point_t const& after)
+    -> view_region
+{
+    BOOST_ASSERT(before.x >= 0 && before.y >= 0 && after.x >= 0 && after.y >= 0);
+    view_region region;
+    region.x_begin = (std::min)(before.x, view.width());
+    region.x_end = (std::max)(region.x_begin, view.width() - after.x);
+    region.y_begin = (std::min)(before.y, view.height());
+    region.y_end = (std::max)(region.y_begin, view.height() - after.y);
+    return region;
+}
+
+namespace detail
+{
+
+/// \brief Copies source extended by count.x columns and count.y rows on each side to
+/// destination of extended dimensions
+///
+/// Source part of each row is copied directly, only the border strips are extended
+/// pixel by pixel.
+template <typename SrcView, typename DstView>
+void copy_boundary_extended(
+    SrcView const& src_view,
+    point_t const& count,
+    boundary_mode mode,
+    typename SrcView::value_type const& constant,
+    DstView const& dst_view)
+{
+    BOOST_ASSERT(dst_view.dimensions() == src_view.dimensions() + count + count);
+    boundary_extension_deref_fn<SrcView> const extend(src_view, count, mode, constant);
+    for (std::ptrdiff_t y = 0; y < dst_view.height(); ++y)
+    {
+        auto dst_it = dst_view.row_begin(y);
+        std::ptrdiff_t const src_y = extend_coordinate(y - count.y, src_view.height(), mode);
+        if (src_y < 0)
         {
-            if (i >= extend_count_ && i < extend_count_ + src_view.height())
-            {
-                assign_pixels(
-                    src_view.row_begin(i - extend_count_),
-                    src_view.row_end(i - extend_count_),
-                    result_view.row_begin(i)
-                );
-            }
-            else
-            {
-                std::fill_n(result_view.row_begin(i), result_view.width(), acc_zero);
-            }
+            std::fill_n(dst_it, dst_view.width(), constant);
+            continue;
         }
+
+        for (std::ptrdiff_t x = 0; x < count.x; ++x)
+            dst_it[x] = extend(point_t(x, y));
+        std::copy(src_view.row_begin(src_y), src_view.row_end(src_y), dst_it + count.x);
+        for (std::ptrdiff_t x = count.x + src_view.width(); x < dst_view.width(); ++x)
+            dst_it[x] = extend(point_t(x, y));
     }
-    else if (option == boundary_option::extend_padded)
+}
+
+template <typename SrcView, typename DstView>
+void extend_boundary_impl(
+    SrcView const& src_view,
+    point_t const& count,
+    boundary_option option,
+    DstView const& dst_view)
+{
+    if (option == boundary_option::extend_padded)
     {
-        auto original_view = subimage_view(
-            src_view,
-            0,
-            -extend_count,
-            src_view.width(),
-            src_view.height() + (2 * extend_count)
-        );
-        for (std::ptrdiff_t i = 0; i < result_view.height(); i++)
+        // Locator, unlike view, does not assert reads outside the view bounds
+        for (std::ptrdiff_t y = 0; y < dst_view.height(); ++y)
         {
-            assign_pixels(
-                original_view.row_begin(i),
-                original_view.row_end(i),
-                result_view.row_begin(i)
-            );
+            auto src_it = src_view.xy_at(0, 0).x_at(-count.x, y - count.y);
+            std::copy(src_it, src_it + dst_view.width(), dst_view.row_begin(y));
         }
     }
+    else if (option == boundary_option::extend_zero || option == boundary_option::extend_constant)
+    {
+        typename SrcView::value_type zero;
+        pixel_zeros_t<typename SrcView::value_type>()(zero);
+        copy_boundary_extended(src_view, count,
+            option == boundary_option::extend_zero ? boundary_mode::constant
+                                                   : boundary_mode::replicate,
+            zero, dst_view);
+    }
     else
     {
         BOOST_ASSERT_MSG(false, "Invalid boundary option");
@@ -352,6 +532,7 @@ void extend_row_impl(
 /// \brief adds new row at top and bottom.
 /// Image padding introduces new pixels around the edges of an image.
 /// The border provides space for annotations or acts as a boundary when using advanced filtering techniques.
+/// boundary_extended_view provides the same pixels without allocating an image.
 /// \tparam SrcView Models ImageViewConcept
 /// \tparam extend_count number of rows to be added each side
 /// \tparam option - TODO
@@ -365,8 +546,8 @@ auto extend_row(
     typename gil::image<typename SrcView::value_type>
         result_img(src_view.width(), src_view.height() + (2 * extend_count));
 
-    auto result_view = view(result_img);
-    detail::extend_row_impl(src_view, result_view, extend_count, option);
+    point_t const count(0, static_cast<std::ptrdiff_t>(extend_count));
+    detail::extend_boundary_impl(src_view, count, option, view(result_img));
     return result_img;
 }
 
@@ -374,6 +555,7 @@ auto extend_row(
 /// \brief adds new column at left and right.
 /// Image padding introduces new pixels around the edges of an image.
 /// The border provides space for annotations or acts as a boundary when using advanced filtering techniques.
+/// boundary_extended_view provides the same pixels without allocating an image.
 /// \tparam SrcView Models ImageViewConcept
 /// \tparam extend_count number of columns to be added each side
 /// \tparam option - TODO
@@ -384,19 +566,18 @@ auto extend_col(
     boundary_option option
 ) -> typename gil::image<typename SrcView::value_type>
 {
-    auto src_view_rotate = rotated90cw_view(src_view);
-
     typename gil::image<typename SrcView::value_type>
         result_img(src_view.width() + (2 * extend_count), src_view.height());
 
-    auto result_view = rotated90cw_view(view(result_img));
-    detail::extend_row_impl(src_view_rotate, result_view, extend_count, option);
+    point_t const count(static_cast<std::ptrdiff_t>(extend_count), 0);
+    detail::extend_boundary_impl(src_view, count, option, view(result_img));
     return result_img;
 }
 
 /// \brief adds new row and column at all sides.
 /// Image padding introduces new pixels around the edges of an image.
 /// The border provides space for annotations or acts as a boundary when using advanced filtering techniques.
+/// boundary_extended_view provides the same pixels without allocating an image.
 /// \tparam SrcView Models ImageViewConcept
 /// \tparam extend_count number of rows/column to be added each side
 /// \tparam option - TODO
@@ -407,34 +588,12 @@ auto extend_boundary(
     boundary_option option
 ) -> typename gil::image<typename SrcView::value_type>
 {
-    if (option == boundary_option::extend_padded)
-    {
-        typename gil::image<typename SrcView::value_type>
-            result_img(src_view.width()+(2 * extend_count), src_view.height()+(2 * extend_count));
-        typename gil::image<typename SrcView::value_type>::view_t result_view = view(result_img);
-
-        auto original_view = subimage_view(
-            src_view,
-            -extend_count,
-            -extend_count,
-            src_view.width() + (2 * extend_count),
-            src_view.height() + (2 * extend_count)
-        );
-
-        for (std::ptrdiff_t i = 0; i < result_view.height(); i++)
-        {
-            assign_pixels(
-                original_view.row_begin(i),
-                original_view.row_end(i),
-                result_view.row_begin(i)
-            );
-        }
-
-        return result_img;
-    }
+    typename gil::image<typename SrcView::value_type> result_img(
+        src_view.width() + (2 * extend_count), src_view.height() + (2 * extend_count));
 
-    auto auxilary_img = extend_col(src_view, extend_count, option);
-    return extend_row(view(auxilary_img), extend_count, option);
+    auto const count = static_cast<std::ptrdiff_t>(extend_count);
+    detail::extend_boundary_impl(src_view, point_t(count, count), option, view(result_img));
+    return result_img;
 }
 
 }} // namespace boost::gil
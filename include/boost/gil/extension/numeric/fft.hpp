@@ -0,0 +1,409 @@
+//
+// Copyright 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#ifndef BOOST_GIL_EXTENSION_NUMERIC_FFT_HPP
+#define BOOST_GIL_EXTENSION_NUMERIC_FFT_HPP
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+namespace boost { namespace gil { namespace detail {
+
+// Self-contained fast Fourier transforms used by FFT-based convolution
+
+/// \brief Returns the smallest even integer not less than n with no prime factors other than 2, 3 and 5
+inline auto fft_good_size(std::size_t n) -> std::size_t
+{
+    if (n <= 2)
+        return 2;
+    for (std::size_t m = n + (n % 2);; m += 2)
+    {
+        std::size_t r = m;
+        for (std::size_t p : {2, 3, 5})
+        {
+            while (r % p == 0)
+                r /= p;
+        }
+        if (r == 1)
+            return m;
+    }
+}
+
+/// \brief Estimated number of floating-point operations of complex FFT of size n
+inline auto fft_flops(std::size_t n) -> double
+{
+    return 5.0 * static_cast<double>(n) * std::log2(static_cast<double>(n));
+}
+
+/// \brief Multiplies complex numbers without the NaN and infinity recovery of std::complex
+template <typename T>
+BOOST_FORCEINLINE
+auto fft_multiply(std::complex<T> const& a, std::complex<T> const& b) -> std::complex<T>
+{
+    return std::complex<T>(
+        a.real() * b.real() - a.imag() * b.imag(),
+        a.real() * b.imag() + a.imag() * b.real());
+}
+
+/// \brief Mixed-radix, decimation-in-time complex FFT of fixed size
+///
+/// The size is factorized into radices 4, 2, 3 and 5, which have dedicated butterflies;
+/// other prime factors are supported by a generic O(p^2) butterfly. Twiddle factors are computed in double precision
+/// once, when the plan is created. Inverse transform is not normalized.
+class fft_plan
+{
+public:
+    using complex_t = std::complex<float>;
+
+    explicit fft_plan(std::size_t n = 1)
+        : n_(n)
+    {
+        BOOST_ASSERT(n > 0);
+        twiddles_.resize(n);
+        double const two_pi = 6.28318530717958647692;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            double const phase = -two_pi * static_cast<double>(i) / static_cast<double>(n);
+            twiddles_[i] = complex_t(
+                static_cast<float>(std::cos(phase)), static_cast<float>(std::sin(phase)));
+        }
+
+        std::size_t m = n;
+        for (std::size_t p : {4, 2, 3, 5})
+        {
+            while (m % p == 0)
+            {
+                m /= p;
+                factors_.push_back(p);
+                factors_.push_back(m);
+            }
+        }
+        for (std::size_t p = 7; m > 1; p += 2)
+        {
+            while (m % p == 0)
+            {
+                m /= p;
+                factors_.push_back(p);
+                factors_.push_back(m);
+            }
+        }
+        if (factors_.empty())
+        {
+            factors_.push_back(1);
+            factors_.push_back(1);
+        }
+    }
+
+    auto size() const -> std::size_t { return n_; }
+
+    /// \brief Forward transform of n values read with given stride into contiguous output
+    void forward(complex_t const* in, std::ptrdiff_t in_stride, complex_t* out) const
+    {
+        if (n_ == 1)
+        {
+            out[0] = in[0];
+            return;
+        }
+        work(out, in, 1, in_stride, factors_.data());
+    }
+
+    /// \brief Inverse, unnormalized transform, computed as conj(forward(conj(x)))
+    void inverse(complex_t* data, std::vector<complex_t>& buffer) const
+    {
+        if (buffer.size() < n_)
+            buffer.resize(n_);
+        for (std::size_t i = 0; i < n_; ++i)
+            buffer[i] = std::conj(data[i]);
+        forward(buffer.data(), 1, data);
+        for (std::size_t i = 0; i < n_; ++i)
+            data[i] = std::conj(data[i]);
+    }
+
+private:
+    void work(
+        complex_t* out,
+        complex_t const* in,
+        std::size_t fstride,
+        std::ptrdiff_t in_stride,
+        std::size_t const* factors) const
+    {
+        std::size_t const p = factors[0];
+        std::size_t const m = factors[1];
+        complex_t* const out_begin = out;
+        complex_t* const out_end = out + p * m;
+        std::ptrdiff_t const step = static_cast<std::ptrdiff_t>(fstride) * in_stride;
+
+        if (m == 1)
+        {
+            for (; out != out_end; ++out, in += step)
+                *out = *in;
+        }
+        else
+        {
+            for (; out != out_end; out += m, in += step)
+                work(out, in, fstride * p, in_stride, factors + 2);
+        }
+
+        switch (p)
+        {
+        case 2: butterfly2(out_begin, fstride, m); break;
+        case 3: butterfly3(out_begin, fstride, m); break;
+        case 4: butterfly4(out_begin, fstride, m); break;
+        case 5: butterfly5(out_begin, fstride, m); break;
+        default: butterfly_generic(out_begin, fstride, m, p); break;
+        }
+    }
+
+    void butterfly2(complex_t* out, std::size_t fstride, std::size_t m) const
+    {
+        complex_t* out2 = out + m;
+        complex_t const* tw = twiddles_.data();
+        for (std::size_t k = 0; k < m; ++k, tw += fstride)
+        {
+            complex_t const t = fft_multiply(out2[k], *tw);
+            out2[k] = out[k] - t;
+            out[k] += t;
+        }
+    }
+
+    void butterfly3(complex_t* out, std::size_t fstride, std::size_t m) const
+    {
+        complex_t const* tw = twiddles_.data();
+        float const sin_third = tw[fstride * m].imag();
+        for (std::size_t k = 0; k < m; ++k)
+        {
+            complex_t const s1 = fft_multiply(out[k + m], tw[k * fstride]);
+            complex_t const s2 = fft_multiply(out[k + 2 * m], tw[2 * k * fstride]);
+            complex_t const s3 = s1 + s2;
+            complex_t const s0 = (s1 - s2) * sin_third;
+            complex_t const t = out[k] - s3 * 0.5f;
+            out[k] += s3;
+            out[k + m] = complex_t(t.real() - s0.imag(), t.imag() + s0.real());
+            out[k + 2 * m] = complex_t(t.real() + s0.imag(), t.imag() - s0.real());
+        }
+    }
+
+    void butterfly4(complex_t* out, std::size_t fstride, std::size_t m) const
+    {
+        complex_t const* tw = twiddles_.data();
+        for (std::size_t k = 0; k < m; ++k)
+        {
+            complex_t const s0 = fft_multiply(out[k + m], tw[k * fstride]);
+            complex_t const s1 = fft_multiply(out[k + 2 * m], tw[2 * k * fstride]);
+            complex_t const s2 = fft_multiply(out[k + 3 * m], tw[3 * k * fstride]);
+            complex_t const s5 = out[k] - s1;
+            complex_t const s6 = out[k] + s1;
+            complex_t const s3 = s0 + s2;
+            complex_t const s4 = s0 - s2;
+            out[k] = s6 + s3;
+            out[k + 2 * m] = s6 - s3;
+            out[k + m] = complex_t(s5.real() + s4.imag(), s5.imag() - s4.real());
+            out[k + 3 * m] = complex_t(s5.real() - s4.imag(), s5.imag() + s4.real());
+        }
+    }
+
+    void butterfly5(complex_t* out, std::size_t fstride, std::size_t m) const
+    {
+        complex_t const* tw = twiddles_.data();
+        complex_t const ya = tw[fstride * m];
+        complex_t const yb = tw[2 * fstride * m];
+        for (std::size_t k = 0; k < m; ++k)
+        {
+            complex_t const s0 = out[k];
+            complex_t const s1 = fft_multiply(out[k + m], tw[k * fstride]);
+            complex_t const s2 = fft_multiply(out[k + 2 * m], tw[2 * k * fstride]);
+            complex_t const s3 = fft_multiply(out[k + 3 * m], tw[3 * k * fstride]);
+            complex_t const s4 = fft_multiply(out[k + 4 * m], tw[4 * k * fstride]);
+            complex_t const s7 = s1 + s4;
+            complex_t const s10 = s1 - s4;
+            complex_t const s8 = s2 + s3;
+            complex_t const s9 = s2 - s3;
+
+            out[k] = s0 + s7 + s8;
+
+            complex_t const s5 = s0 + s7 * ya.real() + s8 * yb.real();
+            complex_t const s6(
+                s10.imag() * ya.imag() + s9.imag() * yb.imag(),
+                -s10.real() * ya.imag() - s9.real() * yb.imag());
+            out[k + m] = s5 - s6;
+            out[k + 4 * m] = s5 + s6;
+
+            complex_t const s11 = s0 + s7 * yb.real() + s8 * ya.real();
+            complex_t const s12(
+                -s10.imag() * yb.imag() + s9.imag() * ya.imag(),
+                s10.real() * yb.imag() - s9.real() * ya.imag());
+            out[k + 2 * m] = s11 + s12;
+            out[k + 3 * m] = s11 - s12;
+        }
+    }
+
+    void butterfly_generic(complex_t* out, std::size_t fstride, std::size_t m, std::size_t p) const
+    {
+        // Sizes picked by fft_good_size never get here
+        complex_t local[8];
+        std::vector<complex_t> heap;
+        complex_t* scratch = local;
+        if (p > 8)
+        {
+            heap.resize(p);
+            scratch = heap.data();
+        }
+        for (std::size_t u = 0; u < m; ++u)
+        {
+            for (std::size_t q = 0, k = u; q < p; ++q, k += m)
+                scratch[q] = out[k];
+
+            for (std::size_t q = 0, k = u; q < p; ++q, k += m)
+            {
+                std::size_t twiddle = 0;
+                complex_t sum = scratch[0];
+                for (std::size_t r = 1; r < p; ++r)
+                {
+                    twiddle += fstride * k;
+                    twiddle %= n_;
+                    sum += fft_multiply(scratch[r], twiddles_[twiddle]);
+                }
+                out[k] = sum;
+            }
+        }
+    }
+
+    std::size_t n_;
+    std::vector<complex_t> twiddles_;
+    std::vector<std::size_t> factors_;
+};
+
+/// \brief 2D FFT of real data of size rows x cols producing half spectrum of rows x (cols / 2 + 1)
+///
+/// Pairs of real rows are transformed as real and imaginary parts of one complex row,
+/// so the row pass costs half of complex 2D transform and columns are transformed
+/// only for non-negative frequencies. Number of rows must be even.
+class fft_real_2d
+{
+public:
+    using complex_t = fft_plan::complex_t;
+
+    fft_real_2d(std::size_t rows, std::size_t cols)
+        : rows_(rows)
+        , cols_(cols)
+        , half_cols_(cols / 2 + 1)
+        , row_plan_(cols)
+        , col_plan_(rows)
+        , line_(std::max(rows, cols))
+        , z_(std::max(rows, cols))
+    {
+        BOOST_ASSERT(rows % 2 == 0);
+    }
+
+    auto rows() const -> std::size_t { return rows_; }
+    auto cols() const -> std::size_t { return cols_; }
+    auto spectrum_cols() const -> std::size_t { return half_cols_; }
+    auto spectrum_size() const -> std::size_t { return rows_ * half_cols_; }
+
+    /// \brief Forward transform of row-major real data into row-major half spectrum
+    void forward(float const* data, complex_t* spectrum) const
+    {
+        for (std::size_t r = 0; r < rows_; r += 2)
+        {
+            float const* row0 = data + r * cols_;
+            float const* row1 = row0 + cols_;
+            for (std::size_t c = 0; c < cols_; ++c)
+                line_[c] = complex_t(row0[c], row1[c]);
+            row_plan_.forward(line_.data(), 1, z_.data());
+
+            complex_t* spec0 = spectrum + r * half_cols_;
+            complex_t* spec1 = spec0 + half_cols_;
+            for (std::size_t k = 0; k < half_cols_; ++k)
+            {
+                complex_t const zk = z_[k];
+                complex_t const zc = std::conj(z_[(cols_ - k) % cols_]);
+                spec0[k] = 0.5f * (zk + zc);
+                complex_t const d = zk - zc;
+                spec1[k] = complex_t(0.5f * d.imag(), -0.5f * d.real());
+            }
+        }
+        transform_columns(spectrum, false);
+    }
+
+    /// \brief Inverse, unnormalized transform of half spectrum into row-major real data
+    ///
+    /// The spectrum is used as working storage and is overwritten.
+    void inverse(complex_t* spectrum, float* data) const
+    {
+        transform_columns(spectrum, true);
+
+        for (std::size_t r = 0; r < rows_; r += 2)
+        {
+            complex_t const* spec0 = spectrum + r * half_cols_;
+            complex_t const* spec1 = spec0 + half_cols_;
+            for (std::size_t k = 0; k < cols_; ++k)
+            {
+                complex_t a, b;
+                if (k < half_cols_)
+                {
+                    a = spec0[k];
+                    b = spec1[k];
+                }
+                else
+                {
+                    a = std::conj(spec0[cols_ - k]);
+                    b = std::conj(spec1[cols_ - k]);
+                }
+                // z = a + i * b
+                z_[k] = complex_t(a.real() - b.imag(), a.imag() + b.real());
+            }
+            row_plan_.inverse(z_.data(), line_);
+
+            float* row0 = data + r * cols_;
+            float* row1 = row0 + cols_;
+            for (std::size_t c = 0; c < cols_; ++c)
+            {
+                row0[c] = z_[c].real();
+                row1[c] = z_[c].imag();
+            }
+        }
+    }
+
+private:
+    void transform_columns(complex_t* spectrum, bool inverse) const
+    {
+        for (std::size_t k = 0; k < half_cols_; ++k)
+        {
+            if (inverse)
+            {
+                for (std::size_t r = 0; r < rows_; ++r)
+                    z_[r] = spectrum[r * half_cols_ + k];
+                col_plan_.inverse(z_.data(), line_);
+            }
+            else
+            {
+                col_plan_.forward(spectrum + k, static_cast<std::ptrdiff_t>(half_cols_), z_.data());
+            }
+            for (std::size_t r = 0; r < rows_; ++r)
+                spectrum[r * half_cols_ + k] = z_[r];
+        }
+    }
+
+    std::size_t rows_;
+    std::size_t cols_;
+    std::size_t half_cols_;
+    fft_plan row_plan_;
+    fft_plan col_plan_;
+    // Working storage reused between transforms, so an instance must not be shared by threads
+    mutable std::vector<complex_t> line_;
+    mutable std::vector<complex_t> z_;
+};
+
+}}} // namespace boost::gil::detail
+
+#endif
@@ -9,15 +9,29 @@
 #define BOOST_GIL_EXTENSION_NUMERIC_RESAMPLE_HPP
 
 #include <boost/gil/extension/numeric/affine.hpp>
+#include <boost/gil/extension/numeric/sampler.hpp>
 #include <boost/gil/extension/dynamic_image/dynamic_image_all.hpp>
+#include <boost/gil/execution.hpp>
+#include <boost/gil/image_view_factory.hpp>
+
+#include <boost/config.hpp>
 
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace boost { namespace gil {
 
 // Support for generic image resampling
-// NOTE: The code is for example use only. It is not optimized for performance
+// NOTE: The code is for example use only. It is not optimized for performance, except for
+// affine and projective mappings of 8-bit views with nearest-neighbor and bilinear samplers
 
 ///////////////////////////////////////////////////////////////////////////
 ////
@@ -27,15 +41,11 @@ namespace boost { namespace gil {
 
 template <typename MapFn> struct mapping_traits {};
 
-/// \brief Set each pixel in the destination view as the result of a sampling function over the transformed coordinates of the source view
-/// \ingroup ImageAlgorithms
-///
-/// The provided implementation works for 2D image views only
-template <typename Sampler,        // Models SamplerConcept
-          typename SrcView,        // Models RandomAccess2DImageViewConcept
-          typename DstView,        // Models MutableRandomAccess2DImageViewConcept
-          typename MapFn>        // Models MappingFunctionConcept
-void resample_pixels(const SrcView& src_view, const DstView& dst_view, const MapFn& dst_to_src, Sampler sampler=Sampler())
+namespace detail {
+
+template <typename Sampler, typename SrcView, typename DstView, typename MapFn>
+void resample_pixels_generic(
+    const SrcView& src_view, const DstView& dst_view, const MapFn& dst_to_src, Sampler sampler)
 {
     typename DstView::point_t dst_dims=dst_view.dimensions();
     typename DstView::point_t dst_p;
@@ -48,6 +58,677 @@ void resample_pixels(const SrcView& src_view, const DstView& dst_view, const Map
     }
 }
 
+template <typename Sampler, typename SrcView, typename DstView, typename MapFn>
+void resample_pixels_impl(
+    const SrcView& src_view, const DstView& dst_view, const MapFn& dst_to_src, Sampler sampler)
+{
+    resample_pixels_generic(src_view, dst_view, dst_to_src, sampler);
+}
+
+/// \brief Whether view is laid out in memory as 8-bit samples, interleaved or planar
+template <typename View>
+struct is_raw_8bit_view : std::integral_constant<bool,
+    view_is_basic<View>::value &&
+    std::is_same<typename channel_type<View>::type, std::uint8_t>::value &&
+    (is_planar<View>::value || std::is_pointer<typename View::x_iterator>::value)> {};
+
+/// \brief Whether resample_pixels takes the fixed-point path of affine mapping
+template <typename Sampler, typename SrcView, typename DstView, typename F>
+struct is_affine_fast_path : std::integral_constant<bool,
+    (std::is_same<Sampler, nearest_neighbor_sampler>::value ||
+        std::is_same<Sampler, bilinear_sampler>::value) &&
+    std::is_floating_point<F>::value &&
+    is_raw_8bit_view<SrcView>::value && is_raw_8bit_view<DstView>::value &&
+    std::is_same<typename SrcView::value_type, typename DstView::value_type>::value> {};
+
+/// \brief Pointers to first sample of every channel of 8-bit view, with distance in samples
+/// between neighbouring rows, the same for interleaved and planar views
+template <typename Sample, std::size_t Channels>
+struct sample_planes
+{
+    Sample* base[Channels];
+    std::ptrdiff_t row_step;
+};
+
+template <typename View>
+auto make_sample_planes(const View& view, std::true_type /* planar */)
+    -> sample_planes<typename std::remove_pointer<
+        typename channel_pointer_type<View>::type>::type, num_channels<View>::value>
+{
+    sample_planes<typename std::remove_pointer<typename channel_pointer_type<View>::type>::type,
+        num_channels<View>::value> planes;
+    for (std::size_t c = 0; c < num_channels<View>::value; ++c)
+        planes.base[c] = planar_view_get_raw_data(view, static_cast<int>(c));
+    planes.row_step = static_cast<std::ptrdiff_t>(view.pixels().row_size());
+    return planes;
+}
+
+template <typename View>
+auto make_sample_planes(const View& view, std::false_type /* interleaved */)
+    -> sample_planes<typename std::remove_pointer<
+        typename channel_pointer_type<View>::type>::type, num_channels<View>::value>
+{
+    sample_planes<typename std::remove_pointer<typename channel_pointer_type<View>::type>::type,
+        num_channels<View>::value> planes;
+    auto const data = interleaved_view_get_raw_data(view);
+    for (std::size_t c = 0; c < num_channels<View>::value; ++c)
+        planes.base[c] = data + c;
+    planes.row_step = static_cast<std::ptrdiff_t>(view.pixels().row_size());
+    return planes;
+}
+
+/// \brief Range [begin, end) of x in [0, n) for which lower <= start + x * step < upper
+inline auto fixed_point_span(
+    std::int64_t start, std::int64_t step, std::int64_t lower, std::int64_t upper,
+    std::ptrdiff_t n) -> std::pair<std::ptrdiff_t, std::ptrdiff_t>
+{
+    // Smallest x with start + x * step >= bound, for positive step
+    auto const first_at_least = [](std::int64_t from, std::int64_t by, std::int64_t bound) {
+        std::int64_t const distance = bound - from;
+        return distance <= 0 ? std::int64_t(0) : (distance + by - 1) / by;
+    };
+
+    std::int64_t begin = 0;
+    std::int64_t end = n;
+    if (step == 0)
+    {
+        if (start < lower || start >= upper)
+            end = 0;
+    }
+    else if (step > 0)
+    {
+        begin = first_at_least(start, step, lower);
+        end = (std::min)(end, first_at_least(start, step, upper));
+    }
+    else
+    {
+        // Mirrored, -(start + x * step) > -upper and -(start + x * step) <= -lower
+        begin = first_at_least(-start, -step, 1 - upper);
+        end = (std::min)(end, first_at_least(-start, -step, 1 - lower));
+    }
+    begin = (std::min)(begin, std::int64_t(n));
+    end = (std::max)(begin, end);
+    return {static_cast<std::ptrdiff_t>(begin), static_cast<std::ptrdiff_t>(end)};
+}
+
+/// \brief Fractional bits of weights of bilinear sampling
+constexpr int affine_fraction_bits = 16;
+
+/// \brief Fractional bits of source coordinates stepped along a row, so the error of the
+/// rounded step accumulated along any row stays far below the resolution of weights
+constexpr int affine_coordinate_bits = 32;
+
+/// \brief Offsets of sampled pixels and fractions of 32.32 fixed-point coordinates
+/// stepped along a row, in code the compiler vectorizes
+///
+/// Coordinates are rounded down for bilinear sampling, to nearest for nearest-neighbor one,
+/// and must not be negative once rounded. Fractions are truncated to affine_fraction_bits.
+BOOST_FORCEINLINE
+void affine_row_samples(
+    std::int64_t x,
+    std::int64_t y,
+    std::int64_t step_x,
+    std::int64_t step_y,
+    std::int64_t rounding,
+    std::ptrdiff_t pixel_step,
+    std::ptrdiff_t row_step,
+    std::int32_t* BOOST_RESTRICT offsets,
+    std::int32_t* BOOST_RESTRICT fractions_x,
+    std::int32_t* BOOST_RESTRICT fractions_y,
+    std::ptrdiff_t n)
+{
+    constexpr int fraction_shift = affine_coordinate_bits - affine_fraction_bits;
+    constexpr std::uint64_t fraction_mask = (std::uint64_t(1) << affine_fraction_bits) - 1;
+    auto const pixel = static_cast<std::int32_t>(pixel_step);
+    auto const row = static_cast<std::int32_t>(row_step);
+    for (std::ptrdiff_t i = 0; i < n; ++i)
+    {
+        auto const sx = static_cast<std::uint64_t>(x + i * step_x + rounding);
+        auto const sy = static_cast<std::uint64_t>(y + i * step_y + rounding);
+        offsets[i] = static_cast<std::int32_t>(sy >> affine_coordinate_bits) * row +
+            static_cast<std::int32_t>(sx >> affine_coordinate_bits) * pixel;
+        fractions_x[i] = static_cast<std::int32_t>((sx >> fraction_shift) & fraction_mask);
+        fractions_y[i] = static_cast<std::int32_t>((sy >> fraction_shift) & fraction_mask);
+    }
+}
+
+/// \brief Nearest-neighbor samples of row, at compile-time distances between pixels
+///
+/// Everything is loaded before stores of samples, which may alias anything.
+template <std::ptrdiff_t SrcStep, std::ptrdiff_t DstStep, typename Sample, std::size_t Channels>
+void sample_row(
+    nearest_neighbor_sampler,
+    sample_planes<Sample const, Channels> const& src,
+    std::int32_t const* offsets,
+    std::int32_t const*,
+    std::int32_t const*,
+    sample_planes<Sample, Channels> const& dst,
+    std::ptrdiff_t dst_offset,
+    std::ptrdiff_t n)
+{
+    Sample const* src_base[Channels];
+    Sample* dst_base[Channels];
+    for (std::size_t c = 0; c < Channels; ++c)
+    {
+        src_base[c] = src.base[c];
+        dst_base[c] = dst.base[c] + dst_offset;
+    }
+    for (std::ptrdiff_t i = 0; i < n; ++i)
+    {
+        std::int32_t const offset = offsets[i];
+        Sample values[Channels];
+        for (std::size_t c = 0; c < Channels; ++c)
+            values[c] = src_base[c][offset];
+        for (std::size_t c = 0; c < Channels; ++c)
+            dst_base[c][i * DstStep] = values[c];
+    }
+}
+
+/// \brief Bilinear samples of row with 16-bit weights, truncated as by bilinear_sampler
+template <std::ptrdiff_t SrcStep, std::ptrdiff_t DstStep, typename Sample, std::size_t Channels>
+void sample_row(
+    bilinear_sampler,
+    sample_planes<Sample const, Channels> const& src,
+    std::int32_t const* offsets,
+    std::int32_t const* fractions_x,
+    std::int32_t const* fractions_y,
+    sample_planes<Sample, Channels> const& dst,
+    std::ptrdiff_t dst_offset,
+    std::ptrdiff_t n)
+{
+    constexpr std::int32_t one = std::int32_t(1) << affine_fraction_bits;
+    std::ptrdiff_t const below = src.row_step;
+    Sample const* src_base[Channels];
+    Sample* dst_base[Channels];
+    for (std::size_t c = 0; c < Channels; ++c)
+    {
+        src_base[c] = src.base[c];
+        dst_base[c] = dst.base[c] + dst_offset;
+    }
+    for (std::ptrdiff_t i = 0; i < n; ++i)
+    {
+        std::int32_t const offset = offsets[i];
+        std::int32_t const fx = fractions_x[i];
+        std::int64_t const fy = fractions_y[i];
+        Sample values[Channels];
+        for (std::size_t c = 0; c < Channels; ++c)
+        {
+            Sample const* s = src_base[c] + offset;
+            std::int64_t const top = s[0] * (one - fx) + s[SrcStep] * fx;
+            std::int64_t const bottom = s[below] * (one - fx) + s[below + SrcStep] * fx;
+            values[c] = static_cast<Sample>(
+                (top * (one - fy) + bottom * fy) >> (2 * affine_fraction_bits));
+        }
+        for (std::size_t c = 0; c < Channels; ++c)
+            dst_base[c][i * DstStep] = values[c];
+    }
+}
+
+/// \brief Source row interpolated horizontally at samples of a row with 16-bit fractions,
+/// kept with 8 fractional bits, channels interleaved
+template <std::ptrdiff_t SrcStep, typename Sample, std::size_t Channels>
+void interpolate_row(
+    sample_planes<Sample const, Channels> const& src,
+    std::ptrdiff_t row,
+    std::int32_t const* offsets,
+    std::int32_t const* fractions_x,
+    std::uint32_t* interpolated,
+    std::ptrdiff_t n)
+{
+    constexpr std::uint32_t one = std::uint32_t(1) << affine_fraction_bits;
+    Sample const* src_base[Channels];
+    for (std::size_t c = 0; c < Channels; ++c)
+        src_base[c] = src.base[c] + row * src.row_step;
+    for (std::ptrdiff_t i = 0; i < n; ++i)
+    {
+        auto const fx = static_cast<std::uint32_t>(fractions_x[i]);
+        for (std::size_t c = 0; c < Channels; ++c)
+        {
+            Sample const* s = src_base[c] + offsets[i];
+            interpolated[static_cast<std::size_t>(i) * Channels + c] =
+                (s[0] * (one - fx) + s[SrcStep] * fx) >> 8;
+        }
+    }
+}
+
+/// \brief Blends interpolated rows by 16-bit fraction, truncated, in code the compiler
+/// vectorizes
+template <typename Sample>
+BOOST_FORCEINLINE
+void blend_interpolated_rows(
+    std::uint32_t const* BOOST_RESTRICT top,
+    std::uint32_t const* BOOST_RESTRICT bottom,
+    std::uint32_t fraction_y,
+    Sample* BOOST_RESTRICT blended,
+    std::ptrdiff_t n)
+{
+    constexpr std::uint32_t one = std::uint32_t(1) << affine_fraction_bits;
+    for (std::ptrdiff_t i = 0; i < n; ++i)
+    {
+        blended[i] = static_cast<Sample>(
+            (top[i] * (one - fraction_y) + bottom[i] * fraction_y) >> (affine_fraction_bits + 8));
+    }
+}
+
+/// \brief Affine resampling of 8-bit views, with source coordinates stepped incrementally
+/// in 32.32 fixed-point along every destination row
+///
+/// Nearest-neighbor samples differ from those of the generic algorithm only for coordinates
+/// within 2^-32 times the row width of halfway between pixels. Bilinear samples are
+/// weighted with 16-bit fractions, which makes them differ by one at most.
+///
+/// Only the span of a row whose samples are all inside the source is processed by the
+/// unchecked kernel, pixels before and after it are sampled as by the generic algorithm.
+template <typename Sampler, typename SrcView, typename DstView, typename F>
+auto resample_pixels_impl(
+    const SrcView& src_view, const DstView& dst_view, const matrix3x2<F>& dst_to_src,
+    Sampler sampler)
+    -> typename std::enable_if<is_affine_fast_path<Sampler, SrcView, DstView, F>::value>::type
+{
+    std::ptrdiff_t const width = dst_view.width();
+    std::ptrdiff_t const src_width = src_view.width();
+    std::ptrdiff_t const src_height = src_view.height();
+    if (width == 0 || dst_view.height() == 0 || src_width == 0 || src_height == 0)
+        return;
+    auto const src = make_sample_planes(src_view, is_planar<SrcView>{});
+    auto const dst = make_sample_planes(dst_view, is_planar<DstView>{});
+    // Offsets of samples must fit into 32 bits
+    if (static_cast<std::int64_t>(src_height) * src.row_step >= (std::int64_t(1) << 31))
+    {
+        resample_pixels_generic(src_view, dst_view, dst_to_src, sampler);
+        return;
+    }
+
+    constexpr bool bilinear = std::is_same<Sampler, bilinear_sampler>::value;
+    constexpr std::int64_t one = std::int64_t(1) << affine_coordinate_bits;
+    constexpr std::int64_t rounding = bilinear ? 0 : one / 2;
+
+    // Bilinear sampling reads the pixel to the right and below, nearest-neighbor rounds
+    // half away from zero as iround
+    std::int64_t const lower = bilinear ? 0 : 1 - rounding;
+    std::int64_t const upper_x = (bilinear ? src_width - 1 : src_width) * one - rounding;
+    std::int64_t const upper_y = (bilinear ? src_height - 1 : src_height) * one - rounding;
+    auto const step_x = static_cast<std::int64_t>(std::llround(dst_to_src.a * one));
+    auto const step_y = static_cast<std::int64_t>(std::llround(dst_to_src.b * one));
+
+    // Pixels outside of the range a sampler may write to are left unchanged, with margin
+    // for rounding of fixed-point steps accumulated along the row
+    std::int64_t const margin = width / 2 + 2;
+    std::int64_t const touched_lower = (bilinear ? -one : lower) - margin;
+    std::int64_t const touched_x = (bilinear ? src_width * one : upper_x) + margin;
+    std::int64_t const touched_y = (bilinear ? src_height * one : upper_y) + margin;
+
+    constexpr std::ptrdiff_t src_step =
+        is_planar<SrcView>::value ? 1 : static_cast<std::ptrdiff_t>(num_channels<SrcView>::value);
+    constexpr std::ptrdiff_t dst_step =
+        is_planar<DstView>::value ? 1 : static_cast<std::ptrdiff_t>(num_channels<DstView>::value);
+
+    std::vector<std::int32_t> offsets(static_cast<std::size_t>(width));
+    std::vector<std::int32_t> fractions_x(static_cast<std::size_t>(width));
+    std::vector<std::int32_t> fractions_y(static_cast<std::size_t>(width));
+
+    // Bilinear sampling of mapping which does not mix axes, like scaling, is separable. Source
+    // rows are interpolated horizontally once, then blended vertically for every destination
+    // row mapped between them.
+    constexpr std::size_t channels = num_channels<SrcView>::value;
+    bool const separable = bilinear &&
+        std::fpclassify(dst_to_src.b) == FP_ZERO && std::fpclassify(dst_to_src.c) == FP_ZERO;
+    std::ptrdiff_t interpolated_samples = 0;
+    std::ptrdiff_t cached_rows[2] = {-1, -1};
+    std::vector<std::uint32_t> interpolated[2];
+    std::vector<typename channel_type<DstView>::type> blended;
+    if (separable)
+    {
+        interpolated[0].resize(static_cast<std::size_t>(width) * channels);
+        interpolated[1].resize(static_cast<std::size_t>(width) * channels);
+        blended.resize(static_cast<std::size_t>(width) * channels);
+    }
+    auto const intersect = [](std::pair<std::ptrdiff_t, std::ptrdiff_t> const& lhs,
+                              std::pair<std::ptrdiff_t, std::ptrdiff_t> const& rhs) {
+        std::ptrdiff_t const begin = (std::max)(lhs.first, rhs.first);
+        return std::make_pair(begin, (std::max)(begin, (std::min)(lhs.second, rhs.second)));
+    };
+    typename DstView::point_t dst_p;
+    for (dst_p.y = 0; dst_p.y < dst_view.height(); ++dst_p.y)
+    {
+        dst_p.x = 0;
+        auto const row_start = transform(dst_to_src, dst_p);
+        auto const start_x = static_cast<std::int64_t>(std::llround(row_start.x * one));
+        auto const start_y = static_cast<std::int64_t>(std::llround(row_start.y * one));
+        auto const inside = intersect(
+            fixed_point_span(start_x, step_x, lower, upper_x, width),
+            fixed_point_span(start_y, step_y, lower, upper_y, width));
+        auto const touched = intersect(
+            fixed_point_span(start_x, step_x, touched_lower, touched_x, width),
+            fixed_point_span(start_y, step_y, touched_lower, touched_y, width));
+
+        typename DstView::x_iterator xit = dst_view.row_begin(dst_p.y);
+        std::ptrdiff_t const left_end = (std::min)(inside.first, touched.second);
+        std::ptrdiff_t const right_begin = (std::max)(inside.second, touched.first);
+        for (dst_p.x = touched.first; dst_p.x < left_end; ++dst_p.x)
+            sample(sampler, src_view, transform(dst_to_src, dst_p), xit[dst_p.x]);
+        for (dst_p.x = right_begin; dst_p.x < touched.second; ++dst_p.x)
+            sample(sampler, src_view, transform(dst_to_src, dst_p), xit[dst_p.x]);
+
+        std::ptrdiff_t const begin = inside.first;
+        std::ptrdiff_t const n = inside.second - inside.first;
+        if (n == 0)
+            continue;
+        if (separable)
+        {
+            // Samples along x are the same for all rows, interpolated source rows are cached
+            if (interpolated_samples != n)
+            {
+                affine_row_samples(start_x + begin * step_x, 0, step_x, 0, 0, src_step, 0,
+                    offsets.data(), fractions_x.data(), fractions_y.data(), n);
+                interpolated_samples = n;
+            }
+            auto const row = static_cast<std::ptrdiff_t>(start_y >> affine_coordinate_bits);
+            for (std::ptrdiff_t r = row; r <= row + 1; ++r)
+            {
+                std::size_t const slot = static_cast<std::size_t>(r & 1);
+                if (cached_rows[slot] != r)
+                {
+                    interpolate_row<src_step>(src, r, offsets.data(), fractions_x.data(),
+                        interpolated[slot].data(), n);
+                    cached_rows[slot] = r;
+                }
+            }
+
+            // Interleaved destination has layout of blended samples, planar one is filled after
+            std::ptrdiff_t const dst_offset = dst_p.y * dst.row_step + begin * dst_step;
+            auto* out = is_planar<DstView>::value ? blended.data() : dst.base[0] + dst_offset;
+            std::ptrdiff_t const samples = n * static_cast<std::ptrdiff_t>(channels);
+            auto const fraction_y = static_cast<std::uint32_t>(
+                (start_y & (one - 1)) >> (affine_coordinate_bits - affine_fraction_bits));
+            std::uint32_t const* top = interpolated[row & 1].data();
+            std::uint32_t const* bottom = interpolated[(row + 1) & 1].data();
+            for_each_chunk(samples, [&](std::ptrdiff_t i, std::ptrdiff_t m) {
+                blend_interpolated_rows(top + i, bottom + i, fraction_y, out + i, m);
+            });
+
+            if (is_planar<DstView>::value)
+            {
+                for (std::size_t c = 0; c < channels; ++c)
+                {
+                    auto* d = dst.base[c] + dst_offset;
+                    for (std::ptrdiff_t k = 0; k < n; ++k)
+                        d[k] = blended[static_cast<std::size_t>(k) * channels + c];
+                }
+            }
+            continue;
+        }
+        affine_row_samples(
+            start_x + begin * step_x, start_y + begin * step_y, step_x, step_y, rounding,
+            src_step, src.row_step,
+            offsets.data(), fractions_x.data(), fractions_y.data(), n);
+        sample_row<src_step, dst_step>(sampler, src,
+            offsets.data(), fractions_x.data(), fractions_y.data(), dst,
+            dst_p.y * dst.row_step + begin * dst_step, n);
+    }
+}
+
+/// \brief Side of square tiles of destination resampled by projective mapping, so source
+/// pixels read by rows of a tile stay in cache
+constexpr std::ptrdiff_t projective_tile_size = 64;
+
+/// \brief Source coordinates of n pixels along destination row, with homography terms
+/// stepped incrementally and one division per pixel, in code the compiler vectorizes
+template <typename F>
+BOOST_FORCEINLINE
+void projective_row_coordinates(
+    F x, F y, F z, F step_x, F step_y, F step_z,
+    F* BOOST_RESTRICT xs, F* BOOST_RESTRICT ys, std::ptrdiff_t n)
+{
+    for (std::int32_t i = 0; i < static_cast<std::int32_t>(n); ++i)
+    {
+        F const k = static_cast<F>(i);
+        F const reciprocal = F(1) / (z + k * step_z);
+        xs[i] = (x + k * step_x) * reciprocal;
+        ys[i] = (y + k * step_y) * reciprocal;
+    }
+}
+
+/// \brief Samples source at coordinates of row segment with the sampler, skipping those
+/// which are not finite
+template <typename Sampler, typename SrcView, typename DstView, typename F>
+void projective_row_samples(
+    Sampler sampler, const SrcView& src_view, const DstView& dst_view,
+    typename DstView::point_t const& dst_p, F const* xs, F const* ys, std::ptrdiff_t n)
+{
+    typename DstView::x_iterator xit = dst_view.row_begin(dst_p.y) + dst_p.x;
+    for (std::ptrdiff_t i = 0; i < n; ++i)
+    {
+        if (std::isfinite(xs[i]) && std::isfinite(ys[i]))
+            sample(sampler, src_view, point<F>(xs[i], ys[i]), xit[i]);
+    }
+}
+
+/// \brief Resampling of row segment of 8-bit views, samples inside the source taken by
+/// the fixed-point kernels of the affine fast path
+template <typename Sampler, typename SrcView, typename DstView, typename F>
+class projective_fixed_point_rows
+{
+public:
+    projective_fixed_point_rows(const SrcView& src_view, const DstView& dst_view)
+        : src_(make_sample_planes(src_view, is_planar<SrcView>{}))
+        , dst_(make_sample_planes(dst_view, is_planar<DstView>{}))
+        , upper_x_(static_cast<std::int32_t>(
+            (bilinear ? src_view.width() - 1 : src_view.width()) * one - rounding))
+        , upper_y_(static_cast<std::int32_t>(
+            (bilinear ? src_view.height() - 1 : src_view.height()) * one - rounding))
+    {}
+
+    void operator()(
+        Sampler sampler, const SrcView& src_view, const DstView& dst_view,
+        typename DstView::point_t const& dst_p, F const* xs, F const* ys, std::ptrdiff_t n)
+    {
+        std::ptrdiff_t const dst_offset = dst_p.y * dst_.row_step + dst_p.x * dst_step;
+        if (fixed_point_samples(xs, ys, n) == n)
+        {
+            sample_row<src_step, dst_step>(sampler, src_,
+                offsets_, fractions_x_, fractions_y_, dst_, dst_offset, n);
+            return;
+        }
+
+        for (std::ptrdiff_t begin = 0; begin < n;)
+        {
+            std::ptrdiff_t end = begin + 1;
+            while (end < n && inside_[end] == inside_[begin])
+                ++end;
+            if (inside_[begin])
+            {
+                sample_row<src_step, dst_step>(sampler, src_,
+                    offsets_ + begin, fractions_x_ + begin, fractions_y_ + begin, dst_,
+                    dst_offset + begin * dst_step, end - begin);
+            }
+            else
+            {
+                typename DstView::point_t const p(dst_p.x + begin, dst_p.y);
+                projective_row_samples(
+                    sampler, src_view, dst_view, p, xs + begin, ys + begin, end - begin);
+            }
+            begin = end;
+        }
+    }
+
+private:
+    /// \brief Offsets and fractions of samples, meaningful for those inside only, computed
+    /// without branches, returns number of samples inside
+    BOOST_FORCEINLINE
+    auto fixed_point_samples(F const* BOOST_RESTRICT xs, F const* BOOST_RESTRICT ys,
+        std::ptrdiff_t n) -> std::ptrdiff_t
+    {
+        // Bilinear sampling reads the pixel to the right and below, nearest-neighbor rounds
+        // half away from zero as iround
+        constexpr std::int32_t lower = bilinear ? 0 : 1 - rounding;
+        auto const range_x = static_cast<std::uint32_t>(upper_x_ - lower);
+        auto const range_y = static_cast<std::uint32_t>(upper_y_ - lower);
+        // Coordinates clamped to [-one, upper] are truncated as rounded down when biased by one
+        auto const max_x = static_cast<F>(upper_x_ + one_32);
+        auto const max_y = static_cast<F>(upper_y_ + one_32);
+        auto const row_step = static_cast<std::int32_t>(src_.row_step);
+        std::int32_t* BOOST_RESTRICT inside = inside_;
+        std::int32_t* BOOST_RESTRICT offsets = offsets_;
+        std::int32_t* BOOST_RESTRICT fractions_x = fractions_x_;
+        std::int32_t* BOOST_RESTRICT fractions_y = fractions_y_;
+        for (std::ptrdiff_t i = 0; i < n; ++i)
+        {
+            F x = xs[i] * static_cast<F>(one) + static_cast<F>(one);
+            F y = ys[i] * static_cast<F>(one) + static_cast<F>(one);
+            x = x > F(0) ? x : F(0);
+            x = x < max_x ? x : max_x;
+            y = y > F(0) ? y : F(0);
+            y = y < max_y ? y : max_y;
+            std::int32_t const tx = static_cast<std::int32_t>(x) - one_32;
+            std::int32_t const ty = static_cast<std::int32_t>(y) - one_32;
+            inside[i] = static_cast<std::int32_t>(
+                static_cast<std::uint32_t>(tx - lower) < range_x) &
+                static_cast<std::int32_t>(static_cast<std::uint32_t>(ty - lower) < range_y);
+            std::int32_t const sx = tx + rounding;
+            std::int32_t const sy = ty + rounding;
+            offsets[i] = (sy >> affine_fraction_bits) * row_step
+                + (sx >> affine_fraction_bits) * static_cast<std::int32_t>(src_step);
+            fractions_x[i] = sx & (one_32 - 1);
+            fractions_y[i] = sy & (one_32 - 1);
+        }
+        std::int32_t count = 0;
+        for (std::ptrdiff_t i = 0; i < n; ++i)
+            count += inside[i];
+        return count;
+    }
+
+    static constexpr bool bilinear = std::is_same<Sampler, bilinear_sampler>::value;
+    static constexpr std::int64_t one = std::int64_t(1) << affine_fraction_bits;
+    static constexpr std::int32_t one_32 = std::int32_t(1) << affine_fraction_bits;
+    static constexpr std::int32_t rounding = bilinear ? 0 : one_32 / 2;
+    static constexpr std::ptrdiff_t src_step =
+        is_planar<SrcView>::value ? 1 : static_cast<std::ptrdiff_t>(num_channels<SrcView>::value);
+    static constexpr std::ptrdiff_t dst_step =
+        is_planar<DstView>::value ? 1 : static_cast<std::ptrdiff_t>(num_channels<DstView>::value);
+
+    decltype(make_sample_planes(std::declval<SrcView>(), is_planar<SrcView>{})) src_;
+    decltype(make_sample_planes(std::declval<DstView>(), is_planar<DstView>{})) dst_;
+    std::int32_t upper_x_;
+    std::int32_t upper_y_;
+    std::int32_t inside_[projective_tile_size];
+    std::int32_t offsets_[projective_tile_size];
+    std::int32_t fractions_x_[projective_tile_size];
+    std::int32_t fractions_y_[projective_tile_size];
+};
+
+/// \brief Resampling of row segment by sampler, for all other views and samplers
+template <typename Sampler, typename SrcView, typename DstView, typename F>
+struct projective_generic_rows
+{
+    projective_generic_rows(const SrcView&, const DstView&) {}
+
+    void operator()(
+        Sampler sampler, const SrcView& src_view, const DstView& dst_view,
+        typename DstView::point_t const& dst_p, F const* xs, F const* ys, std::ptrdiff_t n)
+    {
+        projective_row_samples(sampler, src_view, dst_view, dst_p, xs, ys, n);
+    }
+};
+
+/// \brief Resamples rows [y_begin, y_end) of destination in tiles, with source coordinates
+/// of every row segment evaluated incrementally
+template <typename Sampler, typename SrcView, typename DstView, typename F>
+void resample_projective_rows(
+    const SrcView& src_view, const DstView& dst_view, const matrix3x3<F>& dst_to_src,
+    Sampler sampler, std::ptrdiff_t y_begin, std::ptrdiff_t y_end)
+{
+    // Fixed-point source coordinates must fit into 32 bits
+    std::ptrdiff_t const max_size = std::ptrdiff_t(1) << (30 - affine_fraction_bits);
+    bool const fixed_point = is_affine_fast_path<Sampler, SrcView, DstView, F>::value &&
+        src_view.width() < max_size && src_view.height() < max_size;
+    using fixed_point_rows = typename std::conditional<
+        is_affine_fast_path<Sampler, SrcView, DstView, F>::value,
+        projective_fixed_point_rows<Sampler, SrcView, DstView, F>,
+        projective_generic_rows<Sampler, SrcView, DstView, F>>::type;
+    fixed_point_rows fixed_point_segment(src_view, dst_view);
+    projective_generic_rows<Sampler, SrcView, DstView, F> generic_segment(src_view, dst_view);
+
+    F xs[projective_tile_size];
+    F ys[projective_tile_size];
+    std::ptrdiff_t const width = dst_view.width();
+    for (std::ptrdiff_t tile_y = y_begin; tile_y < y_end; tile_y += projective_tile_size)
+    {
+        std::ptrdiff_t const tile_end = (std::min)(tile_y + projective_tile_size, y_end);
+        for (std::ptrdiff_t tile_x = 0; tile_x < width; tile_x += projective_tile_size)
+        {
+            std::ptrdiff_t const n = (std::min)(projective_tile_size, width - tile_x);
+            typename DstView::point_t dst_p(tile_x, tile_y);
+            for (; dst_p.y < tile_end; ++dst_p.y)
+            {
+                auto const x = static_cast<F>(dst_p.x);
+                auto const y = static_cast<F>(dst_p.y);
+                projective_row_coordinates(
+                    dst_to_src.a * x + dst_to_src.c * y + dst_to_src.e,
+                    dst_to_src.b * x + dst_to_src.d * y + dst_to_src.f,
+                    dst_to_src.u * x + dst_to_src.v * y + dst_to_src.w,
+                    dst_to_src.a, dst_to_src.b, dst_to_src.u, xs, ys, n);
+                if (fixed_point)
+                    fixed_point_segment(sampler, src_view, dst_view, dst_p, xs, ys, n);
+                else
+                    generic_segment(sampler, src_view, dst_view, dst_p, xs, ys, n);
+            }
+        }
+    }
+}
+
+template <typename Sampler, typename SrcView, typename DstView, typename F>
+void resample_pixels_impl(
+    const SrcView& src_view, const DstView& dst_view, const matrix3x3<F>& dst_to_src,
+    Sampler sampler)
+{
+    resample_projective_rows(src_view, dst_view, dst_to_src, sampler, 0, dst_view.height());
+}
+
+} // namespace detail
+
+/// \brief Set each pixel in the destination view as the result of a sampling function over the transformed coordinates of the source view
+/// \ingroup ImageAlgorithms
+///
+/// The provided implementation works for 2D image views only. Affine mapping by matrix3x2
+/// of 8-bit interleaved or planar views of the same pixel type, with nearest-neighbor or
+/// bilinear sampler, steps source coordinates incrementally in fixed-point arithmetic. Pixels
+/// sampled completely inside the source are computed without bound checks, others as by
+/// the generic algorithm.
+template <typename Sampler,        // Models SamplerConcept
+          typename SrcView,        // Models RandomAccess2DImageViewConcept
+          typename DstView,        // Models MutableRandomAccess2DImageViewConcept
+          typename MapFn>        // Models MappingFunctionConcept
+void resample_pixels(const SrcView& src_view, const DstView& dst_view, const MapFn& dst_to_src, Sampler sampler=Sampler())
+{
+    detail::resample_pixels_impl(src_view, dst_view, dst_to_src, sampler);
+}
+
+/// \brief Set each pixel in the destination view as the result of a sampling function over
+/// the source coordinates given by projective mapping, bands of rows resampled in parallel
+/// according to the execution policy
+/// \ingroup ImageAlgorithms
+///
+/// The destination is resampled in square tiles, so the source pixels they read stay in
+/// cache. Source coordinates are evaluated incrementally along every row, with single
+/// division per pixel. Pixels mapped to coordinates which are not finite are left unchanged.
+template <typename Sampler,        // Models SamplerConcept
+          typename Tag,
+          typename SrcView,        // Models RandomAccess2DImageViewConcept
+          typename DstView,        // Models MutableRandomAccess2DImageViewConcept
+          typename F>
+void resample_pixels(
+    execution::execution_policy<Tag> const& policy,
+    const SrcView& src_view, const DstView& dst_view, const matrix3x3<F>& dst_to_src,
+    Sampler sampler = Sampler())
+{
+    detail::for_each_row_band(policy, dst_view.width(), dst_view.height(),
+        [&](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+            detail::resample_projective_rows(
+                src_view, dst_view, dst_to_src, sampler, y_begin, y_end);
+        });
+}
+
 ///////////////////////////////////////////////////////////////////////////
 ////
 ////   resample_pixels when one or both image views are run-time instantiated.
@@ -138,6 +819,347 @@ void resize_view(const SrcMetaView& src, const DstMetaView& dst, const Sampler&
     resample_subimage(src,dst,0.0,0.0,(double)src.width(),(double)src.height(),0.0,sampler);
 }
 
+///////////////////////////////////////////////////////////////////////////
+////
+////   remap: resample with source coordinates baked into a table
+////
+///////////////////////////////////////////////////////////////////////////
+
+/// \brief Source coordinates of every destination pixel, baked from a mapping function once,
+/// so that views of the same geometry are resampled by remap without evaluating it again
+/// \ingroup ImageAlgorithms
+///
+/// Coordinates are rounded to the nearest 1/256 of a pixel, the integer part kept in 16 bits
+/// and the fraction in 8 bits per axis. Coordinates which are not finite or do not fit into
+/// 16 bits are marked as outside of any source.
+class remap_table
+{
+public:
+    static constexpr int fraction_bits = 8;
+
+    /// \brief Integer part of coordinates outside of any source
+    static constexpr std::int16_t outside = (std::numeric_limits<std::int16_t>::min)();
+
+    struct entry
+    {
+        std::int16_t x;
+        std::int16_t y;
+        std::uint8_t fraction_x;
+        std::uint8_t fraction_y;
+    };
+
+    remap_table() = default;
+
+    /// \brief Bakes coordinates of source points dst_to_src maps destination pixels to
+    template <typename MapFn>
+    remap_table(point_t const& dimensions, MapFn const& dst_to_src)
+        : dimensions_(dimensions)
+        , entries_(static_cast<std::size_t>(dimensions.x * dimensions.y))
+    {
+        point_t p;
+        for (p.y = 0; p.y < dimensions.y; ++p.y)
+        {
+            entry* row = entries_.data() + p.y * dimensions.x;
+            for (p.x = 0; p.x < dimensions.x; ++p.x)
+                row[p.x] = make_entry(transform(dst_to_src, p));
+        }
+    }
+
+    auto dimensions() const -> point_t const& { return dimensions_; }
+    auto width() const -> std::ptrdiff_t { return dimensions_.x; }
+    auto height() const -> std::ptrdiff_t { return dimensions_.y; }
+
+    auto row_begin(std::ptrdiff_t y) const -> entry const*
+    {
+        return entries_.data() + y * dimensions_.x;
+    }
+
+    auto operator()(std::ptrdiff_t x, std::ptrdiff_t y) const -> entry const&
+    {
+        return row_begin(y)[x];
+    }
+
+    /// \brief Source point of entry, as sampled by remap
+    static auto source_point(entry const& e) -> point<double>
+    {
+        double const one = static_cast<double>(1 << fraction_bits);
+        return {e.x + e.fraction_x / one, e.y + e.fraction_y / one};
+    }
+
+private:
+    template <typename F>
+    static auto make_entry(point<F> const& p) -> entry
+    {
+        double const one = static_cast<double>(1 << fraction_bits);
+        double const x = std::floor(static_cast<double>(p.x) * one + 0.5);
+        double const y = std::floor(static_cast<double>(p.y) * one + 0.5);
+        // Negated comparisons reject coordinates which are not a number
+        double const limit = (std::numeric_limits<std::int16_t>::max)() * one;
+        if (!(std::abs(x) <= limit) || !(std::abs(y) <= limit))
+            return {outside, outside, 0, 0};
+
+        auto const fixed_x = static_cast<std::int32_t>(x);
+        auto const fixed_y = static_cast<std::int32_t>(y);
+        return {
+            static_cast<std::int16_t>(fixed_x >> fraction_bits),
+            static_cast<std::int16_t>(fixed_y >> fraction_bits),
+            static_cast<std::uint8_t>(fixed_x & ((1 << fraction_bits) - 1)),
+            static_cast<std::uint8_t>(fixed_y & ((1 << fraction_bits) - 1))};
+    }
+
+    point_t dimensions_{0, 0};
+    std::vector<entry> entries_;
+};
+
+namespace detail {
+
+/// \brief Samples source at points of table entries with the sampler
+template <typename Sampler, typename SrcView, typename DstView>
+struct remap_generic_rows
+{
+    remap_generic_rows(const SrcView&, const DstView&) {}
+
+    void operator()(
+        Sampler sampler, const SrcView& src_view, const DstView& dst_view,
+        typename DstView::point_t const& dst_p, remap_table::entry const* entries,
+        std::ptrdiff_t n)
+    {
+        typename DstView::x_iterator xit = dst_view.row_begin(dst_p.y) + dst_p.x;
+        for (std::ptrdiff_t i = 0; i < n; ++i)
+        {
+            if (entries[i].x != remap_table::outside)
+                sample(sampler, src_view, remap_table::source_point(entries[i]), xit[i]);
+        }
+    }
+};
+
+/// \brief Nearest-neighbor samples of row at table entries
+template <std::ptrdiff_t SrcStep, std::ptrdiff_t DstStep, typename Sample, std::size_t Channels>
+void remap_row(
+    nearest_neighbor_sampler sampler,
+    sample_planes<Sample const, Channels> const& src,
+    std::int32_t const* offsets,
+    std::int32_t const* fractions_x,
+    std::int32_t const* fractions_y,
+    sample_planes<Sample, Channels> const& dst,
+    std::ptrdiff_t dst_offset,
+    std::ptrdiff_t n)
+{
+    sample_row<SrcStep, DstStep>(
+        sampler, src, offsets, fractions_x, fractions_y, dst, dst_offset, n);
+}
+
+/// \brief Bilinear samples of row at table entries, with 8-bit fractions products of weights
+/// fit into 32 bits
+template <std::ptrdiff_t SrcStep, std::ptrdiff_t DstStep, typename Sample, std::size_t Channels>
+void remap_row(
+    bilinear_sampler,
+    sample_planes<Sample const, Channels> const& src,
+    std::int32_t const* offsets,
+    std::int32_t const* fractions_x,
+    std::int32_t const* fractions_y,
+    sample_planes<Sample, Channels> const& dst,
+    std::ptrdiff_t dst_offset,
+    std::ptrdiff_t n)
+{
+    constexpr std::int32_t one = std::int32_t(1) << remap_table::fraction_bits;
+    std::ptrdiff_t const below = src.row_step;
+    Sample const* src_base[Channels];
+    Sample* dst_base[Channels];
+    for (std::size_t c = 0; c < Channels; ++c)
+    {
+        src_base[c] = src.base[c];
+        dst_base[c] = dst.base[c] + dst_offset;
+    }
+    for (std::ptrdiff_t i = 0; i < n; ++i)
+    {
+        std::int32_t const offset = offsets[i];
+        std::int32_t const fx = fractions_x[i];
+        std::int32_t const fy = fractions_y[i];
+        std::int32_t const top_left = (one - fx) * (one - fy);
+        std::int32_t const top_right = fx * (one - fy);
+        std::int32_t const bottom_left = (one - fx) * fy;
+        std::int32_t const bottom_right = fx * fy;
+        Sample values[Channels];
+        for (std::size_t c = 0; c < Channels; ++c)
+        {
+            Sample const* s = src_base[c] + offset;
+            values[c] = static_cast<Sample>((s[0] * top_left + s[SrcStep] * top_right +
+                s[below] * bottom_left + s[below + SrcStep] * bottom_right) >>
+                (2 * remap_table::fraction_bits));
+        }
+        for (std::size_t c = 0; c < Channels; ++c)
+            dst_base[c][i * DstStep] = values[c];
+    }
+}
+
+/// \brief Resampling of 8-bit views, samples completely inside the source taken by the
+/// integer kernels, others by the sampler
+template <typename Sampler, typename SrcView, typename DstView>
+class remap_fixed_point_rows
+{
+public:
+    remap_fixed_point_rows(const SrcView& src_view, const DstView& dst_view)
+        : src_(make_sample_planes(src_view, is_planar<SrcView>{}))
+        , dst_(make_sample_planes(dst_view, is_planar<DstView>{}))
+        , range_x_(static_cast<std::uint32_t>(bilinear ? src_view.width() - 1 : src_view.width()))
+        , range_y_(static_cast<std::uint32_t>(
+            bilinear ? src_view.height() - 1 : src_view.height()))
+    {}
+
+    void operator()(
+        Sampler sampler, const SrcView& src_view, const DstView& dst_view,
+        typename DstView::point_t const& dst_p, remap_table::entry const* entries,
+        std::ptrdiff_t n)
+    {
+        std::ptrdiff_t const dst_offset = dst_p.y * dst_.row_step + dst_p.x * dst_step;
+        if (fixed_point_samples(entries, n) == n)
+        {
+            remap_row<src_step, dst_step>(sampler, src_,
+                offsets_, fractions_x_, fractions_y_, dst_, dst_offset, n);
+            return;
+        }
+
+        remap_generic_rows<Sampler, SrcView, DstView> generic(src_view, dst_view);
+        for (std::ptrdiff_t begin = 0; begin < n;)
+        {
+            std::ptrdiff_t end = begin + 1;
+            while (end < n && inside_[end] == inside_[begin])
+                ++end;
+            if (inside_[begin])
+            {
+                remap_row<src_step, dst_step>(sampler, src_,
+                    offsets_ + begin, fractions_x_ + begin, fractions_y_ + begin, dst_,
+                    dst_offset + begin * dst_step, end - begin);
+            }
+            else
+            {
+                typename DstView::point_t const p(dst_p.x + begin, dst_p.y);
+                generic(sampler, src_view, dst_view, p, entries + begin, end - begin);
+            }
+            begin = end;
+        }
+    }
+
+private:
+    /// \brief Offsets and fractions of samples, meaningful for those inside only, returns
+    /// number of samples inside
+    auto fixed_point_samples(remap_table::entry const* entries, std::ptrdiff_t n)
+        -> std::ptrdiff_t
+    {
+        auto const row_step = static_cast<std::int32_t>(src_.row_step);
+        std::int32_t count = 0;
+        for (std::ptrdiff_t i = 0; i < n; ++i)
+        {
+            std::int32_t x = entries[i].x;
+            std::int32_t y = entries[i].y;
+            std::int32_t const fraction_x = entries[i].fraction_x;
+            std::int32_t const fraction_y = entries[i].fraction_y;
+            if (!bilinear)
+            {
+                // Rounded half away from zero as iround
+                x += (fraction_x + 128 - static_cast<std::int32_t>(x < 0)) >> 8;
+                y += (fraction_y + 128 - static_cast<std::int32_t>(y < 0)) >> 8;
+            }
+            inside_[i] = static_cast<std::int32_t>(static_cast<std::uint32_t>(x) < range_x_) &
+                static_cast<std::int32_t>(static_cast<std::uint32_t>(y) < range_y_);
+            count += inside_[i];
+            offsets_[i] = y * row_step + x * static_cast<std::int32_t>(src_step);
+            fractions_x_[i] = fraction_x;
+            fractions_y_[i] = fraction_y;
+        }
+        return count;
+    }
+
+    static constexpr bool bilinear = std::is_same<Sampler, bilinear_sampler>::value;
+    static constexpr std::ptrdiff_t src_step =
+        is_planar<SrcView>::value ? 1 : static_cast<std::ptrdiff_t>(num_channels<SrcView>::value);
+    static constexpr std::ptrdiff_t dst_step =
+        is_planar<DstView>::value ? 1 : static_cast<std::ptrdiff_t>(num_channels<DstView>::value);
+
+    decltype(make_sample_planes(std::declval<SrcView>(), is_planar<SrcView>{})) src_;
+    decltype(make_sample_planes(std::declval<DstView>(), is_planar<DstView>{})) dst_;
+    std::uint32_t range_x_;
+    std::uint32_t range_y_;
+    std::int32_t inside_[projective_tile_size];
+    std::int32_t offsets_[projective_tile_size];
+    std::int32_t fractions_x_[projective_tile_size];
+    std::int32_t fractions_y_[projective_tile_size];
+};
+
+/// \brief Remaps rows [y_begin, y_end) of destination in segments of fixed length
+template <typename Sampler, typename SrcView, typename DstView>
+void remap_rows(
+    const SrcView& src_view, const DstView& dst_view, remap_table const& table,
+    Sampler sampler, std::ptrdiff_t y_begin, std::ptrdiff_t y_end)
+{
+    // Offsets of samples must fit into 32 bits
+    std::ptrdiff_t const max_size = std::ptrdiff_t(1) << (30 - affine_fraction_bits);
+    bool const fixed_point = is_affine_fast_path<Sampler, SrcView, DstView, double>::value &&
+        src_view.width() < max_size && src_view.height() < max_size;
+    using fixed_point_rows = typename std::conditional<
+        is_affine_fast_path<Sampler, SrcView, DstView, double>::value,
+        remap_fixed_point_rows<Sampler, SrcView, DstView>,
+        remap_generic_rows<Sampler, SrcView, DstView>>::type;
+    fixed_point_rows fixed_point_segment(src_view, dst_view);
+    remap_generic_rows<Sampler, SrcView, DstView> generic_segment(src_view, dst_view);
+
+    std::ptrdiff_t const width = dst_view.width();
+    typename DstView::point_t dst_p;
+    for (dst_p.y = y_begin; dst_p.y < y_end; ++dst_p.y)
+    {
+        remap_table::entry const* entries = table.row_begin(dst_p.y);
+        for (dst_p.x = 0; dst_p.x < width; dst_p.x += projective_tile_size)
+        {
+            std::ptrdiff_t const n = (std::min)(projective_tile_size, width - dst_p.x);
+            if (fixed_point)
+                fixed_point_segment(sampler, src_view, dst_view, dst_p, entries + dst_p.x, n);
+            else
+                generic_segment(sampler, src_view, dst_view, dst_p, entries + dst_p.x, n);
+        }
+    }
+}
+
+} // namespace detail
+
+/// \brief Set each pixel in the destination view as the result of a sampling function at
+/// source coordinates baked into the table, bands of rows resampled in parallel according
+/// to the execution policy
+/// \ingroup ImageAlgorithms
+///
+/// Nothing but the table is evaluated per pixel. For 8-bit interleaved or planar views of the
+/// same pixel type and the nearest-neighbor or bilinear sampler, samples inside the source
+/// are computed in integer arithmetic, with results equal to those of the samplers at the
+/// baked coordinates.
+///
+/// \throws std::invalid_argument if dimensions of the table and the destination differ
+template <typename Sampler,        // Models SamplerConcept
+          typename Tag,
+          typename SrcView,        // Models RandomAccess2DImageViewConcept
+          typename DstView>        // Models MutableRandomAccess2DImageViewConcept
+void remap(
+    execution::execution_policy<Tag> const& policy,
+    const SrcView& src_view, const DstView& dst_view, remap_table const& table,
+    Sampler sampler = Sampler())
+{
+    if (table.dimensions() != dst_view.dimensions())
+        throw std::invalid_argument("remap: table and destination dimensions differ");
+
+    detail::for_each_row_band(policy, dst_view.width(), dst_view.height(),
+        [&](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+            detail::remap_rows(src_view, dst_view, table, sampler, y_begin, y_end);
+        });
+}
+
+/// \overload
+template <typename Sampler, typename SrcView, typename DstView>
+void remap(
+    const SrcView& src_view, const DstView& dst_view, remap_table const& table,
+    Sampler sampler = Sampler())
+{
+    remap(execution::seq, src_view, dst_view, table, sampler);
+}
+
 } }  // namespace boost::gil
 
 #endif // BOOST_GIL_EXTENSION_NUMERIC_RESAMPLE_HPP
@@ -0,0 +1,498 @@
+//
+// Copyright 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#ifndef BOOST_GIL_IMAGE_PROCESSING_BINARY_MORPHOLOGY_HPP
+#define BOOST_GIL_IMAGE_PROCESSING_BINARY_MORPHOLOGY_HPP
+
+#include <boost/gil/bit_aligned_pixel_iterator.hpp>
+#include <boost/gil/bit_aligned_pixel_reference.hpp>
+#include <boost/gil/concepts.hpp>
+#include <boost/gil/image_processing/morphology.hpp>
+#include <boost/gil/utilities.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <boost/mp11/list.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace boost { namespace gil {
+
+namespace detail {
+
+/// \brief Determines if iterator walks over single-channel 1-bit pixels packed into bytes
+template <typename Iterator>
+struct is_binary_iterator : std::false_type {};
+
+template <typename BitField, typename Layout, bool IsMutable>
+struct is_binary_iterator<bit_aligned_pixel_iterator<
+    bit_aligned_pixel_reference<BitField, mp11::mp_list_c<unsigned, 1>, Layout, IsMutable>>>
+    : std::true_type
+{
+};
+
+template <typename BitField, typename Layout, bool IsMutable>
+struct is_binary_iterator<bit_aligned_pixel_iterator<
+    bit_aligned_pixel_reference<BitField, mp11::mp_list_c<unsigned, 1>, Layout, IsMutable> const>>
+    : std::true_type
+{
+};
+
+/// \brief Number of 64-bit words holding given number of 1-bit pixels
+inline auto binary_row_words(std::ptrdiff_t width) -> std::ptrdiff_t
+{
+    return (width + 63) / 64;
+}
+
+/// \brief Little-endian 64-bit word of eight bytes
+///
+/// Plain copy on platforms known to be little-endian, which compilers turn into a
+/// single load, assembled from individual bytes elsewhere.
+inline auto load_binary_word(unsigned char const* bytes) -> std::uint64_t
+{
+    std::uint64_t word = 0;
+#if (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || \
+    defined(_M_IX86) || defined(_M_X64) || defined(_M_ARM64)
+    std::memcpy(&word, bytes, sizeof(word));
+#else
+    for (int i = 0; i < 8; ++i)
+        word |= static_cast<std::uint64_t>(bytes[i]) << (8 * i);
+#endif
+    return word;
+}
+
+/// \brief Stores 64-bit word as eight little-endian bytes
+inline void store_binary_word(std::uint64_t word, unsigned char* bytes)
+{
+#if (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || \
+    defined(_M_IX86) || defined(_M_X64) || defined(_M_ARM64)
+    std::memcpy(bytes, &word, sizeof(word));
+#else
+    for (int i = 0; i < 8; ++i)
+        bytes[i] = static_cast<unsigned char>(word >> (8 * i));
+#endif
+}
+
+/// \brief Reads row of 1-bit view into 64-bit words, pixel x at bit x % 64 of word x / 64
+///
+/// Rows of bit-aligned images are not aligned to bytes, so bits are realigned while
+/// reading. Bits past the end of the row are zero.
+template <typename View>
+void load_binary_row(View const& view, std::ptrdiff_t y, std::uint64_t* words)
+{
+    auto const range = view.row_begin(y).bit_range();
+    auto const* bytes = range.current_byte();
+    int const offset = range.bit_offset();
+    std::ptrdiff_t const width = view.width();
+    std::ptrdiff_t const num_bytes = (offset + width + 7) / 8;
+    std::ptrdiff_t const num_words = binary_row_words(width);
+
+    // Words with all nine bytes they are assembled from inside of the row
+    std::ptrdiff_t const full_words = (std::max)((num_bytes - 1) / 8, std::ptrdiff_t(0));
+    std::ptrdiff_t w = 0;
+    for (; w < (std::min)(full_words, num_words); ++w)
+    {
+        std::uint64_t const word = load_binary_word(bytes + 8 * w);
+        std::uint64_t const next = bytes[8 * w + 8];
+        words[w] = offset == 0 ? word : (word >> offset) | (next << (64 - offset));
+    }
+    auto byte_at = [&](std::ptrdiff_t i) -> std::uint64_t {
+        return i < num_bytes ? static_cast<std::uint64_t>(bytes[i]) : 0u;
+    };
+    for (; w < num_words; ++w)
+    {
+        std::uint64_t word = 0;
+        for (int i = 0; i < 8; ++i)
+            word |= byte_at(8 * w + i) << (8 * i);
+        if (offset != 0)
+            word = (word >> offset) | (byte_at(8 * w + 8) << (64 - offset));
+        words[w] = word;
+    }
+    if (width % 64 != 0)
+        words[num_words - 1] &= (std::uint64_t(1) << (width % 64)) - 1;
+}
+
+/// \brief Writes 64-bit words into row of 1-bit view, preserving bits outside of the view
+template <typename View>
+void store_binary_row(View const& view, std::ptrdiff_t y, std::uint64_t const* words)
+{
+    auto const range = view.row_begin(y).bit_range();
+    auto* bytes = range.current_byte();
+    int const offset = range.bit_offset();
+    std::ptrdiff_t const width = view.width();
+    std::ptrdiff_t const num_bytes = (offset + width + 7) / 8;
+    std::ptrdiff_t const num_words = binary_row_words(width);
+
+    // Bits of the first and the last byte outside of the view are restored at the end
+    int const end_bits = static_cast<int>((offset + width) % 8);
+    unsigned const first_mask = 0xFFu << offset;
+    unsigned const last_mask = end_bits != 0 ? (1u << end_bits) - 1u : 0xFFu;
+    unsigned const first = bytes[0];
+    unsigned const last = bytes[num_bytes - 1];
+
+    // Word k of the row as stored, starting at bit offset of the first byte
+    auto stream_word = [&](std::ptrdiff_t k) -> std::uint64_t {
+        std::uint64_t const word = k < num_words ? words[k] : 0u;
+        if (offset == 0)
+            return word;
+        std::uint64_t const previous = k > 0 ? words[k - 1] : 0u;
+        return (word << offset) | (previous >> (64 - offset));
+    };
+    std::ptrdiff_t k = 0;
+    for (; 8 * k + 8 <= num_bytes; ++k)
+        store_binary_word(stream_word(k), bytes + 8 * k);
+    if (8 * k < num_bytes)
+    {
+        std::uint64_t const word = stream_word(k);
+        for (std::ptrdiff_t i = 0; 8 * k + i < num_bytes; ++i)
+            bytes[8 * k + i] = static_cast<unsigned char>(word >> (8 * i));
+    }
+
+    unsigned mask = first_mask;
+    if (num_bytes == 1)
+        mask &= last_mask;
+    bytes[0] = static_cast<unsigned char>((first & ~mask) | (bytes[0] & mask));
+    if (num_bytes > 1)
+    {
+        bytes[num_bytes - 1] = static_cast<unsigned char>(
+            (last & ~last_mask) | (bytes[num_bytes - 1] & last_mask));
+    }
+}
+
+/// \brief Union of 64 pixels at once, with zero as neutral element
+struct binary_or
+{
+    auto operator()(std::uint64_t a, std::uint64_t b) const -> std::uint64_t { return a | b; }
+    static auto neutral() -> std::uint64_t { return 0u; }
+};
+
+/// \brief Intersection of 64 pixels at once, with all ones as neutral element
+struct binary_and
+{
+    auto operator()(std::uint64_t a, std::uint64_t b) const -> std::uint64_t { return a & b; }
+    static auto neutral() -> std::uint64_t { return ~std::uint64_t(0); }
+};
+
+/// \brief 64 pixels starting at given non-negative bit of row of words
+/// \param fill Word assumed past the end of the row.
+inline auto binary_word_at(
+    std::uint64_t const* row, std::ptrdiff_t size, std::ptrdiff_t bit, std::uint64_t fill)
+    -> std::uint64_t
+{
+    std::ptrdiff_t const w = bit / 64;
+    int const shift = static_cast<int>(bit % 64);
+    std::uint64_t const lo = w < size ? row[w] : fill;
+    if (shift == 0)
+        return lo;
+    std::uint64_t const hi = w + 1 < size ? row[w + 1] : fill;
+    return (lo >> shift) | (hi << (64 - shift));
+}
+
+/// \brief Combines words with row of words shifted by given non-negative number of bits
+///
+/// Words [bit / 64, bit / 64 + size] of the input must be readable. Input may alias
+/// output as long as it is read ahead of it.
+template <typename Op>
+void combine_shifted_words(
+    std::uint64_t* acc, std::uint64_t const* in, std::ptrdiff_t size, std::ptrdiff_t bit, Op op)
+{
+    std::uint64_t const* src = in + bit / 64;
+    int const shift = static_cast<int>(bit % 64);
+    if (shift == 0)
+    {
+        for (std::ptrdiff_t w = 0; w < size; ++w)
+            acc[w] = op(acc[w], src[w]);
+    }
+    else
+    {
+        for (std::ptrdiff_t w = 0; w < size; ++w)
+            acc[w] = op(acc[w], (src[w] >> shift) | (src[w + 1] << (64 - shift)));
+    }
+}
+
+/// \brief Morphological operation of 1-bit view with structuring element decomposed into runs
+///
+/// Every source row is padded with neutral words, then filtered once per distinct run
+/// length: run of length L is the operation over row shifted by 0..L-1 pixels, computed by
+/// doubling in ceil(log2(L)) shifts. Each output row combines one shifted filtered row per
+/// run. All operations act on 64 pixels at once and word loops vectorize.
+///
+/// Every source row is read before the destination row of the same index is written,
+/// so the destination may be the source itself.
+template <typename SrcView, typename DstView, typename Op>
+void binary_morph_runs(
+    SrcView const& src_view,
+    DstView const& dst_view,
+    morph_structuring_element const& element,
+    Op op)
+{
+    std::ptrdiff_t const width = src_view.width();
+    std::ptrdiff_t const height = src_view.height();
+    std::ptrdiff_t const num_words = binary_row_words(width);
+    // Pixel x of the view is bit x + origin of padded row
+    std::ptrdiff_t const left_words = ((std::max)(-element.x_min, std::ptrdiff_t(0)) + 63) / 64;
+    std::ptrdiff_t const right_words = ((std::max)(element.x_max, std::ptrdiff_t(0)) + 63) / 64 + 1;
+    std::ptrdiff_t const padded_words = left_words + num_words + right_words;
+    std::ptrdiff_t const origin = 64 * left_words;
+
+    std::vector<std::ptrdiff_t> lengths;
+    for (auto const& run : element.runs)
+        lengths.push_back(run.length);
+    std::sort(lengths.begin(), lengths.end());
+    lengths.erase(std::unique(lengths.begin(), lengths.end()), lengths.end());
+
+    std::ptrdiff_t const ring_size = element.y_max - element.y_min + 1;
+    auto const padded_size = static_cast<std::size_t>(padded_words);
+    std::vector<std::uint64_t> ring(
+        lengths.size() * static_cast<std::size_t>(ring_size) * padded_size);
+    auto filtered_row = [&](std::size_t length_index, std::ptrdiff_t sy) -> std::uint64_t* {
+        std::ptrdiff_t const slot = ((sy % ring_size) + ring_size) % ring_size;
+        std::size_t const row_index =
+            length_index * static_cast<std::size_t>(ring_size) + static_cast<std::size_t>(slot);
+        return ring.data() + row_index * padded_size;
+    };
+
+    std::uint64_t const tail_mask =
+        width % 64 == 0 ? ~std::uint64_t(0) : (std::uint64_t(1) << (width % 64)) - 1;
+    std::vector<std::uint64_t> padded(padded_size);
+    auto load_row = [&](std::ptrdiff_t sy) {
+        if (sy < 0 || sy >= height)
+            return;
+
+        std::fill(padded.begin(), padded.end(), Op::neutral());
+        std::uint64_t* data = padded.data() + left_words;
+        load_binary_row(src_view, sy, data);
+        data[num_words - 1] = (data[num_words - 1] & tail_mask) | (Op::neutral() & ~tail_mask);
+
+        for (std::size_t i = 0; i < lengths.size(); ++i)
+        {
+            std::uint64_t* BOOST_RESTRICT out = filtered_row(i, sy);
+            std::copy(padded.begin(), padded.end(), out);
+            // Shift reads are ahead of the word being updated, so doubling runs in place
+            std::ptrdiff_t span = 1;
+            while (span < lengths[i])
+            {
+                std::ptrdiff_t const step = (std::min)(span, lengths[i] - span);
+                std::ptrdiff_t const inside =
+                    (std::max)(padded_words - step / 64 - 1, std::ptrdiff_t(0));
+                combine_shifted_words(out, out, inside, step, op);
+                for (std::ptrdiff_t w = inside; w < padded_words; ++w)
+                {
+                    out[w] = op(out[w],
+                        binary_word_at(out, padded_words, 64 * w + step, Op::neutral()));
+                }
+                span += step;
+            }
+        }
+    };
+
+    std::vector<std::size_t> run_length_index;
+    for (auto const& run : element.runs)
+    {
+        run_length_index.push_back(static_cast<std::size_t>(
+            std::lower_bound(lengths.begin(), lengths.end(), run.length) - lengths.begin()));
+    }
+
+    for (std::ptrdiff_t sy = element.y_min; sy < element.y_max; ++sy)
+        load_row(sy);
+
+    std::vector<std::uint64_t> out(static_cast<std::size_t>(num_words));
+    for (std::ptrdiff_t y = 0; y < height; ++y)
+    {
+        load_row(y + element.y_max);
+        std::fill(out.begin(), out.end(), Op::neutral());
+        for (std::size_t r = 0; r < element.runs.size(); ++r)
+        {
+            morph_run const& run = element.runs[r];
+            std::ptrdiff_t const sy = y + run.dy;
+            if (sy < 0 || sy >= height)
+                continue;
+
+            // Guard words keep all reads inside of the padded row
+            combine_shifted_words(out.data(), filtered_row(run_length_index[r], sy), num_words,
+                origin + run.dx, op);
+        }
+        store_binary_row(dst_view, y, out.data());
+    }
+}
+
+/// \brief Checks views and applies binary morphological operation given number of times
+template <typename SrcView, typename DstView, typename Kernel>
+void binary_morph(
+    SrcView const& src_view,
+    DstView const& dst_view,
+    Kernel const& ker_mat,
+    morphological_operation identifier,
+    int iterations)
+{
+    static_assert(is_binary_iterator<typename SrcView::x_iterator>::value,
+        "Source view must be single-channel 1-bit bit-aligned view, "
+        "e.g. view of gray1_image_t");
+    static_assert(is_binary_iterator<typename DstView::x_iterator>::value,
+        "Destination view must be single-channel 1-bit bit-aligned view, "
+        "e.g. view of gray1_image_t");
+    BOOST_ASSERT(ker_mat.size() != 0 && src_view.dimensions() == dst_view.dimensions());
+
+    if (iterations <= 0 || src_view.width() == 0 || src_view.height() == 0)
+    {
+        if (src_view.width() != 0)
+        {
+            std::vector<std::uint64_t> row(
+                static_cast<std::size_t>(binary_row_words(src_view.width())));
+            for (std::ptrdiff_t y = 0; y < src_view.height(); ++y)
+            {
+                load_binary_row(src_view, y, row.data());
+                store_binary_row(dst_view, y, row.data());
+            }
+        }
+        return;
+    }
+
+    morph_structuring_element const element = make_morph_structuring_element(ker_mat);
+    for (int i = 0; i < iterations; ++i)
+    {
+        if (identifier == morphological_operation::dilation)
+        {
+            if (i == 0)
+                binary_morph_runs(src_view, dst_view, element, binary_or());
+            else
+                binary_morph_runs(dst_view, dst_view, element, binary_or());
+        }
+        else
+        {
+            if (i == 0)
+                binary_morph_runs(src_view, dst_view, element, binary_and());
+            else
+                binary_morph_runs(dst_view, dst_view, element, binary_and());
+        }
+    }
+}
+
+} // namespace detail
+
+/// \addtogroup ImageProcessing
+/// @{
+
+/// \brief Packs single-channel view into 1-bit mask, non-zero samples become set pixels
+/// \param src_view - Source single-channel view, e.g. gray8 mask.
+/// \param dst_view - Destination 1-bit view, e.g. view of gray1_image_t.
+template <typename SrcView, typename DstView>
+void pack_binary_mask(SrcView const& src_view, DstView const& dst_view)
+{
+    gil_function_requires<ImageViewConcept<SrcView>>();
+    static_assert(num_channels<SrcView>::value == 1, "Source view must have single channel");
+    static_assert(detail::is_binary_iterator<typename DstView::x_iterator>::value,
+        "Destination view must be single-channel 1-bit bit-aligned view, "
+        "e.g. view of gray1_image_t");
+    BOOST_ASSERT(src_view.dimensions() == dst_view.dimensions());
+
+    using sample_t = typename base_channel_type<typename channel_type<SrcView>::type>::type;
+    std::vector<std::uint64_t> row(
+        static_cast<std::size_t>(detail::binary_row_words(src_view.width())));
+    for (std::ptrdiff_t y = 0; y < src_view.height(); ++y)
+    {
+        std::fill(row.begin(), row.end(), 0u);
+        auto src_it = src_view.row_begin(y);
+        for (std::ptrdiff_t x = 0; x < src_view.width(); ++x)
+        {
+            auto const sample = static_cast<sample_t>(at_c<0>(src_it[x]));
+            std::uint64_t const bit = detail::is_zero(sample) ? 0u : 1u;
+            row[static_cast<std::size_t>(x / 64)] |= bit << (x % 64);
+        }
+        detail::store_binary_row(dst_view, y, row.data());
+    }
+}
+
+/// \brief Unpacks 1-bit mask into single-channel view, set pixels become maximum channel value
+/// and cleared pixels minimum channel value
+/// \param src_view - Source 1-bit view, e.g. view of gray1_image_t.
+/// \param dst_view - Destination single-channel view, e.g. gray8 mask.
+template <typename SrcView, typename DstView>
+void unpack_binary_mask(SrcView const& src_view, DstView const& dst_view)
+{
+    gil_function_requires<MutableImageViewConcept<DstView>>();
+    static_assert(detail::is_binary_iterator<typename SrcView::x_iterator>::value,
+        "Source view must be single-channel 1-bit bit-aligned view, "
+        "e.g. view of gray1_image_t");
+    static_assert(num_channels<DstView>::value == 1, "Destination view must have single channel");
+    BOOST_ASSERT(src_view.dimensions() == dst_view.dimensions());
+
+    using dst_channel_t = typename channel_type<DstView>::type;
+    dst_channel_t const set = channel_traits<dst_channel_t>::max_value();
+    dst_channel_t const cleared = channel_traits<dst_channel_t>::min_value();
+
+    std::vector<std::uint64_t> row(
+        static_cast<std::size_t>(detail::binary_row_words(src_view.width())));
+    for (std::ptrdiff_t y = 0; y < src_view.height(); ++y)
+    {
+        detail::load_binary_row(src_view, y, row.data());
+        auto dst_it = dst_view.row_begin(y);
+        for (std::ptrdiff_t x = 0; x < src_view.width(); ++x)
+        {
+            bool const bit = (row[static_cast<std::size_t>(x / 64)] >> (x % 64)) & 1u;
+            at_c<0>(dst_it[x]) = bit ? set : cleared;
+        }
+    }
+}
+
+/// \brief Applies morphological dilation on 1-bit view, 64 pixels at once.
+///
+/// Structuring element has the same meaning as for gil::dilate and the result equals
+/// dilation of the mask unpacked to 8-bit. Destination may be the source view itself.
+/// \param src_view - Source 1-bit view, e.g. view of gray1_image_t.
+/// \param dst_view - Destination 1-bit view of the same dimensions.
+/// \param ker_mat - Kernel matrix/structuring element containing 0's and 1's.
+/// \param iterations - Specifies the number of times dilation is to be applied.
+template <typename SrcView, typename DstView, typename Kernel>
+void binary_dilate(SrcView const& src_view, DstView const& dst_view, Kernel const& ker_mat,
+                   int iterations)
+{
+    detail::binary_morph(
+        src_view, dst_view, ker_mat, detail::morphological_operation::dilation, iterations);
+}
+
+/// \brief Applies morphological erosion on 1-bit view, 64 pixels at once.
+///
+/// Structuring element has the same meaning as for gil::erode and the result equals
+/// erosion of the mask unpacked to 8-bit. Destination may be the source view itself.
+/// \param src_view - Source 1-bit view, e.g. view of gray1_image_t.
+/// \param dst_view - Destination 1-bit view of the same dimensions.
+/// \param ker_mat - Kernel matrix/structuring element containing 0's and 1's.
+/// \param iterations - Specifies the number of times erosion is to be applied.
+template <typename SrcView, typename DstView, typename Kernel>
+void binary_erode(SrcView const& src_view, DstView const& dst_view, Kernel const& ker_mat,
+                  int iterations)
+{
+    detail::binary_morph(
+        src_view, dst_view, ker_mat, detail::morphological_operation::erosion, iterations);
+}
+
+/// \brief Performs erosion and then dilation on 1-bit view, removing small foreground specks.
+template <typename SrcView, typename DstView, typename Kernel>
+void binary_opening(SrcView const& src_view, DstView const& dst_view, Kernel const& ker_mat)
+{
+    binary_erode(src_view, dst_view, ker_mat, 1);
+    binary_dilate(dst_view, dst_view, ker_mat, 1);
+}
+
+/// \brief Performs dilation and then erosion on 1-bit view, closing small holes in foreground.
+template <typename SrcView, typename DstView, typename Kernel>
+void binary_closing(SrcView const& src_view, DstView const& dst_view, Kernel const& ker_mat)
+{
+    binary_dilate(src_view, dst_view, ker_mat, 1);
+    binary_erode(dst_view, dst_view, ker_mat, 1);
+}
+/// @}
+
+}} // namespace boost::gil
+
+#endif
@@ -19,8 +19,18 @@
 #include <boost/gil/pixel.hpp>
 #include <boost/gil/point.hpp>
 #include <boost/gil/typedefs.hpp>
+#include <boost/gil/execution.hpp>
+#include <boost/gil/tile_scheduler.hpp>
+
+#include <boost/config.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <numeric>
+#include <type_traits>
 #include <vector>
 
 namespace boost { namespace gil {
@@ -349,6 +359,426 @@ void default_anisotropic_diffusion(const InputView& input, const OutputView& out
                           brightness_function::identity{}, conductivity::gaussian_conductivity{kappa});
 }
 
+namespace detail {
+
+/// \brief One diffusion step of rows [y_begin, y_end) of the image, computed from result,
+/// which has one pixel wide zero border, into scratch_result with the same border
+template <typename View, typename LaplaceStrategy, typename BrightnessFunction,
+          typename DiffusivityFunction>
+void diffuse_rows(View const& result, View const& scratch_result,
+                  std::ptrdiff_t y_begin, std::ptrdiff_t y_end,
+                  LaplaceStrategy& laplace, BrightnessFunction& brightness,
+                  DiffusivityFunction& diffusivity)
+{
+    using pixel_type = typename View::value_type;
+    using channel_type = typename channel_type<pixel_type>::type;
+    std::ptrdiff_t const width = result.width() - 2;
+    for (std::ptrdiff_t relative_y = y_begin; relative_y < y_end; ++relative_y)
+    {
+        for (std::ptrdiff_t relative_x = 0; relative_x < width; ++relative_x)
+        {
+            auto x = relative_x + 1;
+            auto y = relative_y + 1;
+            auto stencil = laplace.compute_laplace(result, point_t(x, y));
+            auto brightness_stencil = brightness(stencil);
+            laplace_function::stencil_type<pixel_type> diffusivity_stencil;
+            std::transform(brightness_stencil.begin(), brightness_stencil.end(),
+                           diffusivity_stencil.begin(), diffusivity);
+            laplace_function::stencil_type<pixel_type> product_stencil;
+            std::transform(stencil.begin(), stencil.end(), diffusivity_stencil.begin(),
+                           product_stencil.begin(), [](pixel_type lhs, pixel_type rhs) {
+                               static_transform(lhs, rhs, lhs, std::multiplies<channel_type>{});
+                               return lhs;
+                           });
+            static_transform(result(x, y), laplace.reduce(product_stencil),
+                             scratch_result(x, y), std::plus<channel_type>{});
+        }
+    }
+}
+
+/// \brief Exponential of x not greater than zero, in code the compiler vectorizes
+///
+/// Cephes polynomial of exp(r) for x = n ln2 + r, |r| <= ln2 / 2,
+/// accurate to within 1e-7 relative error.
+BOOST_FORCEINLINE
+float diffusion_exp(float x)
+{
+    // Clamps x to -87, bits of negative floats order as signed integers in reverse,
+    // and integer minimum does not stop the vectorization as branch would
+    std::int32_t clamped;
+    std::memcpy(&clamped, &x, sizeof(clamped));
+    clamped = (std::min)(clamped, static_cast<std::int32_t>(0xC2AE0000u));
+    std::memcpy(&x, &clamped, sizeof(x));
+
+    // Floor of positive argument, computed by truncation
+    float const n = static_cast<float>(static_cast<std::int32_t>(x * 1.44269504f + 128.5f) - 128);
+    float const r = (x - n * 0.693359375f) + n * 2.12194440e-4f;
+    float p = 1.9875691500e-4f;
+    p = p * r + 1.3981999507e-3f;
+    p = p * r + 8.3334519073e-3f;
+    p = p * r + 4.1665795894e-2f;
+    p = p * r + 1.6666665459e-1f;
+    p = p * r + 5.0000001201e-1f;
+    p = p * r * r + r + 1.0f;
+    std::int32_t const bits = (static_cast<std::int32_t>(n) + 127) << 23;
+    float scale;
+    std::memcpy(&scale, &bits, sizeof(scale));
+    return p * scale;
+}
+
+/// \brief Reciprocal square root of x not less than one, in code the compiler vectorizes
+BOOST_FORCEINLINE
+float diffusion_rsqrt(float x)
+{
+    std::int32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    bits = 0x5f3759df - (bits >> 1);
+    float y;
+    std::memcpy(&y, &bits, sizeof(y));
+    // Each Newton step squares relative error of the initial 3.5e-3
+    y = y * (1.5f - 0.5f * x * y * y);
+    y = y * (1.5f - 0.5f * x * y * y);
+    y = y * (1.5f - 0.5f * x * y * y);
+    return y;
+}
+
+/// \brief Conductivity of difference divided by kappa, in code the compiler vectorizes
+///
+/// Defined for the conductivity functions provided by GIL.
+template <typename DiffusivityFunction>
+struct vectorized_conductivity : std::false_type {};
+
+template <>
+struct vectorized_conductivity<conductivity::perona_malik_conductivity> : std::true_type
+{
+    static float apply(float v) { return diffusion_exp(-std::abs(v)); }
+};
+
+template <>
+struct vectorized_conductivity<conductivity::gaussian_conductivity> : std::true_type
+{
+    static float apply(float v) { return diffusion_exp(-v * v); }
+};
+
+template <>
+struct vectorized_conductivity<conductivity::wide_regions_conductivity> : std::true_type
+{
+    static float apply(float v) { return 1.0f / (1.0f + v * v); }
+};
+
+template <>
+struct vectorized_conductivity<conductivity::more_wide_regions_conductivity> : std::true_type
+{
+    static float apply(float v) { return diffusion_rsqrt(1.0f + v * v); }
+};
+
+/// \brief Number of points of Laplace stencil, zero for stencils other than provided by GIL
+template <typename LaplaceStrategy>
+struct diffusion_stencil_points : std::integral_constant<int, 0> {};
+
+template <>
+struct diffusion_stencil_points<laplace_function::stencil_5points>
+    : std::integral_constant<int, 5> {};
+
+template <>
+struct diffusion_stencil_points<laplace_function::stencil_9points_standard>
+    : std::integral_constant<int, 9> {};
+
+/// \brief Flux between pixels of two rows, flux[i] = c(d) * d for d = to[i] - from[i]
+template <typename Conductivity>
+BOOST_FORCEINLINE
+void diffusion_flux_samples(
+    float const* BOOST_RESTRICT from,
+    float const* BOOST_RESTRICT to,
+    float* BOOST_RESTRICT flux,
+    std::ptrdiff_t n,
+    float inverse_kappa)
+{
+    for (std::ptrdiff_t i = 0; i < n; ++i)
+    {
+        float const d = to[i] - from[i];
+        flux[i] = Conductivity::apply(d * inverse_kappa) * d;
+    }
+}
+
+/// \brief Flux between pixels of two long rows, in chunks
+template <typename Conductivity>
+void diffusion_flux_row(
+    float const* from, float const* to, float* flux, std::ptrdiff_t n, float inverse_kappa)
+{
+    for_each_chunk(n, [&](std::ptrdiff_t i, std::ptrdiff_t m) {
+        diffusion_flux_samples<Conductivity>(from + i, to + i, flux + i, m, inverse_kappa);
+    });
+}
+
+/// \brief Diffusion of single plane by stencil of 5 or 9 points and vectorized conductivity
+///
+/// Difference of two pixels gives the same conductivity in both directions, so flux across
+/// every pair of neighbours is computed once and added to one and subtracted from the other.
+template <int Points, typename Conductivity>
+class plane_diffusion
+{
+public:
+    plane_diffusion(float delta_t, float kappa)
+        : delta_t_(delta_t), inverse_kappa_(1.0f / kappa)
+    {}
+
+    /// \brief One step of rows [y0, y1) and columns [x0, x1) of plane of given stride
+    ///
+    /// Reads one more row and column on each side. Rows of fluxes must hold width + 1 samples.
+    void step(
+        float const* src, float* dst, std::ptrdiff_t stride,
+        std::ptrdiff_t x0, std::ptrdiff_t x1, std::ptrdiff_t y0, std::ptrdiff_t y1,
+        float* fluxes) const
+    {
+        std::ptrdiff_t const n = x1 - x0;
+        float* horizontal = fluxes;
+        float* vertical[2] = {horizontal + n + 1, horizontal + 2 * n + 2};
+        float* falling[2] = {horizontal + 3 * n + 3, horizontal + 4 * n + 4};
+        float* rising[2] = {horizontal + 5 * n + 5, horizontal + 6 * n + 6};
+
+        // Fluxes into pixels of row y from row y + 1: vertical from below, falling diagonal
+        // from below right and rising diagonal from below left
+        auto flux_from_below = [&](std::ptrdiff_t y, int slot) {
+            float const* row = src + y * stride;
+            float const* below = row + stride;
+            diffusion_flux_row<Conductivity>(
+                row + x0, below + x0, vertical[slot], n, inverse_kappa_);
+            if (Points == 9)
+            {
+                diffusion_flux_row<Conductivity>(
+                    row + x0 - 1, below + x0, falling[slot], n + 1, inverse_kappa_);
+                diffusion_flux_row<Conductivity>(
+                    row + x0, below + x0 - 1, rising[slot], n + 1, inverse_kappa_);
+            }
+        };
+
+        int above = 0;
+        flux_from_below(y0 - 1, above);
+        for (std::ptrdiff_t y = y0; y < y1; ++y)
+        {
+            int const current = 1 - above;
+            flux_from_below(y, current);
+            float const* row = src + y * stride;
+            diffusion_flux_row<Conductivity>(
+                row + x0 - 1, row + x0, horizontal, n + 1, inverse_kappa_);
+            update_row(row + x0, dst + y * stride + x0, n, horizontal,
+                vertical[above], vertical[current], falling[above], falling[current],
+                rising[above], rising[current]);
+            above = current;
+        }
+    }
+
+private:
+    void update_row(
+        float const* src, float* dst, std::ptrdiff_t n, float const* horizontal,
+        float const* vertical_above, float const* vertical,
+        float const* falling_above, float const* falling,
+        float const* rising_above, float const* rising) const
+    {
+        for_each_chunk(n, [&](std::ptrdiff_t i, std::ptrdiff_t m) {
+            update_samples(src + i, dst + i, m, horizontal + i,
+                vertical_above + i, vertical + i, falling_above + i, falling + i,
+                rising_above + i, rising + i);
+        });
+    }
+
+    BOOST_FORCEINLINE
+    void update_samples(
+        float const* BOOST_RESTRICT src, float* BOOST_RESTRICT dst, std::ptrdiff_t n,
+        float const* BOOST_RESTRICT horizontal,
+        float const* BOOST_RESTRICT vertical_above, float const* BOOST_RESTRICT vertical,
+        float const* BOOST_RESTRICT falling_above, float const* BOOST_RESTRICT falling,
+        float const* BOOST_RESTRICT rising_above, float const* BOOST_RESTRICT rising) const
+    {
+        float const delta_t = delta_t_;
+        for (std::ptrdiff_t i = 0; i < n; ++i)
+        {
+            float sum = (horizontal[i + 1] - horizontal[i]) + (vertical[i] - vertical_above[i]);
+            if (Points == 9)
+            {
+                // Diagonal neighbours are weighted by half
+                sum += 0.5f * ((falling[i + 1] - falling_above[i]) +
+                               (rising[i] - rising_above[i + 1]));
+            }
+            dst[i] = src[i] + delta_t * sum;
+        }
+    }
+
+    float delta_t_;
+    float inverse_kappa_;
+};
+
+/// \brief Diffusion of planes of the image by tiles, running given number of steps per tile
+///
+/// Tile is loaded together with margin as wide as the number of steps, with zero samples
+/// outside of the image, and every step updates region one pixel narrower, so the tile
+/// itself is exact after the last one. All steps run on the tile held in cache.
+template <typename Tag, int Points, typename Conductivity>
+void diffuse_planes_by_tiles(
+    execution::execution_policy<Tag> const& policy,
+    plane_diffusion<Points, Conductivity> const& diffusion,
+    std::vector<float> const& src, std::vector<float>& dst, std::size_t planes,
+    std::ptrdiff_t width, std::ptrdiff_t height, std::ptrdiff_t steps)
+{
+    std::ptrdiff_t const plane_size = width * height;
+    auto const plane_view = interleaved_view(width, height,
+        reinterpret_cast<gray32f_pixel_t const*>(src.data()), width * sizeof(float));
+    for_each_tile(policy, plane_view, point_t(0, 0), steps,
+        [&](image_tile const& tile, tile_scratch& scratch) {
+            std::ptrdiff_t const stride = tile.dimensions.x + 2 * steps;
+            std::ptrdiff_t const rows = tile.dimensions.y + 2 * steps;
+            std::ptrdiff_t const origin_x = tile.origin.x - steps;
+            std::ptrdiff_t const origin_y = tile.origin.y - steps;
+            float* buffer[2] = {
+                scratch.allocate<float>(static_cast<std::size_t>(stride * rows)),
+                scratch.allocate<float>(static_cast<std::size_t>(stride * rows))};
+            float* fluxes = scratch.allocate<float>(static_cast<std::size_t>(7 * (stride + 1)));
+
+            // Image within the buffer
+            std::ptrdiff_t const image_x0 = (std::max)(std::ptrdiff_t(0), -origin_x);
+            std::ptrdiff_t const image_x1 = (std::min)(stride, width - origin_x);
+            std::ptrdiff_t const image_y0 = (std::max)(std::ptrdiff_t(0), -origin_y);
+            std::ptrdiff_t const image_y1 = (std::min)(rows, height - origin_y);
+
+            for (std::size_t plane = 0; plane < planes; ++plane)
+            {
+                float const* src_plane =
+                    src.data() + static_cast<std::ptrdiff_t>(plane) * plane_size;
+                std::fill_n(buffer[0], stride * rows, 0.0f);
+                for (std::ptrdiff_t y = image_y0; y < image_y1; ++y)
+                {
+                    std::copy_n(src_plane + (origin_y + y) * width + origin_x + image_x0,
+                        image_x1 - image_x0, buffer[0] + y * stride + image_x0);
+                }
+                std::copy_n(buffer[0], stride * rows, buffer[1]);
+
+                for (std::ptrdiff_t step = 1; step <= steps; ++step)
+                {
+                    std::ptrdiff_t const margin = steps - step;
+                    diffusion.step(buffer[0], buffer[1], stride,
+                        (std::max)(image_x0, steps - margin),
+                        (std::min)(image_x1, stride - steps + margin),
+                        (std::max)(image_y0, steps - margin),
+                        (std::min)(image_y1, rows - steps + margin),
+                        fluxes);
+                    std::swap(buffer[0], buffer[1]);
+                }
+
+                float* dst_plane = dst.data() + static_cast<std::ptrdiff_t>(plane) * plane_size;
+                for (std::ptrdiff_t y = 0; y < tile.dimensions.y; ++y)
+                {
+                    std::copy_n(buffer[0] + (steps + y) * stride + steps, tile.dimensions.x,
+                        dst_plane + (tile.origin.y + y) * width + tile.origin.x);
+                }
+            }
+        });
+}
+
+/// \brief Parallel diffusion of float image by GIL stencil and conductivity, by planes
+template <typename Tag, typename InputView, typename OutputView,
+          typename LaplaceStrategy, typename BrightnessFunction, typename DiffusivityFunction>
+void anisotropic_diffusion_impl(
+    execution::execution_policy<Tag> const& policy,
+    InputView const& input, OutputView const& output, unsigned int num_iter,
+    LaplaceStrategy laplace, BrightnessFunction, DiffusivityFunction diffusivity,
+    unsigned int iterations_per_tile, std::true_type)
+{
+    using conductivity_type = vectorized_conductivity<DiffusivityFunction>;
+    constexpr int points = diffusion_stencil_points<LaplaceStrategy>::value;
+    plane_diffusion<points, conductivity_type> const diffusion(
+        static_cast<float>(laplace.delta_t), static_cast<float>(diffusivity.kappa));
+
+    std::ptrdiff_t const width = input.width();
+    std::ptrdiff_t const height = input.height();
+    std::size_t const planes = num_channels<OutputView>::value;
+    std::ptrdiff_t const plane_size = width * height;
+    std::vector<float> current(planes * static_cast<std::size_t>(plane_size));
+    std::vector<float> next(current.size());
+    for (std::size_t c = 0; c < planes; ++c)
+    {
+        float* plane = current.data() + static_cast<std::ptrdiff_t>(c) * plane_size;
+        for (std::ptrdiff_t y = 0; y < height; ++y)
+        {
+            auto src_it = input.row_begin(y);
+            for (std::ptrdiff_t x = 0; x < width; ++x)
+                plane[y * width + x] = static_cast<float>(src_it[x][c]);
+        }
+    }
+
+    unsigned int const block = (std::max)(iterations_per_tile, 1u);
+    for (unsigned int done = 0; done < num_iter && plane_size > 0;)
+    {
+        unsigned int const steps = (std::min)(block, num_iter - done);
+        diffuse_planes_by_tiles(policy, diffusion, current, next, planes, width, height,
+            static_cast<std::ptrdiff_t>(steps));
+        current.swap(next);
+        done += steps;
+    }
+
+    for (std::size_t c = 0; c < planes; ++c)
+    {
+        float const* plane = current.data() + static_cast<std::ptrdiff_t>(c) * plane_size;
+        for (std::ptrdiff_t y = 0; y < height; ++y)
+        {
+            auto dst_it = output.row_begin(y);
+            for (std::ptrdiff_t x = 0; x < width; ++x)
+                dst_it[x][c] = plane[y * width + x];
+        }
+    }
+}
+
+/// \brief Parallel diffusion by bands of rows, with any stencil, brightness and conductivity
+template <typename Tag, typename InputView, typename OutputView,
+          typename LaplaceStrategy, typename BrightnessFunction, typename DiffusivityFunction>
+void anisotropic_diffusion_impl(
+    execution::execution_policy<Tag> const& policy,
+    InputView const& input, OutputView const& output, unsigned int num_iter,
+    LaplaceStrategy laplace, BrightnessFunction brightness, DiffusivityFunction diffusivity,
+    unsigned int, std::false_type)
+{
+    using input_pixel_type = typename InputView::value_type;
+    using pixel_type = typename OutputView::value_type;
+    using channel_type = typename channel_type<pixel_type>::type;
+    auto const width = input.width();
+    auto const height = input.height();
+    pixel_type zero_pixel;
+    static_fill(zero_pixel, static_cast<channel_type>(0));
+
+    // Both buffers have zero border, only their inner pixels are written
+    image<pixel_type> result_image(width + 2, height + 2, zero_pixel);
+    image<pixel_type> scratch_result_image(width + 2, height + 2, zero_pixel);
+    auto result = view(result_image);
+    auto scratch_result = view(scratch_result_image);
+    transform_pixels(input, subimage_view(result, 1, 1, width, height),
+                     [](const input_pixel_type& pixel) {
+                         pixel_type converted;
+                         for (std::size_t i = 0; i < num_channels<pixel_type>{}; ++i)
+                         {
+                             converted[i] = pixel[i];
+                         }
+                         return converted;
+                     });
+
+    for (unsigned int iteration = 0; iteration < num_iter; ++iteration)
+    {
+        for_each_row_band(policy, width, height,
+            [&](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+                LaplaceStrategy band_laplace(laplace);
+                BrightnessFunction band_brightness(brightness);
+                DiffusivityFunction band_diffusivity(diffusivity);
+                diffuse_rows(result, scratch_result, y_begin, y_end,
+                    band_laplace, band_brightness, band_diffusivity);
+            });
+        using std::swap;
+        swap(result, scratch_result);
+    }
+
+    copy_pixels(subimage_view(result, 1, 1, width, height), output);
+}
+
+} // namespace detail
+
 /// \brief Performs diffusion according to Perona-Malik equation
 ///
 /// WARNING: Output channel type must be floating point,
@@ -395,27 +825,7 @@ void anisotropic_diffusion(const InputView& input, const OutputView& output, uns
 
     for (unsigned int iteration = 0; iteration < num_iter; ++iteration)
     {
-        for (std::ptrdiff_t relative_y = 0; relative_y < height; ++relative_y)
-        {
-            for (std::ptrdiff_t relative_x = 0; relative_x < width; ++relative_x)
-            {
-                auto x = relative_x + 1;
-                auto y = relative_y + 1;
-                auto stencil = laplace.compute_laplace(result, point_t(x, y));
-                auto brightness_stencil = brightness(stencil);
-                laplace_function::stencil_type<pixel_type> diffusivity_stencil;
-                std::transform(brightness_stencil.begin(), brightness_stencil.end(),
-                               diffusivity_stencil.begin(), diffusivity);
-                laplace_function::stencil_type<pixel_type> product_stencil;
-                std::transform(stencil.begin(), stencil.end(), diffusivity_stencil.begin(),
-                               product_stencil.begin(), [](pixel_type lhs, pixel_type rhs) {
-                                   static_transform(lhs, rhs, lhs, std::multiplies<channel_type>{});
-                                   return lhs;
-                               });
-                static_transform(result(x, y), laplace.reduce(product_stencil),
-                                 scratch_result(x, y), std::plus<channel_type>{});
-            }
-        }
+        detail::diffuse_rows(result, scratch_result, 0, height, laplace, brightness, diffusivity);
         using std::swap;
         swap(result, scratch_result);
     }
@@ -423,6 +833,40 @@ void anisotropic_diffusion(const InputView& input, const OutputView& output, uns
     copy_pixels(subimage_view(result, 1, 1, width, height), output);
 }
 
+/// \brief Performs diffusion according to Perona-Malik equation, using threads allowed by
+/// execution policy
+///
+/// Produces the same result as the sequential anisotropic_diffusion, up to floating point
+/// rounding. Output with float channels, GIL Laplace stencil, identity brightness and GIL
+/// conductivity function take the fast path: channels diffuse as separate planes, processed
+/// by cache-sized tiles in parallel, with conductivity computed by code the compiler
+/// vectorizes and every flux computed once for both of its pixels. Each tile runs
+/// iterations_per_tile iterations in cache before its result is written back, reading margin
+/// of that many pixels around it, which is recomputed by neighbouring tiles. Other
+/// combinations are processed by bands of rows in parallel, one iteration at a time.
+/// \param iterations_per_tile Number of iterations run on a tile at once, larger values save
+/// memory traffic at the cost of recomputing wider margins
+template <typename ExecutionPolicy, typename InputView, typename OutputView,
+          typename LaplaceStrategy = laplace_function::stencil_9points_standard,
+          typename BrightnessFunction = brightness_function::identity,
+          typename DiffusivityFunction = conductivity::gaussian_conductivity>
+auto anisotropic_diffusion(ExecutionPolicy const& policy, const InputView& input,
+                           const OutputView& output, unsigned int num_iter,
+                           LaplaceStrategy laplace, BrightnessFunction brightness,
+                           DiffusivityFunction diffusivity, unsigned int iterations_per_tile = 4)
+    -> typename std::enable_if<execution::is_execution_policy<ExecutionPolicy>::value>::type
+{
+    BOOST_ASSERT(input.dimensions() == output.dimensions());
+    using channel_t = typename channel_type<typename OutputView::value_type>::type;
+    using fast_path = std::integral_constant<bool,
+        std::is_same<channel_t, float32_t>::value &&
+        std::is_same<BrightnessFunction, brightness_function::identity>::value &&
+        detail::vectorized_conductivity<DiffusivityFunction>::value &&
+        detail::diffusion_stencil_points<LaplaceStrategy>::value != 0>;
+    detail::anisotropic_diffusion_impl(policy, input, output, num_iter, laplace, brightness,
+        diffusivity, iterations_per_tile, fast_path{});
+}
+
 }} // namespace boost::gil
 
 #endif
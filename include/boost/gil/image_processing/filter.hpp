@@ -16,7 +16,17 @@
 #include <boost/gil/image.hpp>
 #include <boost/gil/image_view.hpp>
 
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <type_traits>
 #include <vector>
 
 
@@ -24,6 +34,140 @@
 
 namespace boost { namespace gil {
 
+namespace detail
+{
+
+/// \brief Ring of rows of single-channel view, extended according to boundary option
+///
+/// Row y holds samples of columns [-left, width + right), rows outside of the view are
+/// extended as well, by replicating the nearest border row by default. Serves sliding
+/// windows moving down the view, which need at most size rows at a time. Rows are read
+/// from the view once, so the window may keep using them after the view is overwritten,
+/// which makes filters reading through the ring safe to run in place.
+template <typename Sample, typename SrcView>
+class extended_row_ring
+{
+public:
+    extended_row_ring(
+        SrcView const& view, std::ptrdiff_t size, std::ptrdiff_t left, std::ptrdiff_t right,
+        boundary_option option = boundary_option::extend_constant)
+        : view_(view)
+        , size_(size)
+        , left_(left)
+        , right_(right)
+        , option_(option)
+        , row_size_(view.width() + left + right)
+        , rows_(static_cast<std::size_t>(size * row_size_))
+        , loaded_(static_cast<std::size_t>(size), (std::numeric_limits<std::ptrdiff_t>::min)())
+    {}
+
+    auto row(std::ptrdiff_t y) -> Sample const*
+    {
+        std::size_t const slot = static_cast<std::size_t>(((y % size_) + size_) % size_);
+        Sample* data = rows_.data() + static_cast<std::ptrdiff_t>(slot) * row_size_;
+        if (loaded_[slot] != y)
+        {
+            load_extended_row(view_, y, left_, right_, option_, data);
+            loaded_[slot] = y;
+        }
+        return data;
+    }
+
+private:
+    SrcView view_;
+    std::ptrdiff_t size_;
+    std::ptrdiff_t left_;
+    std::ptrdiff_t right_;
+    boundary_option option_;
+    std::ptrdiff_t row_size_;
+    std::vector<Sample> rows_;
+    std::vector<std::ptrdiff_t> loaded_;
+};
+
+/// \brief Adds, or subtracts, extended row to sums of window columns
+template <typename Acc>
+void accumulate_box_columns(Acc const* row, Acc* column_sums, std::ptrdiff_t n, bool subtract)
+{
+    if (subtract)
+    {
+        for (std::ptrdiff_t x = 0; x < n; ++x)
+            column_sums[x] -= row[x];
+    }
+    else
+    {
+        for (std::ptrdiff_t x = 0; x < n; ++x)
+            column_sums[x] += row[x];
+    }
+}
+
+/// \brief Box filter of single-channel view with constant cost per pixel
+///
+/// Sums of window columns are updated by adding row entering the window and
+/// subtracting row leaving it, then each output row is a running sum along the
+/// column sums, so the cost does not depend on the window size. Integer samples
+/// are summed exactly in an integer accumulator. Rows leaving the window are taken
+/// from a ring of the last k rows, not from the source view, so the filter may run in place.
+template <typename Acc, typename SrcView, typename DstView>
+void box_filter_running_sum(
+    SrcView const& src_view,
+    DstView const& dst_view,
+    std::ptrdiff_t left,
+    std::ptrdiff_t right,
+    bool normalize,
+    convolution_output_region const& region,
+    boundary_option option)
+{
+    using dst_channel_t = typename channel_type<DstView>::type;
+    using dst_base_t = typename base_channel_type<dst_channel_t>::type;
+
+    std::ptrdiff_t const k = left + right + 1;
+    std::ptrdiff_t const row_size = src_view.width() + k - 1;
+    std::ptrdiff_t const n = region.x_end - region.x_begin;
+    Acc const area = static_cast<Acc>(k * k);
+
+    extended_row_ring<Acc, SrcView> ring(src_view, k, left, right, option);
+    std::vector<Acc> column_sums(static_cast<std::size_t>(row_size), Acc(0));
+    auto update = [&](std::ptrdiff_t y, bool subtract) {
+        accumulate_box_columns(ring.row(y), column_sums.data(), row_size, subtract);
+    };
+
+    for (std::ptrdiff_t y = region.y_begin - left; y < region.y_begin + right; ++y)
+        update(y, false);
+
+    for (std::ptrdiff_t y = region.y_begin; y < region.y_end; ++y)
+    {
+        update(y + right, false);
+
+        Acc const* sums = column_sums.data() + region.x_begin;
+        Acc sum = std::accumulate(sums, sums + k, Acc(0));
+        auto dst_it = dst_view.x_at(region.x_begin, y);
+        for (std::ptrdiff_t x = 0; x < n; ++x)
+        {
+            if (!normalize)
+                dst_it[x] = dst_channel_t(static_cast<dst_base_t>(sum));
+            else if (std::is_integral<Acc>::value && std::is_integral<dst_base_t>::value)
+                dst_it[x] = dst_channel_t(static_cast<dst_base_t>(sum / area));
+            else
+                dst_it[x] = dst_channel_t(static_cast<dst_base_t>(
+                    static_cast<double>(sum) / static_cast<double>(area)));
+
+            if (x + 1 < n)
+                sum += sums[x + k] - sums[x];
+        }
+
+        update(y - left, true);
+    }
+}
+
+} // namespace detail
+
+/// \brief Filters image with square box kernel, with constant cost per pixel for any kernel size
+///
+/// Equivalent to convolution with kernel of kernel_size x kernel_size equal weights,
+/// with anchor at given position within the kernel (centered by default). Window sums
+/// are maintained as running sums along columns and rows, in an integer accumulator
+/// for integer channels, so 8-bit and 16-bit images are summed exactly and normalized
+/// results are truncated like those of the convolution.
 template <typename SrcView, typename DstView>
 void box_filter(
     SrcView const& src_view,
@@ -42,17 +186,66 @@ void box_filter(
         typename color_space_type<DstView>::type
     >::value, "Source and destination views must have pixels with the same color space");
 
-    std::vector<float> kernel_values;
-    if (normalize) { kernel_values.resize(kernel_size, 1.0f / float(kernel_size)); }
-    else { kernel_values.resize(kernel_size, 1.0f); }
+    BOOST_ASSERT(src_view.dimensions() == dst_view.dimensions());
+    BOOST_ASSERT(kernel_size != 0);
 
     if (anchor == -1) anchor = static_cast<int>(kernel_size / 2);
-    kernel_1d<float> kernel(kernel_values.begin(), kernel_size, anchor);
+    BOOST_ASSERT(anchor >= 0 && static_cast<std::size_t>(anchor) < kernel_size);
 
-    detail::convolve_1d
-    <
-        pixel<float, typename SrcView::value_type::layout_t>
-    >(src_view, kernel, dst_view, option);
+    // Window of convolution with box kernel anchored at given position
+    std::ptrdiff_t const left = static_cast<std::ptrdiff_t>(kernel_size) - 1 - anchor;
+    std::ptrdiff_t const right = anchor;
+
+    std::ptrdiff_t const width = src_view.width();
+    std::ptrdiff_t const height = src_view.height();
+    detail::convolution_output_region region;
+    region.x_end = width;
+    region.y_end = height;
+    if (option == boundary_option::output_ignore || option == boundary_option::output_zero)
+    {
+        region.x_begin = left;
+        region.x_end = width - right;
+        region.y_begin = left;
+        region.y_end = height - right;
+    }
+
+    using src_channel_t = typename channel_type<SrcView>::type;
+    double const max_sum = static_cast<double>(kernel_size * kernel_size) *
+        static_cast<double>((std::numeric_limits<src_channel_t>::max)());
+    bool const fits_int32 =
+        max_sum <= static_cast<double>((std::numeric_limits<std::int32_t>::max)());
+
+    for (std::size_t i = 0; i < src_view.num_channels(); i++)
+    {
+        auto const src_channel = nth_channel_view(src_view, static_cast<int>(i));
+        auto const dst_channel = nth_channel_view(dst_view, static_cast<int>(i));
+        if (region.empty())
+        {
+            if (option == boundary_option::output_zero)
+                detail::zero_outside_region(dst_channel, region);
+            continue;
+        }
+
+        if (!std::is_integral<src_channel_t>::value)
+        {
+            detail::box_filter_running_sum<double>(
+                src_channel, dst_channel, left, right, normalize, region, option);
+        }
+        else if (fits_int32)
+        {
+            detail::box_filter_running_sum<std::int32_t>(
+                src_channel, dst_channel, left, right, normalize, region, option);
+        }
+        else
+        {
+            detail::box_filter_running_sum<std::int64_t>(
+                src_channel, dst_channel, left, right, normalize, region, option);
+        }
+
+        // After filtering, as in place the border is still read as source
+        if (option == boundary_option::output_zero)
+            detail::zero_outside_region(dst_channel, region);
+    }
 }
 
 template <typename SrcView, typename DstView>
@@ -67,41 +260,718 @@ void blur(
     box_filter(src_view, dst_view, kernel_size, anchor, true, option);
 }
 
+/// \brief Algorithm used by gaussian_blur
+enum class gaussian_blur_method
+{
+    automatic, ///< Separable FIR for small sigma, recursive filter otherwise
+    recursive, ///< Deriche recursive filter, constant cost per pixel for any sigma
+    fir        ///< Separable convolution with sampled Gaussian truncated at four sigma
+};
 
 namespace detail
 {
+
+/// \brief Coefficients of fourth-order recursive Gaussian filter of Deriche
+///
+/// Output is the sum of causal and anticausal parts,
+/// y+[n] = n0 * x[n] + ... + n3 * x[n-3] - d1 * y+[n-1] - ... - d4 * y+[n-4] and
+/// y-[n] = m1 * x[n+1] + ... + m4 * x[n+4] - d1 * y-[n+1] - ... - d4 * y-[n+4].
+/// Gains are responses of each part to constant unit input, summing to one.
+struct recursive_gaussian_coefficients
+{
+    float n[4]{};
+    float m[4]{};
+    float d[4]{};
+    float causal_gain{0.0f};
+    float anticausal_gain{0.0f};
+};
+
+/// \brief Computes recursive filter coefficients approximating Gaussian of given sigma
+///
+/// Impulse response of the causal part fitted by Deriche is a sum of two damped
+/// sinusoids, each a pair of complex conjugate poles with their residues, from which
+/// transfer function is expanded. Coefficients are normalized to unit DC gain.
+/// \pre sigma >= 0.5
+inline auto make_recursive_gaussian(double sigma) -> recursive_gaussian_coefficients
+{
+    BOOST_ASSERT(sigma >= 0.5);
+    using complex_t = std::complex<double>;
+    complex_t const p0 = std::exp(complex_t(-1.783, 0.6318) / sigma);
+    complex_t const p1 = std::exp(complex_t(-1.723, 1.997) / sigma);
+    complex_t const poles[4] = {p0, std::conj(p0), p1, std::conj(p1)};
+    complex_t const residues[4] = {
+        complex_t(0.84, -1.8675), complex_t(0.84, 1.8675),
+        complex_t(-0.34015, 0.1299), complex_t(-0.34015, -0.1299)};
+
+    // Denominator is product of (1 - p * z^-1), numerator sum of residues times
+    // product over the other poles
+    complex_t denominator[5] = {1.0};
+    complex_t numerator[4] = {};
+    for (int k = 0; k < 4; ++k)
+    {
+        for (int i = k + 1; i > 0; --i)
+            denominator[i] -= poles[k] * denominator[i - 1];
+
+        complex_t term[4] = {residues[k]};
+        int degree = 0;
+        for (int j = 0; j < 4; ++j)
+        {
+            if (j == k)
+                continue;
+            ++degree;
+            for (int i = degree; i > 0; --i)
+                term[i] -= poles[j] * term[i - 1];
+        }
+        for (int i = 0; i < 4; ++i)
+            numerator[i] += term[i];
+    }
+
+    double n[4];
+    double m[4];
+    double d[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        n[i] = numerator[i].real();
+        d[i] = denominator[i + 1].real();
+    }
+    // Anticausal part excludes the center sample, counted once by the causal part
+    for (int i = 0; i < 3; ++i)
+        m[i] = n[i + 1] - d[i] * n[0];
+    m[3] = -d[3] * n[0];
+
+    double const poles_gain = 1.0 + d[0] + d[1] + d[2] + d[3];
+    double const causal_gain = (n[0] + n[1] + n[2] + n[3]) / poles_gain;
+    double const anticausal_gain = (m[0] + m[1] + m[2] + m[3]) / poles_gain;
+    double const scale = 1.0 / (causal_gain + anticausal_gain);
+
+    recursive_gaussian_coefficients c;
+    for (int i = 0; i < 4; ++i)
+    {
+        c.n[i] = static_cast<float>(n[i] * scale);
+        c.m[i] = static_cast<float>(m[i] * scale);
+        c.d[i] = static_cast<float>(d[i]);
+    }
+    c.causal_gain = static_cast<float>(causal_gain * scale);
+    c.anticausal_gain = static_cast<float>(anticausal_gain * scale);
+    return c;
+}
+
+/// \brief One step of fourth-order recursion over lanes,
+/// out = c[0] * x0 + ... + c[3] * x3 - d[0] * y1 - ... - d[3] * y4
+BOOST_FORCEINLINE
+void recursive_gaussian_step(
+    float* BOOST_RESTRICT out,
+    float const* BOOST_RESTRICT x0,
+    float const* BOOST_RESTRICT x1,
+    float const* BOOST_RESTRICT x2,
+    float const* BOOST_RESTRICT x3,
+    float const* BOOST_RESTRICT y1,
+    float const* BOOST_RESTRICT y2,
+    float const* BOOST_RESTRICT y3,
+    float const* BOOST_RESTRICT y4,
+    float const* c,
+    float const* d,
+    std::ptrdiff_t lanes)
+{
+    float const c0 = c[0], c1 = c[1], c2 = c[2], c3 = c[3];
+    float const d0 = d[0], d1 = d[1], d2 = d[2], d3 = d[3];
+    for (std::ptrdiff_t l = 0; l < lanes; ++l)
+    {
+        out[l] = c0 * x0[l] + c1 * x1[l] + c2 * x2[l] + c3 * x3[l] -
+                 (d0 * y1[l] + d1 * y2[l] + d2 * y3[l] + d3 * y4[l]);
+    }
+}
+
+/// \brief Filters independent signals by causal and anticausal recursive passes
+///
+/// Sample i of signal l is at offset i * stride + l of input and output, for l in
+/// [0, lanes), so every step of the recursion processes all lanes at once and vectorizes.
+/// Signals are extended by replicating their first and last samples, for which both
+/// parts start from their exact steady state.
+/// \param scratch Buffer of at least 6 * lanes samples.
+inline void recursive_gaussian_lanes(
+    float const* src,
+    float* dst,
+    std::ptrdiff_t size,
+    std::ptrdiff_t stride,
+    std::ptrdiff_t lanes,
+    recursive_gaussian_coefficients const& c,
+    float* scratch)
+{
+    if (size == 0)
+        return;
+
+    auto x = [&](std::ptrdiff_t i) {
+        return src + (std::min)((std::max)(i, std::ptrdiff_t(0)), size - 1) * stride;
+    };
+
+    // Causal part into output, outputs before the signal are in steady state
+    float* steady = scratch;
+    for (std::ptrdiff_t l = 0; l < lanes; ++l)
+        steady[l] = c.causal_gain * src[l];
+    auto causal = [&](std::ptrdiff_t i) -> float const* {
+        return i >= 0 ? dst + i * stride : steady;
+    };
+    for (std::ptrdiff_t i = 0; i < size; ++i)
+    {
+        recursive_gaussian_step(dst + i * stride, x(i), x(i - 1), x(i - 2), x(i - 3),
+            causal(i - 1), causal(i - 2), causal(i - 3), causal(i - 4), c.n, c.d, lanes);
+    }
+
+    // Anticausal part added to output, its last four outputs kept in ring of five rows
+    float* ring = scratch + lanes;
+    float const* last = x(size - 1);
+    for (std::ptrdiff_t l = 0; l < lanes; ++l)
+        ring[l] = c.anticausal_gain * last[l];
+    for (int k = 1; k < 5; ++k)
+        std::copy(ring, ring + lanes, ring + k * lanes);
+    auto anticausal = [&](std::ptrdiff_t i) { return ring + (i % 5) * lanes; };
+    for (std::ptrdiff_t i = size - 1; i >= 0; --i)
+    {
+        float* y = anticausal(i);
+        recursive_gaussian_step(y, x(i + 1), x(i + 2), x(i + 3), x(i + 4),
+            anticausal(i + 1), anticausal(i + 2), anticausal(i + 3), anticausal(i + 4),
+            c.m, c.d, lanes);
+        float* out = dst + i * stride;
+        for (std::ptrdiff_t l = 0; l < lanes; ++l)
+            out[l] += y[l];
+    }
+}
+
+/// \brief Assigns row of filtered samples to row of single-channel view,
+/// rounded and clamped for integer channels
+template <typename DstView>
+void store_rounded_row(DstView const& dst_view, std::ptrdiff_t y, float const* row)
+{
+    using dst_channel_t = typename channel_type<DstView>::type;
+    using dst_base_t = typename base_channel_type<dst_channel_t>::type;
+    auto it = dst_view.row_begin(y);
+    if (std::is_integral<dst_base_t>::value)
+    {
+        float const lowest = static_cast<float>(channel_traits<dst_channel_t>::min_value());
+        float const highest = static_cast<float>(channel_traits<dst_channel_t>::max_value());
+        for (std::ptrdiff_t x = 0; x < dst_view.width(); ++x)
+        {
+            float const v = (std::min)((std::max)(std::floor(row[x] + 0.5f), lowest), highest);
+            it[x] = dst_channel_t(static_cast<dst_base_t>(v));
+        }
+    }
+    else
+    {
+        for (std::ptrdiff_t x = 0; x < dst_view.width(); ++x)
+            it[x] = dst_channel_t(static_cast<dst_base_t>(row[x]));
+    }
+}
+
+/// \brief Gaussian blur of single-channel view by recursive filter along rows and columns
+///
+/// Rows are filtered in strips, transposed so that rows of the strip are lanes of the
+/// recursion; columns are filtered over whole rows of the intermediate plane as lanes.
 template <typename SrcView, typename DstView>
-void filter_median_impl(SrcView const& src_view, DstView const& dst_view, std::size_t kernel_size)
+void gaussian_blur_recursive(
+    SrcView const& src_view,
+    DstView const& dst_view,
+    recursive_gaussian_coefficients const& c,
+    std::vector<float>& plane,
+    std::vector<float>& filtered)
 {
-    std::size_t half_kernel_size = kernel_size / 2;
+    std::ptrdiff_t const width = src_view.width();
+    std::ptrdiff_t const height = src_view.height();
+    constexpr std::ptrdiff_t strip_size = 16;
 
-    // deciding output channel type and creating functor
-    using src_channel_t = typename channel_type<SrcView>::type;
+    std::vector<float> strip(static_cast<std::size_t>(width * strip_size));
+    std::vector<float> filtered_strip(strip.size());
+    std::vector<float> scratch(static_cast<std::size_t>(6 * (std::max)(width, strip_size)));
+    for (std::ptrdiff_t y0 = 0; y0 < height; y0 += strip_size)
+    {
+        std::ptrdiff_t const lanes = (std::min)(strip_size, height - y0);
+        for (std::ptrdiff_t r = 0; r < lanes; ++r)
+        {
+            auto it = src_view.row_begin(y0 + r);
+            float* column = strip.data() + r;
+            for (std::ptrdiff_t x = 0; x < width; ++x)
+                column[x * strip_size] = static_cast<float>(at_c<0>(it[x]));
+        }
+        recursive_gaussian_lanes(
+            strip.data(), filtered_strip.data(), width, strip_size, lanes, c, scratch.data());
+        for (std::ptrdiff_t r = 0; r < lanes; ++r)
+        {
+            float const* column = filtered_strip.data() + r;
+            float* out = plane.data() + (y0 + r) * width;
+            for (std::ptrdiff_t x = 0; x < width; ++x)
+                out[x] = column[x * strip_size];
+        }
+    }
 
-    std::vector<src_channel_t> values;
-    values.reserve(kernel_size * kernel_size);
+    recursive_gaussian_lanes(
+        plane.data(), filtered.data(), height, width, width, c, scratch.data());
+    for (std::ptrdiff_t y = 0; y < height; ++y)
+        store_rounded_row(dst_view, y, filtered.data() + y * width);
+}
+
+/// \brief Sampled Gaussian of given sigma truncated at four sigma, normalized to unit sum
+inline auto make_gaussian_weights(double sigma) -> std::vector<float>
+{
+    auto const radius = static_cast<std::ptrdiff_t>(std::ceil(4.0 * sigma));
+    std::vector<double> weights(static_cast<std::size_t>(2 * radius + 1));
+    for (std::ptrdiff_t i = -radius; i <= radius; ++i)
+    {
+        double const x = static_cast<double>(i);
+        weights[static_cast<std::size_t>(i + radius)] = std::exp(-x * x / (2.0 * sigma * sigma));
+    }
+    double const sum = std::accumulate(weights.begin(), weights.end(), 0.0);
+    std::vector<float> result;
+    for (double w : weights)
+        result.push_back(static_cast<float>(w / sum));
+    return result;
+}
+
+/// \brief Gaussian blur of single-channel view by separable convolution,
+/// with view extended by replicating border samples
+template <typename SrcView, typename DstView>
+void gaussian_blur_fir(
+    SrcView const& src_view,
+    DstView const& dst_view,
+    std::vector<float> const& weights,
+    std::vector<float>& plane)
+{
+    std::ptrdiff_t const width = src_view.width();
+    std::ptrdiff_t const height = src_view.height();
+    auto const k = static_cast<std::ptrdiff_t>(weights.size());
+    std::ptrdiff_t const radius = k / 2;
+
+    std::vector<float> extended(static_cast<std::size_t>(width + k - 1));
+    for (std::ptrdiff_t y = 0; y < height; ++y)
+    {
+        load_extended_row(
+            src_view, y, radius, radius, boundary_option::extend_constant, extended.data());
+        float* out = plane.data() + y * width;
+        std::fill_n(out, width, 0.0f);
+        for (std::ptrdiff_t i = 0; i < k; ++i)
+        {
+            accumulate_weighted_row(
+                extended.data() + i, weights[static_cast<std::size_t>(i)], out, width);
+        }
+    }
+
+    std::vector<float> acc(static_cast<std::size_t>(width));
+    for (std::ptrdiff_t y = 0; y < height; ++y)
+    {
+        std::fill(acc.begin(), acc.end(), 0.0f);
+        for (std::ptrdiff_t i = 0; i < k; ++i)
+        {
+            std::ptrdiff_t const sy =
+                (std::min)((std::max)(y - radius + i, std::ptrdiff_t(0)), height - 1);
+            accumulate_weighted_row(
+                plane.data() + sy * width, weights[static_cast<std::size_t>(i)], acc.data(), width);
+        }
+        store_rounded_row(dst_view, y, acc.data());
+    }
+}
+
+} // namespace detail
+
+/// \brief Blurs image with Gaussian of given standard deviation
+///
+/// Image is extended by replicating its border pixels. Recursive filter of Deriche,
+/// applied along rows and then columns, costs the same per pixel for any sigma and
+/// approximates the Gaussian to within 0.1 percent of its peak. Separable convolution
+/// with sampled Gaussian truncated at four sigma costs more with growing sigma;
+/// automatic method uses it for sigma below 2, where it is cheaper. Recursive filter
+/// is defined for sigma of 0.5 and more, smaller sigma always uses convolution.
+/// Results of integer channels are rounded to nearest. Source and destination
+/// may be the same view.
+/// \param sigma - Standard deviation of Gaussian in pixels, must be positive.
+template <typename SrcView, typename DstView>
+void gaussian_blur(
+    SrcView const& src_view,
+    DstView const& dst_view,
+    double sigma,
+    gaussian_blur_method method = gaussian_blur_method::automatic)
+{
+    gil_function_requires<ImageViewConcept<SrcView>>();
+    gil_function_requires<MutableImageViewConcept<DstView>>();
+    static_assert(color_spaces_are_compatible
+    <
+        typename color_space_type<SrcView>::type,
+        typename color_space_type<DstView>::type
+    >::value, "Source and destination views must have pixels with the same color space");
+
+    BOOST_ASSERT(src_view.dimensions() == dst_view.dimensions());
+    BOOST_ASSERT(sigma > 0.0);
+
+    bool const use_fir = sigma < 0.5 || method == gaussian_blur_method::fir ||
+                         (method == gaussian_blur_method::automatic && sigma < 2.0);
+
+    std::vector<float> plane(static_cast<std::size_t>(src_view.width() * src_view.height()));
+    std::vector<float> filtered;
+    detail::recursive_gaussian_coefficients coefficients;
+    std::vector<float> weights;
+    if (use_fir)
+        weights = detail::make_gaussian_weights(sigma);
+    else
+    {
+        coefficients = detail::make_recursive_gaussian(sigma);
+        filtered.resize(plane.size());
+    }
+
+    for (std::size_t i = 0; i < src_view.num_channels(); i++)
+    {
+        auto const src_channel = nth_channel_view(src_view, static_cast<int>(i));
+        auto const dst_channel = nth_channel_view(dst_view, static_cast<int>(i));
+        if (use_fir)
+            detail::gaussian_blur_fir(src_channel, dst_channel, weights, plane);
+        else
+            detail::gaussian_blur_recursive(
+                src_channel, dst_channel, coefficients, plane, filtered);
+    }
+}
+
+
+namespace detail
+{
+
+/// \brief Compare-exchange pairs of selection network, after which median is at given index
+struct median_network
+{
+    std::uint8_t const (*pairs)[2];
+    std::size_t size;
+    std::size_t median;
+};
+
+/// \brief Network selecting median of 9 samples, after Paeth
+inline auto median_network_3x3() -> median_network
+{
+    static std::uint8_t const pairs[][2] =
+    {
+        {1, 2}, {4, 5}, {7, 8}, {0, 1}, {3, 4}, {6, 7},
+        {1, 2}, {4, 5}, {7, 8}, {0, 3}, {5, 8}, {4, 7},
+        {3, 6}, {1, 4}, {2, 5}, {4, 7}, {4, 2}, {6, 4},
+        {4, 2}
+    };
+    return median_network{pairs, sizeof(pairs) / sizeof(pairs[0]), 4};
+}
+
+/// \brief Network selecting median of 25 samples, after Devillard
+inline auto median_network_5x5() -> median_network
+{
+    static std::uint8_t const pairs[][2] =
+    {
+        {0, 1}, {3, 4}, {2, 4}, {2, 3}, {6, 7}, {5, 7},
+        {5, 6}, {9, 10}, {8, 10}, {8, 9}, {12, 13}, {11, 13},
+        {11, 12}, {15, 16}, {14, 16}, {14, 15}, {18, 19}, {17, 19},
+        {17, 18}, {21, 22}, {20, 22}, {20, 21}, {23, 24}, {2, 5},
+        {3, 6}, {0, 6}, {0, 3}, {4, 7}, {1, 7}, {1, 4},
+        {11, 14}, {8, 14}, {8, 11}, {12, 15}, {9, 15}, {9, 12},
+        {13, 16}, {10, 16}, {10, 13}, {20, 23}, {17, 23}, {17, 20},
+        {21, 24}, {18, 24}, {18, 21}, {19, 22}, {8, 17}, {9, 18},
+        {0, 18}, {0, 9}, {10, 19}, {1, 19}, {1, 10}, {11, 20},
+        {2, 20}, {2, 11}, {12, 21}, {3, 21}, {3, 12}, {13, 22},
+        {4, 22}, {4, 13}, {14, 23}, {5, 23}, {5, 14}, {15, 24},
+        {6, 24}, {6, 15}, {7, 16}, {7, 19}, {13, 21}, {15, 23},
+        {7, 13}, {7, 15}, {1, 9}, {3, 11}, {5, 17}, {11, 17},
+        {9, 17}, {4, 10}, {6, 12}, {7, 14}, {4, 6}, {4, 7},
+        {12, 14}, {10, 14}, {6, 7}, {10, 12}, {6, 10}, {6, 17},
+        {12, 17}, {7, 17}, {7, 10}, {12, 18}, {7, 12}, {10, 18},
+        {12, 20}, {10, 20}, {10, 12}
+    };
+    return median_network{pairs, sizeof(pairs) / sizeof(pairs[0]), 12};
+}
+
+/// \brief Element-wise compare-exchange of two arrays of samples
+///
+/// Fixed number of elements lets the loop vectorize even at low optimization levels.
+template <std::ptrdiff_t Size, typename Sample>
+void median_compare_exchange(Sample* BOOST_RESTRICT a, Sample* BOOST_RESTRICT b)
+{
+    for (std::ptrdiff_t i = 0; i < Size; i++)
+    {
+        Sample const lo = (std::min)(a[i], b[i]);
+        b[i] = (std::max)(a[i], b[i]);
+        a[i] = lo;
+    }
+}
+
+/// \brief Median filter of single-channel view by selection network for 3x3 and 5x5 windows
+///
+/// The network is applied to blocks of pixels of a row at once: every window position
+/// is an array of samples of consecutive pixels and every compare-exchange is
+/// element-wise minimum and maximum of two arrays, which the compiler vectorizes.
+template <typename Sample, typename SrcView, typename DstView>
+void filter_median_network(SrcView const& src_view, DstView const& dst_view, std::ptrdiff_t k)
+{
+    using dst_channel_t = typename channel_type<DstView>::type;
+    BOOST_ASSERT(k == 3 || k == 5);
+
+    // Blocks are processed whole, samples past the end of a short block are stale and discarded
+    constexpr std::ptrdiff_t block_size = 128;
+    median_network const network = k == 3 ? median_network_3x3() : median_network_5x5();
+    std::ptrdiff_t const half = k / 2;
+    extended_row_ring<Sample, SrcView> ring(src_view, k, half, k - 1 - half);
+    std::vector<Sample> block(static_cast<std::size_t>(k * k * block_size));
+    std::vector<Sample const*> rows(static_cast<std::size_t>(k));
 
     for (std::ptrdiff_t y = 0; y < src_view.height(); y++)
     {
-        typename DstView::x_iterator dst_it = dst_view.row_begin(y);
+        for (std::ptrdiff_t i = 0; i < k; i++)
+            rows[static_cast<std::size_t>(i)] = ring.row(y - half + i);
 
-        for (std::ptrdiff_t x = 0; x < src_view.width(); x++)
+        auto dst_it = dst_view.row_begin(y);
+        for (std::ptrdiff_t x0 = 0; x0 < src_view.width(); x0 += block_size)
         {
-            auto sub_view = subimage_view(
-                src_view,
-                x - half_kernel_size, y - half_kernel_size,
-                kernel_size,
-                kernel_size
-            );
-            values.assign(sub_view.begin(), sub_view.end());
+            std::ptrdiff_t const n = (std::min)(block_size, src_view.width() - x0);
+            for (std::ptrdiff_t i = 0; i < k * k; i++)
+            {
+                Sample const* src = rows[static_cast<std::size_t>(i / k)] + x0 + i % k;
+                std::copy(src, src + n, block.begin() + i * block_size);
+            }
 
-            std::nth_element(values.begin(), values.begin() + (values.size() / 2), values.end());
-            dst_it[x] = values[values.size() / 2];
+            for (std::size_t p = 0; p < network.size; p++)
+            {
+                median_compare_exchange<block_size>(
+                    block.data() + network.pairs[p][0] * block_size,
+                    block.data() + network.pairs[p][1] * block_size);
+            }
+
+            Sample const* median = block.data() + static_cast<std::ptrdiff_t>(network.median) * block_size;
+            for (std::ptrdiff_t i = 0; i < n; i++)
+                dst_it[x0 + i] = dst_channel_t(median[i]);
         }
     }
 }
+
+/// \brief Median filter of single-channel 8-bit view in constant time per pixel
+///
+/// Implements Perreault and Hebert algorithm: every column keeps histogram of its
+/// kernel_size samples, updated by one sample removed and one added per row, and
+/// histogram of the window is updated by one column histogram removed and one added
+/// per pixel. Histograms have two levels, 16 coarse bins over 256 fine bins, so the
+/// median is found by scanning at most 32 bins. Updates of whole histograms are plain
+/// loops over arrays, which the compiler vectorizes.
+template <typename SrcView, typename DstView>
+void filter_median_histogram_8bit(SrcView const& src_view, DstView const& dst_view, std::ptrdiff_t k)
+{
+    using dst_channel_t = typename channel_type<DstView>::type;
+
+    std::ptrdiff_t const width = src_view.width();
+    std::ptrdiff_t const height = src_view.height();
+    std::ptrdiff_t const half = k / 2;
+    std::uint16_t const rank = static_cast<std::uint16_t>(k * k / 2);
+
+    // Rows are read through the ring, so rows leaving the window are not read back from
+    // source, which may be destination already filtered
+    extended_row_ring<std::uint8_t, SrcView> ring(src_view, k, 0, 0);
+    std::vector<std::uint16_t> column_fine(static_cast<std::size_t>(width * 256), 0);
+    std::vector<std::uint16_t> column_coarse(static_cast<std::size_t>(width * 16), 0);
+    std::uint16_t fine[256];
+    std::uint16_t coarse[16];
+
+    auto clamp = [](std::ptrdiff_t v, std::ptrdiff_t size) -> std::ptrdiff_t {
+        return v < 0 ? 0 : (v >= size ? size - 1 : v);
+    };
+    auto update_columns = [&](std::ptrdiff_t y, bool add) {
+        std::uint8_t const* row = ring.row(y);
+        for (std::ptrdiff_t x = 0; x < width; x++)
+        {
+            std::size_t const v = row[x];
+            std::size_t const column = static_cast<std::size_t>(x);
+            if (add)
+            {
+                ++column_fine[column * 256 + v];
+                ++column_coarse[column * 16 + (v >> 4)];
+            }
+            else
+            {
+                --column_fine[column * 256 + v];
+                --column_coarse[column * 16 + (v >> 4)];
+            }
+        }
+    };
+    auto update_window = [&](std::ptrdiff_t x, bool add) {
+        std::size_t const column = static_cast<std::size_t>(clamp(x, width));
+        std::uint16_t const* BOOST_RESTRICT column_fine_it = column_fine.data() + column * 256;
+        std::uint16_t const* BOOST_RESTRICT column_coarse_it = column_coarse.data() + column * 16;
+        if (add)
+        {
+            for (std::size_t i = 0; i < 256; i++)
+                fine[i] = static_cast<std::uint16_t>(fine[i] + column_fine_it[i]);
+            for (std::size_t i = 0; i < 16; i++)
+                coarse[i] = static_cast<std::uint16_t>(coarse[i] + column_coarse_it[i]);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < 256; i++)
+                fine[i] = static_cast<std::uint16_t>(fine[i] - column_fine_it[i]);
+            for (std::size_t i = 0; i < 16; i++)
+                coarse[i] = static_cast<std::uint16_t>(coarse[i] - column_coarse_it[i]);
+        }
+    };
+
+    for (std::ptrdiff_t i = 0; i < k; i++)
+        update_columns(i - half, true);
+
+    for (std::ptrdiff_t y = 0; y < height; y++)
+    {
+        if (y > 0)
+        {
+            // Row leaving the window is removed before the entering one replaces it in ring
+            update_columns(y - half - 1, false);
+            update_columns(y - half + k - 1, true);
+        }
+
+        std::fill_n(fine, 256, std::uint16_t(0));
+        std::fill_n(coarse, 16, std::uint16_t(0));
+        for (std::ptrdiff_t i = 0; i < k; i++)
+            update_window(i - half, true);
+
+        auto dst_it = dst_view.row_begin(y);
+        for (std::ptrdiff_t x = 0; x < width; x++)
+        {
+            std::uint16_t count = 0;
+            std::size_t bin = 0;
+            while (count + coarse[bin] <= rank)
+                count = static_cast<std::uint16_t>(count + coarse[bin++]);
+            bin *= 16;
+            while (count + fine[bin] <= rank)
+                count = static_cast<std::uint16_t>(count + fine[bin++]);
+            dst_it[x] = dst_channel_t(static_cast<std::uint8_t>(bin));
+
+            // Columns clamped to the same border column cancel out
+            std::ptrdiff_t const leaving = x - half;
+            std::ptrdiff_t const entering = x - half + k;
+            if (x + 1 < width && clamp(leaving, width) != clamp(entering, width))
+            {
+                update_window(leaving, false);
+                update_window(entering, true);
+            }
+        }
+    }
+}
+
+/// \brief Median filter of single-channel 16-bit view with two-level histogram of window
+///
+/// Histogram of 256 coarse bins over 65536 fine bins is updated by samples of one column
+/// leaving and one entering the window per pixel, so the cost grows linearly, not
+/// quadratically, with window size, and the median is found by scanning at most
+/// 512 bins. Histogram is emptied at the end of every row, instead of being cleared.
+template <typename SrcView, typename DstView>
+void filter_median_histogram_16bit(SrcView const& src_view, DstView const& dst_view, std::ptrdiff_t k)
+{
+    using dst_channel_t = typename channel_type<DstView>::type;
+
+    std::ptrdiff_t const width = src_view.width();
+    std::ptrdiff_t const half = k / 2;
+    std::uint32_t const rank = static_cast<std::uint32_t>(k * k / 2);
+
+    extended_row_ring<std::uint16_t, SrcView> ring(src_view, k, half, k - 1 - half);
+    std::vector<std::uint16_t> fine(65536, 0);
+    std::vector<std::uint16_t> coarse(256, 0);
+    std::vector<std::uint16_t const*> rows(static_cast<std::size_t>(k));
+
+    auto update_window = [&](std::ptrdiff_t column, bool add) {
+        for (auto row : rows)
+        {
+            std::uint16_t const v = row[column];
+            if (add)
+            {
+                ++fine[v];
+                ++coarse[v >> 8];
+            }
+            else
+            {
+                --fine[v];
+                --coarse[v >> 8];
+            }
+        }
+    };
+
+    for (std::ptrdiff_t y = 0; y < src_view.height(); y++)
+    {
+        for (std::ptrdiff_t i = 0; i < k; i++)
+            rows[static_cast<std::size_t>(i)] = ring.row(y - half + i);
+
+        for (std::ptrdiff_t i = 0; i < k; i++)
+            update_window(i, true);
+
+        auto dst_it = dst_view.row_begin(y);
+        for (std::ptrdiff_t x = 0; x < width; x++)
+        {
+            std::uint32_t count = 0;
+            std::size_t bin = 0;
+            while (count + coarse[bin] <= rank)
+                count += coarse[bin++];
+            bin *= 256;
+            while (count + fine[bin] <= rank)
+                count += fine[bin++];
+            dst_it[x] = dst_channel_t(static_cast<std::uint16_t>(bin));
+
+            if (x + 1 < width)
+            {
+                update_window(x, false);
+                update_window(x + k, true);
+            }
+        }
+
+        for (std::ptrdiff_t i = width - 1; i < width - 1 + k; i++)
+            update_window(i, false);
+    }
+}
+
+/// \brief Median filter of single-channel view of any channel type by partial sorting
+template <typename Sample, typename SrcView, typename DstView>
+void filter_median_select(SrcView const& src_view, DstView const& dst_view, std::ptrdiff_t k)
+{
+    using dst_channel_t = typename channel_type<DstView>::type;
+
+    std::ptrdiff_t const half = k / 2;
+    extended_row_ring<Sample, SrcView> ring(src_view, k, half, k - 1 - half);
+    std::vector<Sample const*> rows(static_cast<std::size_t>(k));
+    std::vector<Sample> values(static_cast<std::size_t>(k * k));
+    auto const middle = values.begin() + static_cast<std::ptrdiff_t>(values.size() / 2);
+    for (std::ptrdiff_t y = 0; y < src_view.height(); y++)
+    {
+        for (std::ptrdiff_t i = 0; i < k; i++)
+            rows[static_cast<std::size_t>(i)] = ring.row(y - half + i);
+
+        auto dst_it = dst_view.row_begin(y);
+        for (std::ptrdiff_t x = 0; x < src_view.width(); x++)
+        {
+            auto it = values.begin();
+            for (auto row : rows)
+                it = std::copy(row + x, row + x + k, it);
+            std::nth_element(values.begin(), middle, values.end());
+            dst_it[x] = dst_channel_t(*middle);
+        }
+    }
+}
+
+template <typename SrcView, typename DstView>
+void filter_median_impl(SrcView const& src_view, DstView const& dst_view, std::size_t kernel_size)
+{
+    using src_channel_t = typename channel_type<SrcView>::type;
+    using sample_t = typename base_channel_type<src_channel_t>::type;
+
+    std::ptrdiff_t const k = static_cast<std::ptrdiff_t>(kernel_size);
+    bool const is_unsigned = std::is_integral<sample_t>::value && !std::is_signed<sample_t>::value;
+    // Window histogram counts are 16-bit
+    bool const fits_histogram = k * k <= 65535;
+
+    if (k == 3 || k == 5)
+        filter_median_network<sample_t>(src_view, dst_view, k);
+    else if (is_unsigned && sizeof(sample_t) == 1 && fits_histogram)
+        filter_median_histogram_8bit(src_view, dst_view, k);
+    else if (is_unsigned && sizeof(sample_t) == 2 && fits_histogram)
+        filter_median_histogram_16bit(src_view, dst_view, k);
+    else
+        filter_median_select<sample_t>(src_view, dst_view, k);
+}
 } // namespace detail
 
+/// \brief Replaces every sample by median of square window of samples around it
+///
+/// Border samples are replicated for windows crossing the image border.
+/// 3x3 and 5x5 windows use selection networks, larger windows over 8-bit and 16-bit
+/// channels use sliding histograms, with cost independent of or linear in kernel size.
 template <typename SrcView, typename DstView>
 void median_filter(SrcView const& src_view, DstView const& dst_view, std::size_t kernel_size)
 {
@@ -111,25 +981,17 @@ void median_filter(SrcView const& src_view, DstView const& dst_view, std::size_t
         typename color_space_type<DstView>::type
     >::value, "Source and destination views must have pixels with the same color space");
 
-    std::size_t half_kernel_size = kernel_size / 2;
-    auto extended_img = extend_boundary(
-        src_view,
-        half_kernel_size,
-        boundary_option::extend_constant
-    );
-    auto extended_view = subimage_view(
-            view(extended_img),
-            half_kernel_size,
-            half_kernel_size,
-            src_view.width(),
-            src_view.height()
-        );
+    BOOST_ASSERT(src_view.dimensions() == dst_view.dimensions());
+    BOOST_ASSERT(kernel_size != 0);
+
+    if (src_view.width() == 0 || src_view.height() == 0)
+        return;
 
-    for (std::size_t channel = 0; channel < extended_view.num_channels(); channel++)
+    for (std::size_t channel = 0; channel < src_view.num_channels(); channel++)
     {
         detail::filter_median_impl(
-            nth_channel_view(extended_view, channel),
-            nth_channel_view(dst_view, channel),
+            nth_channel_view(src_view, static_cast<int>(channel)),
+            nth_channel_view(dst_view, static_cast<int>(channel)),
             kernel_size
         );
     }
@@ -8,9 +8,22 @@
 #ifndef BOOST_GIL_IMAGE_PROCESSING_HARRIS_HPP
 #define BOOST_GIL_IMAGE_PROCESSING_HARRIS_HPP
 
+#include <boost/gil/execution.hpp>
 #include <boost/gil/image_view.hpp>
+#include <boost/gil/point.hpp>
 #include <boost/gil/typedefs.hpp>
+#include <boost/gil/extension/numeric/convolve.hpp>
 #include <boost/gil/extension/numeric/kernel.hpp>
+#include <boost/gil/image_processing/stencil.hpp>
+
+#include <boost/config.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 namespace boost { namespace gil {
 /// \defgroup CornerDetectionAlgorithms
@@ -20,6 +33,36 @@ namespace boost { namespace gil {
 /// sliding the window will produce large intensity change
 
 
+namespace detail {
+
+/// \brief Harris response of windows of the three structure tensor entries
+template <typename T>
+struct harris_response_fn
+{
+    std::vector<T> const* weights;
+    float k;
+
+    template <typename Window0, typename Window1, typename Window2>
+    auto operator()(Window0 const& m11, Window1 const& m12_21, Window2 const& m22) const
+        -> gray32f_pixel_t
+    {
+        float ddxx = 0;
+        float dxdy = 0;
+        float ddyy = 0;
+        for (std::size_t i = 0; i < m11.size(); ++i)
+        {
+            ddxx += at_c<0>(m11[i]) * (*weights)[i];
+            dxdy += at_c<0>(m12_21[i]) * (*weights)[i];
+            ddyy += at_c<0>(m22[i]) * (*weights)[i];
+        }
+        auto det = (ddxx * ddyy) - dxdy * dxdy;
+        auto trace = ddxx + ddyy;
+        return gray32f_pixel_t(det - k * trace * trace);
+    }
+};
+
+} // namespace detail
+
 /// \brief function to record Harris responses
 /// \ingroup CornerDetectionAlgorithms
 ///
@@ -30,6 +73,8 @@ namespace boost { namespace gil {
 /// to compute sum of corresponding entries. k is a discrimination
 /// constant against edges (usually in range 0.04 to 0.06).
 /// harris_response is an out parameter that will contain the Harris responses.
+/// Responses are computed by apply_stencil, only for pixels which windows lie inside the
+/// image, others are left unchanged.
 template <typename T, typename Allocator>
 void compute_harris_responses(
     boost::gil::gray32f_view_t m11,
@@ -45,37 +90,345 @@ void compute_harris_responses(
     }
 
     std::ptrdiff_t const window_length = weights.size();
-    auto const width = m11.width();
-    auto const height = m11.height();
     auto const half_length = window_length / 2;
+    std::vector<point_t> offsets;
+    std::vector<T> window_weights;
+    for (std::ptrdiff_t y_kernel = 0; y_kernel < window_length; ++y_kernel)
+    {
+        for (std::ptrdiff_t x_kernel = 0; x_kernel < window_length; ++x_kernel)
+        {
+            offsets.emplace_back(x_kernel - half_length, y_kernel - half_length);
+            window_weights.push_back(weights.at(x_kernel, y_kernel));
+        }
+    }
+
+    apply_stencil(m11, m12_21, m22, harris_response, offsets,
+        detail::harris_response_fn<T>{&window_weights, k});
+}
+
+/// \brief Parameters of the Harris corner detector
+/// \ingroup CornerDetectionAlgorithms
+struct harris_corners_params
+{
+    /// Odd side length of the square window summing the structure tensor
+    std::size_t window_size = 5;
+    /// Standard deviation of Gaussian window, zero selects uniform (box) window.
+    /// Either window is normalized to unit sum.
+    float window_sigma = 0.0f;
+    /// Discrimination constant against edges, usually in range 0.04 to 0.06
+    float k = 0.04f;
+    /// Corners must have response strictly greater than the threshold
+    float threshold = 0.0f;
+    /// Corner must be the maximum of square neighbourhood of this radius
+    std::size_t suppression_radius = 1;
+    /// Number of strongest corners returned, zero returns all of them
+    std::size_t max_corners = 0;
+};
+
+/// \brief Corners found by harris_corners, ordered from the strongest
+/// \ingroup CornerDetectionAlgorithms
+struct harris_corners_result
+{
+    std::vector<point_t> points;
+    std::vector<float> scores;
+};
+
+namespace detail {
 
-    for (auto y = half_length; y < height - half_length; ++y)
+/// \brief Normalized one-dimensional window of Harris corner detector
+inline auto make_harris_window(harris_corners_params const& params) -> std::vector<float>
+{
+    if (params.window_size % 2 != 1)
+        throw std::invalid_argument("window size should be odd");
+
+    auto const half = static_cast<std::ptrdiff_t>(params.window_size / 2);
+    std::vector<float> window;
+    for (std::ptrdiff_t i = -half; i <= half; ++i)
     {
-        for (auto x = half_length; x < width - half_length; ++x)
+        float const x = static_cast<float>(i);
+        float const sigma = params.window_sigma;
+        window.push_back(sigma > 0.0f ? std::exp(-x * x / (2.0f * sigma * sigma)) : 1.0f);
+    }
+    float sum = 0.0f;
+    for (float w : window)
+        sum += w;
+    for (float& w : window)
+        w /= sum;
+    return window;
+}
+
+struct harris_corner
+{
+    point_t point;
+    float score;
+};
+
+/// \brief Strict order of corners, from the strongest, ties broken by position
+inline bool stronger_harris_corner(harris_corner const& a, harris_corner const& b)
+{
+    if (a.score > b.score)
+        return true;
+    if (a.score < b.score)
+        return false;
+    return a.point.y != b.point.y ? a.point.y < b.point.y : a.point.x < b.point.x;
+}
+
+/// \brief Streams rows of the view through the Harris pipeline and collects its corners
+///
+/// Every stage keeps only the rows the next stage still needs, in ring buffers:
+/// three rows of samples for the Sobel gradient, window size rows of horizontally
+/// summed tensor entries, and 2 * radius + 1 rows of responses for the non-maximum
+/// suppression. Responses exist for pixels whose gradient and window lie inside the
+/// view, [border, width - border) x [border, height - border). Rows of responses
+/// [y_begin, y_end) are searched for corners, rows around them needed by the suppression
+/// are recomputed, so that bands of rows are processed independently.
+template <typename SrcView>
+class harris_corner_stream
+{
+public:
+    harris_corner_stream(
+        SrcView const& src_view, std::vector<float> const& window, harris_corners_params params)
+        : src_view_(src_view)
+        , window_(window)
+        , params_(params)
+        , half_(static_cast<std::ptrdiff_t>(window.size() / 2))
+        , radius_(static_cast<std::ptrdiff_t>(params.suppression_radius))
+        , border_(half_ + 1)
+        , width_(src_view.width())
+        , response_width_(src_view.width() - 2 * border_)
+        , samples_(3 * static_cast<std::size_t>(width_))
+        , products_(3 * static_cast<std::size_t>(width_))
+        , tensor_(3 * window.size() * static_cast<std::size_t>(response_width_))
+        , sums_(3 * static_cast<std::size_t>(response_width_))
+        , responses_(static_cast<std::size_t>((2 * radius_ + 1) * response_width_))
+    {}
+
+    void find_corners(std::ptrdiff_t y_begin, std::ptrdiff_t y_end, std::vector<harris_corner>& out)
+    {
+        std::ptrdiff_t const first = (std::max)(border_, y_begin - radius_);
+        std::ptrdiff_t const last = (std::min)(src_view_.height() - border_, y_end + radius_);
+        next_sample_row_ = first - half_ - 1;
+        next_tensor_row_ = first - half_;
+        for (std::ptrdiff_t y = first; y < last + radius_; ++y)
         {
-            float ddxx = 0;
-            float dxdy = 0;
-            float ddyy = 0;
-            for (gil::gray32f_view_t::coord_t y_kernel = 0;
-                y_kernel < window_length;
-                ++y_kernel) {
-                for (gil::gray32f_view_t::coord_t x_kernel = 0;
-                    x_kernel < window_length;
-                    ++x_kernel) {
-                    ddxx += m11(x + x_kernel - half_length, y + y_kernel - half_length)
-                        .at(std::integral_constant<int, 0>{}) * weights.at(x_kernel, y_kernel);
-                    dxdy += m12_21(x + x_kernel - half_length, y + y_kernel - half_length)
-                        .at(std::integral_constant<int, 0>{}) * weights.at(x_kernel, y_kernel);
-                    ddyy += m22(x + x_kernel - half_length, y + y_kernel - half_length)
-                        .at(std::integral_constant<int, 0>{}) * weights.at(x_kernel, y_kernel);
+            if (y < last)
+                compute_response_row(y);
+
+            // Neighbourhood of row y - radius is complete
+            std::ptrdiff_t const center = y - radius_;
+            if (center >= y_begin && center < y_end)
+                suppress_row(center, first, last, out);
+        }
+    }
+
+private:
+    auto samples_row(std::ptrdiff_t y) -> float*
+    {
+        return samples_.data() + (y % 3) * width_;
+    }
+
+    auto tensor_row(std::ptrdiff_t y, std::ptrdiff_t entry) -> float*
+    {
+        auto const slot = y % static_cast<std::ptrdiff_t>(window_.size());
+        return tensor_.data() + (slot * 3 + entry) * response_width_;
+    }
+
+    auto response_row(std::ptrdiff_t y) -> float*
+    {
+        return responses_.data() + (y % (2 * radius_ + 1)) * response_width_;
+    }
+
+    void load_samples_row(std::ptrdiff_t y)
+    {
+        float* row = samples_row(y);
+        auto src_it = src_view_.row_begin(y);
+        for (std::ptrdiff_t x = 0; x < width_; ++x)
+            row[x] = static_cast<float>(at_c<0>(src_it[x]));
+    }
+
+    /// \brief Products of Sobel gradients of row y summed by the window along the row
+    void compute_tensor_row(std::ptrdiff_t y)
+    {
+        while (next_sample_row_ <= y + 1)
+            load_samples_row(next_sample_row_++);
+
+        std::ptrdiff_t const n = width_ - 2;
+        float const* BOOST_RESTRICT above = samples_row(y - 1);
+        float const* BOOST_RESTRICT middle = samples_row(y);
+        float const* BOOST_RESTRICT below = samples_row(y + 1);
+        float* BOOST_RESTRICT dxdx = products_.data();
+        float* BOOST_RESTRICT dxdy = dxdx + n;
+        float* BOOST_RESTRICT dydy = dxdy + n;
+        for (std::ptrdiff_t i = 0; i < n; ++i)
+        {
+            float const dx = (above[i + 2] - above[i]) + 2.0f * (middle[i + 2] - middle[i]) +
+                (below[i + 2] - below[i]);
+            float const dy = (below[i] - above[i]) + 2.0f * (below[i + 1] - above[i + 1]) +
+                (below[i + 2] - above[i + 2]);
+            dxdx[i] = dx * dx;
+            dxdy[i] = dx * dy;
+            dydy[i] = dy * dy;
+        }
+
+        for (std::ptrdiff_t entry = 0; entry < 3; ++entry)
+        {
+            float* sum = tensor_row(y, entry);
+            std::fill_n(sum, response_width_, 0.0f);
+            float const* products = products_.data() + entry * n;
+            for (std::size_t j = 0; j < window_.size(); ++j)
+            {
+                accumulate_weighted_row(
+                    products + static_cast<std::ptrdiff_t>(j), window_[j], sum, response_width_);
+            }
+        }
+    }
+
+    void compute_response_row(std::ptrdiff_t y)
+    {
+        while (next_tensor_row_ <= y + half_)
+            compute_tensor_row(next_tensor_row_++);
+
+        std::ptrdiff_t const n = response_width_;
+        std::fill(sums_.begin(), sums_.end(), 0.0f);
+        for (std::ptrdiff_t entry = 0; entry < 3; ++entry)
+        {
+            for (std::size_t j = 0; j < window_.size(); ++j)
+            {
+                std::ptrdiff_t const row = y - half_ + static_cast<std::ptrdiff_t>(j);
+                accumulate_weighted_row(
+                    tensor_row(row, entry), window_[j], sums_.data() + entry * n, n);
+            }
+        }
+
+        float const* BOOST_RESTRICT m11 = sums_.data();
+        float const* BOOST_RESTRICT m12 = m11 + n;
+        float const* BOOST_RESTRICT m22 = m12 + n;
+        float* BOOST_RESTRICT response = response_row(y);
+        float const k = params_.k;
+        for (std::ptrdiff_t i = 0; i < n; ++i)
+        {
+            float const det = m11[i] * m22[i] - m12[i] * m12[i];
+            float const trace = m11[i] + m22[i];
+            response[i] = det - k * trace * trace;
+        }
+    }
+
+    /// \brief Collects local maxima of row y, neighbour rows are limited to [first, last)
+    ///
+    /// Among equal responses, only the first in raster order is kept.
+    void suppress_row(
+        std::ptrdiff_t y, std::ptrdiff_t first, std::ptrdiff_t last,
+        std::vector<harris_corner>& out)
+    {
+        std::ptrdiff_t const y0 = (std::max)(first, y - radius_);
+        std::ptrdiff_t const y1 = (std::min)(last, y + radius_ + 1);
+        float const* row = response_row(y);
+        for (std::ptrdiff_t x = 0; x < response_width_; ++x)
+        {
+            float const score = row[x];
+            if (!(score > params_.threshold))
+                continue;
+
+            std::ptrdiff_t const x0 = (std::max)(std::ptrdiff_t(0), x - radius_);
+            std::ptrdiff_t const x1 = (std::min)(response_width_, x + radius_ + 1);
+            bool maximum = true;
+            for (std::ptrdiff_t ny = y0; maximum && ny < y1; ++ny)
+            {
+                float const* neighbours = response_row(ny);
+                for (std::ptrdiff_t nx = x0; nx < x1; ++nx)
+                {
+                    // Equal score suppresses corner only from earlier position
+                    bool const before = ny < y || (ny == y && nx < x);
+                    if (before ? neighbours[nx] >= score : neighbours[nx] > score)
+                    {
+                        maximum = false;
+                        break;
+                    }
                 }
             }
-            auto det = (ddxx * ddyy) - dxdy * dxdy;
-            auto trace = ddxx + ddyy;
-            auto harris_value = det - k * trace * trace;
-            harris_response(x, y).at(std::integral_constant<int, 0>{}) = harris_value;
+            if (maximum)
+                out.push_back({point_t(x + border_, y), score});
         }
     }
+
+    SrcView src_view_;
+    std::vector<float> const& window_;
+    harris_corners_params params_;
+    std::ptrdiff_t half_;
+    std::ptrdiff_t radius_;
+    std::ptrdiff_t border_;
+    std::ptrdiff_t width_;
+    std::ptrdiff_t response_width_;
+    std::ptrdiff_t next_sample_row_{0};
+    std::ptrdiff_t next_tensor_row_{0};
+    std::vector<float> samples_;
+    std::vector<float> products_;
+    std::vector<float> tensor_;
+    std::vector<float> sums_;
+    std::vector<float> responses_;
+};
+
+} // namespace detail
+
+/// \brief Finds corners of single-channel view by Harris detector
+/// \ingroup CornerDetectionAlgorithms
+///
+/// Gradients are computed by 3x3 Sobel operator from samples of the view, their
+/// products are summed by the separable window of params to form structure tensor,
+/// whose Harris response det - k * trace^2 must exceed threshold and be maximum of
+/// its suppression neighbourhood. All stages run in a single pass over the rows, each
+/// keeping only few rows, so no full-frame temporaries are allocated. Corners are
+/// detected only where the gradient and window lie inside the view. Bands of rows
+/// are processed in parallel according to the policy, results do not depend on it.
+template <typename ExecutionPolicy, typename SrcView>
+auto harris_corners(
+    ExecutionPolicy const& policy,
+    SrcView const& src_view,
+    harris_corners_params const& params = {})
+    -> typename std::enable_if
+    <
+        execution::is_execution_policy<ExecutionPolicy>::value,
+        harris_corners_result
+    >::type
+{
+    gil_function_requires<ImageViewConcept<SrcView>>();
+    static_assert(num_channels<SrcView>::value == 1, "Source view must have single channel");
+
+    std::vector<float> const window = detail::make_harris_window(params);
+    auto const border = static_cast<std::ptrdiff_t>(window.size() / 2) + 1;
+    std::ptrdiff_t const width = src_view.width() - 2 * border;
+    std::ptrdiff_t const height = src_view.height() - 2 * border;
+
+    std::vector<detail::harris_corner> corners;
+    if (width > 0 && height > 0)
+    {
+        detail::collect_strongest_in_row_bands(policy, width, height, params.max_corners,
+            detail::stronger_harris_corner,
+            [&](std::ptrdiff_t y_begin, std::ptrdiff_t y_end,
+                std::vector<detail::harris_corner>& band_corners) {
+                detail::harris_corner_stream<SrcView> stream(src_view, window, params);
+                stream.find_corners(y_begin + border, y_end + border, band_corners);
+            },
+            corners);
+    }
+    detail::keep_strongest(corners, params.max_corners, detail::stronger_harris_corner);
+    std::sort(corners.begin(), corners.end(), detail::stronger_harris_corner);
+
+    harris_corners_result result;
+    for (auto const& corner : corners)
+    {
+        result.points.push_back(corner.point);
+        result.scores.push_back(corner.score);
+    }
+    return result;
+}
+
+/// \overload
+template <typename SrcView>
+auto harris_corners(SrcView const& src_view, harris_corners_params const& params = {})
+    -> harris_corners_result
+{
+    return harris_corners(execution::seq, src_view, params);
 }
 
 }} //namespace boost::gil
@@ -8,13 +8,53 @@
 #ifndef BOOST_GIL_IMAGE_PROCESSING_HESSIAN_HPP
 #define BOOST_GIL_IMAGE_PROCESSING_HESSIAN_HPP
 
+#include <boost/gil/execution.hpp>
 #include <boost/gil/image_view.hpp>
+#include <boost/gil/point.hpp>
 #include <boost/gil/typedefs.hpp>
 #include <boost/gil/extension/numeric/kernel.hpp>
+#include <boost/gil/image_processing/stencil.hpp>
+#include <boost/gil/image_processing/summed_area_table.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 namespace boost { namespace gil {
 
+namespace detail {
+
+/// \brief Determinant of Hessian matrix of windows of entries ddxx, dxdy and ddyy
+template <typename Pixel, typename T>
+struct hessian_response_fn
+{
+    std::vector<T> const* weights;
+
+    template <typename Window0, typename Window1, typename Window2>
+    auto operator()(Window0 const& ddxx, Window1 const& dxdy, Window2 const& ddyy) const
+        -> Pixel
+    {
+        using channel_t = typename channel_type<Pixel>::type;
+        auto ddxx_i = channel_t();
+        auto ddyy_i = channel_t();
+        auto dxdy_i = channel_t();
+        for (std::size_t i = 0; i < ddxx.size(); ++i)
+        {
+            ddxx_i += at_c<0>(ddxx[i]) * (*weights)[i];
+            ddyy_i += at_c<0>(ddyy[i]) * (*weights)[i];
+            dxdy_i += at_c<0>(dxdy[i]) * (*weights)[i];
+        }
+        Pixel response;
+        at_c<0>(response) = ddxx_i * ddyy_i - dxdy_i * dxdy_i;
+        return response;
+    }
+};
+
+} // namespace detail
+
 /// \brief Computes Hessian response
 ///
 /// Computes Hessian response based on computed entries of Hessian matrix, e.g. second order
@@ -23,6 +63,8 @@ namespace boost { namespace gil {
 /// ddxx means taking two derivatives (gradients) in horizontal direction.
 /// Weights change perception of surroinding pixels.
 /// Additional filtering is strongly advised.
+/// Responses are computed by apply_stencil, only for pixels which windows lie inside the
+/// image, others are left unchanged.
 template <typename GradientView, typename T, typename Allocator, typename OutputView>
 inline void compute_hessian_responses(
     GradientView ddxx,
@@ -43,38 +85,258 @@ inline void compute_hessian_responses(
     // Use pixel type of output, as values will be written to output
     using pixel_t = typename std::remove_reference<decltype(std::declval<OutputView>()(0, 0))>::type;
 
-    using channel_t = typename std::remove_reference
-        <
-            decltype(std::declval<pixel_t>().at(std::integral_constant<int, 0>{}))
-        >::type;
+    auto center = static_cast<std::ptrdiff_t>(weights.center_y());
+    auto const size = static_cast<std::ptrdiff_t>(weights.size());
+    std::vector<point_t> offsets;
+    std::vector<T> window_weights;
+    for (std::ptrdiff_t w_y = 0; w_y < size; ++w_y)
+    {
+        for (std::ptrdiff_t w_x = 0; w_x < size; ++w_x)
+        {
+            offsets.emplace_back(w_x - center, w_y - center);
+            window_weights.push_back(weights.at(w_x, w_y));
+        }
+    }
+
+    apply_stencil(ddxx, dxdy, ddyy, dst, offsets,
+        detail::hessian_response_fn<pixel_t, T>{&window_weights});
+}
+
+/// \brief Parameters of the multi-scale Hessian blob detector
+struct hessian_blobs_params
+{
+    /// Number of octaves, each doubling the filter sizes and the sampling step
+    std::size_t octaves = 4;
+    /// Sampling step of responses of the first octave, in pixels
+    std::size_t initial_step = 2;
+    /// Blobs must have normalized Hessian determinant strictly greater than the threshold
+    float threshold = 0.0f;
+    /// Number of strongest blobs returned, zero returns all of them
+    std::size_t max_blobs = 0;
+};
+
+/// \brief Blob found by hessian_blobs
+struct hessian_keypoint
+{
+    /// Center of the blob, in pixels
+    point_t position;
+    /// Scale of the blob, standard deviation of Gaussian approximated by the box filter
+    float scale;
+    /// Normalized determinant of Hessian
+    float response;
+};
+
+namespace detail {
+
+/// \brief Side length of box filter of given interval of given octave, 9, 15, 21, 27 for the
+/// first octave, 15, 27, 39, 51 for the second and so on
+inline auto hessian_filter_size(std::size_t octave, std::size_t interval) -> std::ptrdiff_t
+{
+    return 3 * ((static_cast<std::ptrdiff_t>(interval) + 1) * (std::ptrdiff_t(2) << octave) + 1);
+}
+
+/// \brief Sum over rectangle [x0, x1) x [y0, y1), with samples outside of the table zero
+inline auto clamped_box_sum(
+    summed_area_table<> const& table,
+    std::ptrdiff_t x0, std::ptrdiff_t y0, std::ptrdiff_t x1, std::ptrdiff_t y1) -> double
+{
+    x0 = (std::max)(x0, std::ptrdiff_t(0));
+    y0 = (std::max)(y0, std::ptrdiff_t(0));
+    x1 = (std::min)(x1, table.width());
+    y1 = (std::min)(y1, table.height());
+    if (x0 >= x1 || y0 >= y1)
+        return 0.0;
+    return (table.at(x1, y1) + table.at(x0, y0)) - (table.at(x1, y0) + table.at(x0, y1));
+}
+
+/// \brief Determinant of Hessian approximated by box filters of given size centered at (x, y)
+///
+/// Second derivatives of Gaussian are approximated by box filters of Bay et al. (SURF),
+/// normalized by the filter area. Relative weight 0.9 of the mixed derivative compensates
+/// for the approximation.
+inline auto hessian_box_response(
+    summed_area_table<> const& table, std::ptrdiff_t x, std::ptrdiff_t y, std::ptrdiff_t size)
+    -> float
+{
+    std::ptrdiff_t const lobe = size / 3;
+    std::ptrdiff_t const half = (size - 1) / 2;
+    auto box = [&](std::ptrdiff_t x0, std::ptrdiff_t y0, std::ptrdiff_t w, std::ptrdiff_t h) {
+        return clamped_box_sum(table, x0, y0, x0 + w, y0 + h);
+    };
+
+    double const dxx = box(x - half, y - lobe + 1, size, 2 * lobe - 1)
+        - 3.0 * box(x - lobe / 2, y - lobe + 1, lobe, 2 * lobe - 1);
+    double const dyy = box(x - lobe + 1, y - half, 2 * lobe - 1, size)
+        - 3.0 * box(x - lobe + 1, y - lobe / 2, 2 * lobe - 1, lobe);
+    double const dxy = box(x + 1, y - lobe, lobe, lobe) + box(x - lobe, y + 1, lobe, lobe)
+        - box(x - lobe, y - lobe, lobe, lobe) - box(x + 1, y + 1, lobe, lobe);
+
+    double const inverse_area = 1.0 / static_cast<double>(size * size);
+    double const nxx = dxx * inverse_area;
+    double const nyy = dyy * inverse_area;
+    double const nxy = dxy * inverse_area;
+    return static_cast<float>(nxx * nyy - 0.81 * nxy * nxy);
+}
+
+/// \brief Strict order of keypoints, from the strongest, ties broken by position and scale
+inline bool stronger_hessian_keypoint(hessian_keypoint const& a, hessian_keypoint const& b)
+{
+    if (a.response > b.response)
+        return true;
+    if (a.response < b.response)
+        return false;
+    if (a.position.y != b.position.y)
+        return a.position.y < b.position.y;
+    return a.position.x != b.position.x ? a.position.x < b.position.x : a.scale < b.scale;
+}
+
+/// \brief Responses of the four intervals of an octave, sampled on common grid
+struct hessian_octave
+{
+    static constexpr std::size_t intervals = 4;
 
+    std::ptrdiff_t step;
+    std::ptrdiff_t width;
+    std::ptrdiff_t height;
+    std::array<std::ptrdiff_t, intervals> sizes;
+    std::array<std::vector<float>, intervals> responses;
 
-    auto center = weights.center_y();
-    for (auto y = center; y < dst.height() - center; ++y)
+    auto at(std::size_t interval, std::ptrdiff_t x, std::ptrdiff_t y) const -> float
     {
-        for (auto x = center; x < dst.width() - center; ++x)
+        return responses[interval][static_cast<std::size_t>(y * width + x)];
+    }
+};
+
+/// \brief Collects keypoints of rows [y_begin, y_end) of the grid of the octave, which are
+/// maxima of their 3x3x3 neighbourhood in space and scale
+inline void find_octave_maxima(
+    hessian_octave const& octave, float threshold,
+    std::ptrdiff_t y_begin, std::ptrdiff_t y_end, std::vector<hessian_keypoint>& out)
+{
+    for (std::size_t i = 1; i + 1 < hessian_octave::intervals; ++i)
+    {
+        // Positions whose largest filter of the neighbourhood lies inside the image
+        std::ptrdiff_t const border = (octave.sizes[i + 1] + 1) / (2 * octave.step) + 1;
+        std::ptrdiff_t const y0 = (std::max)(y_begin, border);
+        std::ptrdiff_t const y1 = (std::min)(y_end, octave.height - border);
+        for (std::ptrdiff_t y = y0; y < y1; ++y)
         {
-            auto ddxx_i = channel_t();
-            auto ddyy_i = channel_t();
-            auto dxdy_i = channel_t();
-            for (typename OutputView::coord_t w_y = 0; w_y < static_cast<std::ptrdiff_t>(weights.size()); ++w_y)
+            for (std::ptrdiff_t x = border; x < octave.width - border; ++x)
             {
-                for (typename OutputView::coord_t w_x = 0; w_x < static_cast<std::ptrdiff_t>(weights.size()); ++w_x)
+                float const response = octave.at(i, x, y);
+                if (!(response > threshold))
+                    continue;
+
+                bool maximum = true;
+                for (std::size_t n = i - 1; maximum && n <= i + 1; ++n)
+                {
+                    for (std::ptrdiff_t dy = -1; maximum && dy <= 1; ++dy)
+                    {
+                        for (std::ptrdiff_t dx = -1; dx <= 1; ++dx)
+                        {
+                            bool const center = n == i && dx == 0 && dy == 0;
+                            if (!center && octave.at(n, x + dx, y + dy) >= response)
+                            {
+                                maximum = false;
+                                break;
+                            }
+                        }
+                    }
+                }
+                if (maximum)
                 {
-                    ddxx_i += ddxx(x + w_x - center, y + w_y - center)
-                        .at(std::integral_constant<int, 0>{}) * weights.at(w_x, w_y);
-                    ddyy_i += ddyy(x + w_x - center, y + w_y - center)
-                        .at(std::integral_constant<int, 0>{}) * weights.at(w_x, w_y);
-                    dxdy_i += dxdy(x + w_x - center, y + w_y - center)
-                        .at(std::integral_constant<int, 0>{}) * weights.at(w_x, w_y);
+                    point_t const position(x * octave.step, y * octave.step);
+                    float const scale = 1.2f * static_cast<float>(octave.sizes[i]) / 9.0f;
+                    out.push_back({position, scale, response});
                 }
             }
-            auto determinant = ddxx_i * ddyy_i - dxdy_i * dxdy_i;
-            dst(x, y).at(std::integral_constant<int, 0>{}) = determinant;
         }
     }
 }
 
+} // namespace detail
+
+/// \brief Finds blobs of single-channel view at multiple scales by determinant of Hessian
+/// \ingroup ImageProcessing
+///
+/// Fast-Hessian detector of Bay et al. (SURF). Summed-area table of the view is built once
+/// and shared by all scales: Hessian of every scale is approximated by box filters, whose
+/// cost does not depend on their size, instead of by Gaussian derivatives of blurred images.
+/// Scale space is a pyramid of octaves, each of four intervals of growing filter sizes
+/// sampled on grid twice coarser than the previous octave. Keypoints are local maxima of
+/// the response over 3x3x3 neighbourhood in space and scale, at the two middle intervals of
+/// each octave. Rows of all intervals of an octave are computed, and then searched for
+/// maxima, by bands in parallel according to the policy, results do not depend on it.
+/// Keypoints are returned from the strongest.
+template <typename ExecutionPolicy, typename SrcView>
+auto hessian_blobs(
+    ExecutionPolicy const& policy,
+    SrcView const& src_view,
+    hessian_blobs_params const& params = {})
+    -> typename std::enable_if
+    <
+        execution::is_execution_policy<ExecutionPolicy>::value,
+        std::vector<hessian_keypoint>
+    >::type
+{
+    gil_function_requires<ImageViewConcept<SrcView>>();
+    static_assert(num_channels<SrcView>::value == 1, "Source view must have single channel");
+    if (params.initial_step == 0)
+        throw std::invalid_argument("initial step must be positive");
+
+    summed_area_table<> const table(policy, src_view);
+    std::vector<hessian_keypoint> keypoints;
+    for (std::size_t o = 0; o < params.octaves; ++o)
+    {
+        detail::hessian_octave octave;
+        octave.step = static_cast<std::ptrdiff_t>(params.initial_step << o);
+        octave.width = src_view.width() / octave.step;
+        octave.height = src_view.height() / octave.step;
+        for (std::size_t i = 0; i < detail::hessian_octave::intervals; ++i)
+            octave.sizes[i] = detail::hessian_filter_size(o, i);
+        if (octave.sizes.back() > src_view.width() || octave.sizes.back() > src_view.height())
+            break;
+        for (auto& responses : octave.responses)
+            responses.resize(static_cast<std::size_t>(octave.width * octave.height));
+
+        detail::for_each_row_band(policy, octave.width, octave.height,
+            [&](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+                for (std::size_t i = 0; i < detail::hessian_octave::intervals; ++i)
+                {
+                    float* responses = octave.responses[i].data();
+                    for (std::ptrdiff_t y = y_begin; y < y_end; ++y)
+                    {
+                        for (std::ptrdiff_t x = 0; x < octave.width; ++x)
+                        {
+                            responses[y * octave.width + x] = detail::hessian_box_response(
+                                table, x * octave.step, y * octave.step, octave.sizes[i]);
+                        }
+                    }
+                }
+            });
+
+        detail::collect_strongest_in_row_bands(policy, octave.width, octave.height,
+            params.max_blobs, detail::stronger_hessian_keypoint,
+            [&](std::ptrdiff_t y_begin, std::ptrdiff_t y_end,
+                std::vector<hessian_keypoint>& band_keypoints) {
+                detail::find_octave_maxima(
+                    octave, params.threshold, y_begin, y_end, band_keypoints);
+            },
+            keypoints);
+    }
+    detail::keep_strongest(keypoints, params.max_blobs, detail::stronger_hessian_keypoint);
+    std::sort(keypoints.begin(), keypoints.end(), detail::stronger_hessian_keypoint);
+    return keypoints;
+}
+
+/// \overload
+template <typename SrcView>
+auto hessian_blobs(SrcView const& src_view, hessian_blobs_params const& params = {})
+    -> std::vector<hessian_keypoint>
+{
+    return hessian_blobs(execution::seq, src_view, params);
+}
+
 }} // namespace boost::gil
 
 #endif
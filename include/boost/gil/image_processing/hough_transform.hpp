@@ -10,11 +10,20 @@
 #define BOOST_GIL_IMAGE_PROCESSING_HOUGH_TRANSFORM_HPP
 
 #include <algorithm>
+#include <boost/config.hpp>
+#include <boost/gil/execution.hpp>
 #include <boost/gil/image_processing/hough_parameter.hpp>
+#include <boost/gil/point.hpp>
 #include <boost/gil/rasterization/circle.hpp>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <cstdlib>
 #include <iterator>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace boost { namespace gil {
@@ -27,50 +36,238 @@ namespace boost { namespace gil {
 /// Circle and ellipse transforms are very costly to brute force, while
 /// non-brute-forcing algorithms tend to gamble on probabilities.
 
+namespace detail {
+
+/// \brief Radii x * cos + y * sin of points, rounded half away from zero like std::llround
+///
+/// Rounding of the truncated value is adjusted by its exact fraction, in code the compiler
+/// vectorizes.
+BOOST_FORCEINLINE
+void hough_line_radii(
+    double const* BOOST_RESTRICT xs,
+    double const* BOOST_RESTRICT ys,
+    std::int32_t* BOOST_RESTRICT radii,
+    std::ptrdiff_t n,
+    double cos_theta,
+    double sin_theta)
+{
+    for (std::ptrdiff_t i = 0; i < n; ++i)
+    {
+        double const r = xs[i] * cos_theta + ys[i] * sin_theta;
+        double const truncated = static_cast<double>(static_cast<std::int32_t>(r));
+        double const fraction = r - truncated;
+        double const up = fraction >= 0.5 ? 1.0 : 0.0;
+        double const down = fraction <= -0.5 ? 1.0 : 0.0;
+        radii[i] = static_cast<std::int32_t>(truncated + up - down);
+    }
+}
+
+/// \brief Adds votes of points for lines of given angle to histogram of radius indices
+///
+/// Radii are computed in chunks, in vectorized code.
+inline void vote_hough_lines(
+    std::vector<double> const& xs,
+    std::vector<double> const& ys,
+    double cos_theta,
+    double sin_theta,
+    hough_parameter<std::ptrdiff_t> const& radius,
+    std::vector<std::int32_t>& radii,
+    std::vector<std::size_t>& votes)
+{
+    std::ptrdiff_t const r_lower_bound = radius.start_point;
+    std::ptrdiff_t const r_upper_bound =
+        r_lower_bound + radius.step_size * static_cast<std::ptrdiff_t>(radius.step_count - 1);
+    auto const n = static_cast<std::ptrdiff_t>(xs.size());
+    for_each_chunk(n, [&](std::ptrdiff_t i, std::ptrdiff_t m) {
+        hough_line_radii(xs.data() + i, ys.data() + i, radii.data() + i, m, cos_theta, sin_theta);
+    });
+
+    for (std::ptrdiff_t j = 0; j < n; ++j)
+    {
+        std::ptrdiff_t const current_r = radii[j];
+        if (current_r < r_lower_bound || current_r > r_upper_bound)
+            continue;
+        auto const r_index =
+            static_cast<std::size_t>((current_r - radius.start_point) / radius.step_size);
+        // one more safety guard to not get out of bounds
+        if (r_index < radius.step_count)
+            ++votes[r_index];
+    }
+}
+
+} // namespace detail
+
 /// \ingroup HoughTransform
-/// \brief Vote for best fit of a line in parameter space
+/// \brief Vote for best fit of a line in parameter space, using threads allowed by
+/// execution policy
 ///
 /// The input must be an edge map with grayscale pixels. Be aware of overflow inside
 /// accumulator array. The theta parameter is best computed through factory function
 /// provided in hough_parameter.hpp
-template <typename InputView, typename OutputView>
-void hough_line_transform(const InputView& input_view, const OutputView& accumulator_array,
+///
+/// Edge points are collected first and sines and cosines of angles computed once. Every
+/// angle is voted by all points at once, into histogram of radii which stays in cache, with
+/// radii of points computed in vectorized code. Bands of angles are voted in parallel, each
+/// into its own columns of the accumulator, so no merge of accumulators is needed. Votes are
+/// the same as of the original per-pixel computation, for points with coordinates below 2^30.
+template <typename ExecutionPolicy, typename InputView, typename OutputView>
+auto hough_line_transform(ExecutionPolicy const& policy,
+                          const InputView& input_view, const OutputView& accumulator_array,
                           const hough_parameter<double>& theta,
                           const hough_parameter<std::ptrdiff_t>& radius)
+    -> typename std::enable_if<execution::is_execution_policy<ExecutionPolicy>::value>::type
 {
-    std::ptrdiff_t r_lower_bound = radius.start_point;
-    std::ptrdiff_t r_upper_bound = r_lower_bound + radius.step_size * (radius.step_count - 1);
-
+    std::vector<double> xs;
+    std::vector<double> ys;
     for (std::ptrdiff_t y = 0; y < input_view.height(); ++y)
     {
+        auto it = input_view.row_begin(y);
         for (std::ptrdiff_t x = 0; x < input_view.width(); ++x)
         {
-            if (!input_view(x, y)[0])
+            if (!it[x][0])
             {
                 continue;
             }
+            xs.push_back(static_cast<double>(x));
+            ys.push_back(static_cast<double>(y));
+        }
+    }
+
+    std::vector<double> cos_table(theta.step_count);
+    std::vector<double> sin_table(theta.step_count);
+    for (std::size_t theta_index = 0; theta_index < theta.step_count; ++theta_index)
+    {
+        double theta_current =
+            theta.start_point + theta.step_size * static_cast<double>(theta_index);
+        cos_table[theta_index] = std::cos(theta_current);
+        sin_table[theta_index] = std::sin(theta_current);
+    }
 
-            for (std::size_t theta_index = 0; theta_index < theta.step_count; ++theta_index)
+    using votes_t = typename channel_type<OutputView>::type;
+    auto const points = static_cast<std::ptrdiff_t>(xs.size());
+    detail::for_each_row_band(policy, (std::max)(points, std::ptrdiff_t(1)),
+        static_cast<std::ptrdiff_t>(theta.step_count),
+        [&](std::ptrdiff_t theta_begin, std::ptrdiff_t theta_end) {
+            std::vector<std::int32_t> radii(xs.size());
+            std::vector<std::size_t> votes(radius.step_count);
+            for (std::ptrdiff_t theta_index = theta_begin; theta_index < theta_end; ++theta_index)
             {
-                double theta_current =
-                    theta.start_point + theta.step_size * static_cast<double>(theta_index);
-                std::ptrdiff_t current_r =
-                    std::llround(static_cast<double>(x) * std::cos(theta_current) +
-                                 static_cast<double>(y) * std::sin(theta_current));
-                if (current_r < r_lower_bound || current_r > r_upper_bound)
+                auto const t = static_cast<std::size_t>(theta_index);
+                std::fill(votes.begin(), votes.end(), std::size_t(0));
+                detail::vote_hough_lines(
+                    xs, ys, cos_table[t], sin_table[t], radius, radii, votes);
+                for (std::size_t r_index = 0; r_index < votes.size(); ++r_index)
                 {
-                    continue;
+                    if (votes[r_index] != 0)
+                    {
+                        auto const x = static_cast<std::ptrdiff_t>(t);
+                        auto const y = static_cast<std::ptrdiff_t>(r_index);
+                        auto& count = accumulator_array(x, y)[0];
+                        count = static_cast<votes_t>(count + votes[r_index]);
+                    }
                 }
-                std::size_t r_index = static_cast<std::size_t>(
-                    std::llround((current_r - radius.start_point) / radius.step_size));
-                // one more safety guard to not get out of bounds
-                if (r_index < radius.step_count)
+            }
+        });
+}
+
+/// \ingroup HoughTransform
+/// \brief Vote for best fit of a line in parameter space
+///
+/// The input must be an edge map with grayscale pixels. Be aware of overflow inside
+/// accumulator array. The theta parameter is best computed through factory function
+/// provided in hough_parameter.hpp
+template <typename InputView, typename OutputView>
+void hough_line_transform(const InputView& input_view, const OutputView& accumulator_array,
+                          const hough_parameter<double>& theta,
+                          const hough_parameter<std::ptrdiff_t>& radius)
+{
+    hough_line_transform(execution::seq, input_view, accumulator_array, theta, radius);
+}
+
+namespace detail {
+
+template <typename Votes>
+struct hough_peak
+{
+    point_t position;
+    Votes votes;
+};
+
+/// \brief Local maxima of accumulator with at least given votes, from the one with the most
+///
+/// A maximum must have more votes than any other element within distance of it along both
+/// axes, among equal elements only the first in row-major order is kept. Maxima with equal
+/// votes stay in row-major order.
+template <typename AccumulatorView>
+auto find_hough_peaks(const AccumulatorView& accumulator, std::ptrdiff_t distance,
+                      typename std::remove_cv<typename std::remove_reference<
+                          decltype(accumulator(0, 0)[0])>::type>::type min_votes)
+    -> std::vector<hough_peak<decltype(min_votes)>>
+{
+    using value_t = decltype(min_votes);
+    auto const width = accumulator.width();
+    auto const height = accumulator.height();
+
+    std::vector<hough_peak<value_t>> peaks;
+    for (std::ptrdiff_t y = 0; y < height; ++y)
+    {
+        auto it = accumulator.row_begin(y);
+        for (std::ptrdiff_t x = 0; x < width; ++x)
+        {
+            value_t const votes = it[x][0];
+            if (votes < min_votes)
+                continue;
+
+            bool maximum = true;
+            std::ptrdiff_t const y1 = (std::min)(height, y + distance + 1);
+            for (std::ptrdiff_t ny = (std::max)(std::ptrdiff_t(0), y - distance);
+                 maximum && ny < y1; ++ny)
+            {
+                auto neighbours = accumulator.row_begin(ny);
+                std::ptrdiff_t const x1 = (std::min)(width, x + distance + 1);
+                for (std::ptrdiff_t nx = (std::max)(std::ptrdiff_t(0), x - distance); nx < x1;
+                     ++nx)
                 {
-                    accumulator_array(theta_index, r_index)[0] += 1;
+                    value_t const other = neighbours[nx][0];
+                    bool const before = ny < y || (ny == y && nx < x);
+                    if (other > votes || (before && other == votes))
+                    {
+                        maximum = false;
+                        break;
+                    }
                 }
             }
+            if (maximum)
+                peaks.push_back({point_t(x, y), votes});
         }
     }
+
+    std::stable_sort(peaks.begin(), peaks.end(),
+                     [](hough_peak<value_t> const& lhs, hough_peak<value_t> const& rhs) {
+                         return lhs.votes > rhs.votes;
+                     });
+    return peaks;
+}
+
+} // namespace detail
+
+/// \ingroup HoughTransform
+/// \brief Finds strongest lines in accumulator array of hough_line_transform
+///
+/// Returns positions (theta index, radius index) of at most n local maxima of the
+/// accumulator, from the one with the most votes. A maximum must have at least one vote
+/// and more votes than any other element within min_distance of it along both axes, among
+/// equal elements only the first in row-major order is kept.
+template <typename AccumulatorView>
+auto hough_line_peaks(const AccumulatorView& accumulator, std::size_t n,
+                      std::size_t min_distance) -> std::vector<point_t>
+{
+    auto const peaks = detail::find_hough_peaks(
+        accumulator, static_cast<std::ptrdiff_t>(min_distance), 1);
+    std::vector<point_t> positions;
+    for (std::size_t i = 0; i < peaks.size() && i < n; ++i)
+        positions.push_back(peaks[i].position);
+    return positions;
 }
 
 /// \ingroup HoughTransform
@@ -133,6 +330,273 @@ void hough_circle_transform_brute(const ImageView& input,
     }
 }
 
+/// \ingroup HoughTransform
+/// \brief Circle found by hough_circle_peaks
+struct hough_circle
+{
+    point_t center;
+    std::ptrdiff_t radius = 0;
+    /// Votes for the center in accumulator of hough_circle_transform_gradient
+    std::size_t votes = 0;
+    /// Number of edge points at the radius from the center
+    std::size_t radius_votes = 0;
+};
+
+namespace detail {
+
+/// \brief Sobel derivatives of first channel of view at (x, y), replicating border pixels
+template <typename View>
+void hough_sobel(const View& view, std::ptrdiff_t x, std::ptrdiff_t y, double& dx, double& dy)
+{
+    auto const clamp = [](std::ptrdiff_t v, std::ptrdiff_t size) {
+        return (std::max)(std::ptrdiff_t(0), (std::min)(v, size - 1));
+    };
+    std::ptrdiff_t const xs[] = {clamp(x - 1, view.width()), x, clamp(x + 1, view.width())};
+    std::ptrdiff_t const ys[] = {clamp(y - 1, view.height()), y, clamp(y + 1, view.height())};
+    double samples[3][3];
+    for (int j = 0; j < 3; ++j)
+        for (int i = 0; i < 3; ++i)
+            samples[j][i] = static_cast<double>(view(xs[i], ys[j])[0]);
+
+    dx = (samples[0][2] + 2 * samples[1][2] + samples[2][2]) -
+         (samples[0][0] + 2 * samples[1][0] + samples[2][0]);
+    dy = (samples[2][0] + 2 * samples[2][1] + samples[2][2]) -
+         (samples[0][0] + 2 * samples[0][1] + samples[0][2]);
+}
+
+/// \brief Directions of rays voted for every edge point, as rotations of its gradient
+///
+/// Rotations cover [-angular_window, angular_window] densely enough for neighbouring rays
+/// to be at most one pixel apart at the largest radius.
+inline std::vector<std::pair<double, double>> hough_circle_ray_rotations(
+    double angular_window, std::ptrdiff_t max_radius)
+{
+    std::vector<std::pair<double, double>> rotations;
+    auto const half_count = static_cast<std::ptrdiff_t>(
+        std::ceil(angular_window * static_cast<double>((std::max)(max_radius, std::ptrdiff_t(1)))));
+    if (!(angular_window > 0) || half_count <= 0)
+    {
+        rotations.emplace_back(1.0, 0.0);
+        return rotations;
+    }
+    for (std::ptrdiff_t i = -half_count; i <= half_count; ++i)
+    {
+        double const angle =
+            angular_window * static_cast<double>(i) / static_cast<double>(half_count);
+        rotations.emplace_back(std::cos(angle), std::sin(angle));
+    }
+    return rotations;
+}
+
+} // namespace detail
+
+/// \ingroup HoughTransform
+/// \brief Vote for centers of circles along gradient direction of edge points, using
+/// threads allowed by execution policy
+///
+/// For every non-zero pixel of the edge map, the Sobel gradient of first channel of input is
+/// computed, and every center which is at a radius from the given range along the gradient
+/// line, in both directions, gets a vote. Directions within angular_window radians of the
+/// gradient are voted as well, to tolerate noise of the gradient. A point votes for a center
+/// once per direction. Votes are added to centers accumulator, which must have dimensions of
+/// input. Compared to hough_circle_transform_brute, cost is proportional to number of edge
+/// points and radii only, not to circumference and parameter space. Radius of circles around
+/// found centers is estimated by hough_circle_peaks.
+///
+/// Threads vote for edge points of bands of rows into their own accumulators, which are added
+/// up at the end, so the result does not depend on the policy. Votes land at most the largest
+/// radius away from the edge point, so accumulator of a band covers only its rows extended by
+/// that radius, and only those rows are merged.
+template <typename ExecutionPolicy, typename EdgeView, typename InputView, typename CentersView>
+auto hough_circle_transform_gradient(ExecutionPolicy const& policy,
+                                     const EdgeView& edges, const InputView& input,
+                                     const hough_parameter<std::ptrdiff_t>& radius,
+                                     double angular_window, const CentersView& centers)
+    -> typename std::enable_if<execution::is_execution_policy<ExecutionPolicy>::value>::type
+{
+    if (edges.dimensions() != input.dimensions() || edges.dimensions() != centers.dimensions())
+        throw std::invalid_argument("hough_circle_transform_gradient: dimensions must match");
+
+    auto const width = edges.width();
+    auto const height = edges.height();
+    auto const last_radius_index =
+        static_cast<std::ptrdiff_t>(radius.step_count > 0 ? radius.step_count - 1 : 0);
+    std::ptrdiff_t const max_radius = radius.start_point + radius.step_size * last_radius_index;
+    auto const rotations = detail::hough_circle_ray_rotations(angular_window, max_radius);
+    std::ptrdiff_t const reach = (std::max)(std::abs(radius.start_point), std::abs(max_radius));
+
+    std::mutex merge_mutex;
+    detail::for_each_row_band(policy, width, height,
+        [&](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+            std::ptrdiff_t const votes_begin = (std::max)(std::ptrdiff_t(0), y_begin - reach);
+            std::ptrdiff_t const votes_end = (std::min)(height, y_end + reach);
+            std::vector<std::uint32_t> votes(
+                static_cast<std::size_t>(width * (votes_end - votes_begin)), 0);
+            for (std::ptrdiff_t y = y_begin; y < y_end; ++y)
+            {
+                auto edge_it = edges.row_begin(y);
+                for (std::ptrdiff_t x = 0; x < width; ++x)
+                {
+                    if (!edge_it[x][0])
+                        continue;
+
+                    double dx = 0;
+                    double dy = 0;
+                    detail::hough_sobel(input, x, y, dx, dy);
+                    double const magnitude = std::sqrt(dx * dx + dy * dy);
+                    if (!(magnitude > 0))
+                        continue;
+                    dx /= magnitude;
+                    dy /= magnitude;
+
+                    for (auto const& rotation : rotations)
+                    {
+                        double const ray_x = dx * rotation.first - dy * rotation.second;
+                        double const ray_y = dx * rotation.second + dy * rotation.first;
+                        for (double const sign : {1.0, -1.0})
+                        {
+                            std::ptrdiff_t last_index = -1;
+                            for (std::size_t r = 0; r < radius.step_count; ++r)
+                            {
+                                double const distance = sign * static_cast<double>(
+                                    radius.start_point +
+                                    radius.step_size * static_cast<std::ptrdiff_t>(r));
+                                auto const cx = static_cast<std::ptrdiff_t>(
+                                    std::llround(static_cast<double>(x) + distance * ray_x));
+                                auto const cy = static_cast<std::ptrdiff_t>(
+                                    std::llround(static_cast<double>(y) + distance * ray_y));
+                                if (cx < 0 || cx >= width || cy < votes_begin || cy >= votes_end)
+                                    continue;
+                                std::ptrdiff_t const index = (cy - votes_begin) * width + cx;
+                                if (index != last_index)
+                                    ++votes[static_cast<std::size_t>(index)];
+                                last_index = index;
+                            }
+                        }
+                    }
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(merge_mutex);
+            for (std::ptrdiff_t y = votes_begin; y < votes_end; ++y)
+            {
+                auto it = centers.row_begin(y);
+                std::uint32_t const* row = votes.data() + (y - votes_begin) * width;
+                for (std::ptrdiff_t x = 0; x < width; ++x)
+                {
+                    if (row[x] != 0)
+                        it[x][0] += row[x];
+                }
+            }
+        });
+}
+
+/// \ingroup HoughTransform
+/// \brief Vote for centers of circles along gradient direction of edge points
+/// \overload
+template <typename EdgeView, typename InputView, typename CentersView>
+void hough_circle_transform_gradient(const EdgeView& edges, const InputView& input,
+                                     const hough_parameter<std::ptrdiff_t>& radius,
+                                     double angular_window, const CentersView& centers)
+{
+    hough_circle_transform_gradient(
+        execution::seq, edges, input, radius, angular_window, centers);
+}
+
+/// \ingroup HoughTransform
+/// \brief Finds strongest circles from centers accumulator of hough_circle_transform_gradient,
+/// using threads allowed by execution policy
+///
+/// Centers are local maxima of the accumulator with at least min_votes votes, and more votes
+/// than any other center within min_distance of it along both axes. At most max_circles
+/// strongest centers are taken, all of them if max_circles is zero. For every center, the
+/// radius from the range with the most edge points at that distance is chosen, using
+/// a histogram of distances of all edge points. Circles are returned from the one with the
+/// most votes for center, centers without any edge point at a radius from the range are
+/// dropped.
+template <typename ExecutionPolicy, typename EdgeView, typename CentersView>
+auto hough_circle_peaks(ExecutionPolicy const& policy, const EdgeView& edges,
+                        const CentersView& centers,
+                        const hough_parameter<std::ptrdiff_t>& radius, std::size_t min_votes,
+                        std::size_t min_distance, std::size_t max_circles = 0)
+    -> typename std::enable_if<
+        execution::is_execution_policy<ExecutionPolicy>::value, std::vector<hough_circle>>::type
+{
+    using votes_t = typename std::remove_cv<
+        typename std::remove_reference<decltype(centers(0, 0)[0])>::type>::type;
+    auto peaks = detail::find_hough_peaks(centers, static_cast<std::ptrdiff_t>(min_distance),
+        static_cast<votes_t>((std::max)(min_votes, std::size_t(1))));
+    if (max_circles != 0 && peaks.size() > max_circles)
+        peaks.resize(max_circles);
+
+    std::vector<point_t> points;
+    for (std::ptrdiff_t y = 0; y < edges.height(); ++y)
+    {
+        auto it = edges.row_begin(y);
+        for (std::ptrdiff_t x = 0; x < edges.width(); ++x)
+        {
+            if (it[x][0])
+                points.emplace_back(x, y);
+        }
+    }
+
+    std::vector<hough_circle> circles(peaks.size());
+    detail::for_each_row_band(policy,
+        (std::max)(static_cast<std::ptrdiff_t>(points.size()), std::ptrdiff_t(1)),
+        static_cast<std::ptrdiff_t>(peaks.size()),
+        [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+            // Distances are binned to the nearest radius
+            std::ptrdiff_t const step = (std::max)(radius.step_size, std::ptrdiff_t(1));
+            std::vector<std::size_t> histogram(radius.step_count);
+            for (std::ptrdiff_t i = begin; i < end; ++i)
+            {
+                auto const& peak = peaks[static_cast<std::size_t>(i)];
+                std::fill(histogram.begin(), histogram.end(), std::size_t(0));
+                for (auto const& p : points)
+                {
+                    auto const dx = static_cast<double>(p.x - peak.position.x);
+                    auto const dy = static_cast<double>(p.y - peak.position.y);
+                    auto const distance = std::llround(std::sqrt(dx * dx + dy * dy));
+                    std::ptrdiff_t const offset = distance - radius.start_point + step / 2;
+                    if (offset < 0)
+                        continue;
+                    auto const index = static_cast<std::size_t>(offset / step);
+                    if (index < histogram.size())
+                        ++histogram[index];
+                }
+
+                auto const best = std::max_element(histogram.begin(), histogram.end());
+                auto& circle = circles[static_cast<std::size_t>(i)];
+                circle.center = peak.position;
+                circle.votes = static_cast<std::size_t>(peak.votes);
+                if (best != histogram.end())
+                {
+                    circle.radius = radius.start_point + radius.step_size *
+                        static_cast<std::ptrdiff_t>(best - histogram.begin());
+                    circle.radius_votes = *best;
+                }
+            }
+        });
+
+    circles.erase(std::remove_if(circles.begin(), circles.end(),
+                                 [](hough_circle const& c) { return c.radius_votes == 0; }),
+                  circles.end());
+    return circles;
+}
+
+/// \ingroup HoughTransform
+/// \brief Finds strongest circles from centers accumulator of hough_circle_transform_gradient
+/// \overload
+template <typename EdgeView, typename CentersView>
+auto hough_circle_peaks(const EdgeView& edges, const CentersView& centers,
+                        const hough_parameter<std::ptrdiff_t>& radius, std::size_t min_votes,
+                        std::size_t min_distance, std::size_t max_circles = 0)
+    -> std::vector<hough_circle>
+{
+    return hough_circle_peaks(
+        execution::seq, edges, centers, radius, min_votes, min_distance, max_circles);
+}
+
 }} // namespace boost::gil
 
 #endif
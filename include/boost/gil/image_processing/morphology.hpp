@@ -12,6 +12,14 @@
 #include <boost/gil/gray.hpp>
 #include <boost/gil/image_processing/threshold.hpp>
 
+#include <boost/config.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
 namespace boost
 {
 namespace gil
@@ -26,10 +34,334 @@ enum class morphological_operation
 /// \addtogroup ImageProcessing
 /// @{
 
+/// \brief Maximum of two samples, with lowest value as neutral element
+template <typename T>
+struct morph_max
+{
+    auto operator()(T a, T b) const -> T { return (std::max)(a, b); }
+    static auto neutral() -> T { return std::numeric_limits<T>::lowest(); }
+};
+
+/// \brief Minimum of two samples, with highest value as neutral element
+template <typename T>
+struct morph_min
+{
+    auto operator()(T a, T b) const -> T { return (std::min)(a, b); }
+    static auto neutral() -> T { return (std::numeric_limits<T>::max)(); }
+};
+
+/// \brief Horizontal run of structuring element, offsets relative to the pixel under consideration
+struct morph_run
+{
+    std::ptrdiff_t dy;
+    std::ptrdiff_t dx;
+    std::ptrdiff_t length;
+};
+
+/// \brief Structuring element decomposed into horizontal runs of consecutive offsets
+///
+/// Offsets always include the pixel under consideration itself.
+struct morph_structuring_element
+{
+    std::ptrdiff_t x_min{0};
+    std::ptrdiff_t x_max{0};
+    std::ptrdiff_t y_min{0};
+    std::ptrdiff_t y_max{0};
+    std::vector<morph_run> runs;
+    bool rectangle{false};
+};
+
+/// \brief Collects offsets of non-zero kernel elements and splits them into horizontal runs
+template <typename Kernel>
+auto make_morph_structuring_element(Kernel const& kernel) -> morph_structuring_element
+{
+    auto const size = static_cast<std::ptrdiff_t>(kernel.size());
+    auto const center_x = static_cast<std::ptrdiff_t>(kernel.center_x());
+    auto const center_y = static_cast<std::ptrdiff_t>(kernel.center_y());
+
+    // Offset (dx, dy) of flipped kernel element maps to mask[dy + size - 1 - center_y]
+    // [dx + size - 1 - center_x], both indices within [0, size)
+    std::vector<char> mask(static_cast<std::size_t>(size * size), 0);
+    auto mask_at = [&](std::ptrdiff_t dx, std::ptrdiff_t dy) -> char& {
+        return mask[static_cast<std::size_t>(
+            (dy + size - 1 - center_y) * size + dx + size - 1 - center_x)];
+    };
+    mask_at(0, 0) = 1;
+    for (std::ptrdiff_t flip_row = 0; flip_row < size; ++flip_row)
+    {
+        for (std::ptrdiff_t flip_col = 0; flip_col < size; ++flip_col)
+        {
+            auto const value =
+                kernel.at(static_cast<std::size_t>(flip_row), static_cast<std::size_t>(flip_col));
+            if (std::fpclassify(value) != FP_ZERO)
+                mask_at(center_x - flip_col, center_y - flip_row) = 1;
+        }
+    }
+
+    morph_structuring_element element;
+    element.x_min = element.y_min = size;
+    element.x_max = element.y_max = -size;
+    std::ptrdiff_t count = 0;
+    for (std::ptrdiff_t dy = center_y - size + 1; dy <= center_y; ++dy)
+    {
+        for (std::ptrdiff_t dx = center_x - size + 1; dx <= center_x; ++dx)
+        {
+            if (!mask_at(dx, dy))
+                continue;
+
+            ++count;
+            element.x_min = (std::min)(element.x_min, dx);
+            element.x_max = (std::max)(element.x_max, dx);
+            element.y_min = (std::min)(element.y_min, dy);
+            element.y_max = (std::max)(element.y_max, dy);
+            if (!element.runs.empty() && element.runs.back().dy == dy &&
+                element.runs.back().dx + element.runs.back().length == dx)
+            {
+                ++element.runs.back().length;
+            }
+            else
+            {
+                element.runs.push_back(morph_run{dy, dx, 1});
+            }
+        }
+    }
+    element.rectangle =
+        count == (element.x_max - element.x_min + 1) * (element.y_max - element.y_min + 1);
+    return element;
+}
+
+/// \brief Running minimum or maximum over windows of given length, after van Herk and Gil-Werman
+///
+/// Computes out[i] = op(in[i], ..., in[i + length - 1]) for i in [0, size) using three
+/// applications of op per sample regardless of window length: input is split into blocks
+/// of window length, each window spans suffix of one block and prefix of the next one.
+/// \param in Input of size + length - 1 samples.
+/// \param suffix Scratch buffer of length samples.
+template <typename Sample, typename Op>
+void running_extremum(
+    Sample const* in,
+    std::ptrdiff_t size,
+    std::ptrdiff_t length,
+    Sample* out,
+    Sample* suffix,
+    Op op)
+{
+    for (std::ptrdiff_t block = 0; block < size; block += length)
+    {
+        suffix[length - 1] = in[block + length - 1];
+        for (std::ptrdiff_t j = length - 2; j >= 0; --j)
+            suffix[j] = op(in[block + j], suffix[j + 1]);
+
+        out[block] = suffix[0];
+        std::ptrdiff_t const n = (std::min)(length, size - block);
+        Sample prefix = Op::neutral();
+        for (std::ptrdiff_t j = 1; j < n; ++j)
+        {
+            prefix = op(prefix, in[block + length + j - 1]);
+            out[block + j] = op(suffix[j], prefix);
+        }
+    }
+}
+
+/// \brief Loads row of single-channel view into buffer, padded with neutral element
+///
+/// Sample buffer[i] holds view(i - left, y), or neutral element outside of the view.
+template <typename Sample, typename Op, typename SrcView>
+void load_morph_row(
+    SrcView const& src_view, std::ptrdiff_t y, std::ptrdiff_t left, std::vector<Sample>& buffer)
+{
+    std::fill(buffer.begin(), buffer.end(), Op::neutral());
+    if (y < 0 || y >= src_view.height())
+        return;
+
+    auto src_it = src_view.row_begin(y);
+    std::ptrdiff_t const begin = (std::max)(left, std::ptrdiff_t(0));
+    std::ptrdiff_t const end =
+        (std::min)(left + src_view.width(), static_cast<std::ptrdiff_t>(buffer.size()));
+    for (std::ptrdiff_t i = begin; i < end; ++i)
+        buffer[static_cast<std::size_t>(i)] = static_cast<Sample>(at_c<0>(src_it[i - left]));
+}
+
+/// \brief Writes row of samples into single-channel view
+template <typename DstView, typename Sample>
+void store_morph_row(DstView const& dst_view, std::ptrdiff_t y, Sample const* row)
+{
+    using dst_channel_t = typename channel_type<DstView>::type;
+    using dst_base_t = typename base_channel_type<dst_channel_t>::type;
+    auto dst_it = dst_view.row_begin(y);
+    for (std::ptrdiff_t x = 0; x < dst_view.width(); ++x)
+        dst_it[x] = dst_channel_t(static_cast<dst_base_t>(row[x]));
+}
+
+/// \brief Morphological operation with rectangular structuring element, including lines
+///
+/// Separable: running extremum along rows, followed by running extremum down the columns,
+/// both by van Herk/Gil-Werman. Rows filtered horizontally are kept in a ring covering
+/// two blocks of the vertical pass, and the vertical pass processes whole rows at once,
+/// which the compiler vectorizes.
+///
+/// Every source row is read before the destination row of the same index is written,
+/// so the destination may be the source itself.
+template <typename Sample, typename SrcView, typename DstView, typename Op>
+void morph_rectangle(
+    SrcView const& src_view,
+    DstView const& dst_view,
+    morph_structuring_element const& element,
+    Op op)
+{
+    std::ptrdiff_t const width = src_view.width();
+    std::ptrdiff_t const height = src_view.height();
+    std::ptrdiff_t const kernel_width = element.x_max - element.x_min + 1;
+    std::ptrdiff_t const kernel_height = element.y_max - element.y_min + 1;
+    auto const row_size = static_cast<std::size_t>(width);
+
+    // Ring row r holds horizontal extremum of source row r + y_min
+    std::ptrdiff_t const ring_size = 2 * kernel_height;
+    std::vector<Sample> ring(static_cast<std::size_t>(ring_size) * row_size);
+    std::vector<Sample> padded(static_cast<std::size_t>(width + kernel_width - 1));
+    std::vector<Sample> row_suffix(static_cast<std::size_t>(kernel_width));
+    std::ptrdiff_t loaded = 0;
+    auto ring_row = [&](std::ptrdiff_t r) -> Sample* {
+        return ring.data() + static_cast<std::size_t>(r % ring_size) * row_size;
+    };
+    auto load_rows_until = [&](std::ptrdiff_t r_end) {
+        for (; loaded < r_end; ++loaded)
+        {
+            load_morph_row<Sample, Op>(src_view, loaded + element.y_min, -element.x_min, padded);
+            running_extremum(
+                padded.data(), width, kernel_width, ring_row(loaded), row_suffix.data(), op);
+        }
+    };
+
+    std::vector<Sample> suffix(static_cast<std::size_t>(kernel_height) * row_size);
+    std::vector<Sample> prefix(row_size);
+    for (std::ptrdiff_t block = 0; block < height; block += kernel_height)
+    {
+        std::ptrdiff_t const n = (std::min)(kernel_height, height - block);
+        load_rows_until(block + kernel_height + n - 1);
+
+        Sample* suffix_row = suffix.data() + static_cast<std::size_t>(kernel_height - 1) * row_size;
+        std::copy(ring_row(block + kernel_height - 1), ring_row(block + kernel_height - 1) + width,
+            suffix_row);
+        for (std::ptrdiff_t j = kernel_height - 2; j >= 0; --j)
+        {
+            Sample const* BOOST_RESTRICT in = ring_row(block + j);
+            Sample const* BOOST_RESTRICT below =
+                suffix.data() + static_cast<std::size_t>(j + 1) * row_size;
+            Sample* BOOST_RESTRICT out = suffix.data() + static_cast<std::size_t>(j) * row_size;
+            for (std::ptrdiff_t x = 0; x < width; ++x)
+                out[x] = op(in[x], below[x]);
+        }
+
+        store_morph_row(dst_view, block, suffix.data());
+        std::fill(prefix.begin(), prefix.end(), Op::neutral());
+        for (std::ptrdiff_t j = 1; j < n; ++j)
+        {
+            Sample const* BOOST_RESTRICT in = ring_row(block + kernel_height + j - 1);
+            Sample const* BOOST_RESTRICT top =
+                suffix.data() + static_cast<std::size_t>(j) * row_size;
+            Sample* BOOST_RESTRICT acc = prefix.data();
+            for (std::ptrdiff_t x = 0; x < width; ++x)
+                acc[x] = op(acc[x], in[x]);
+            // Suffix row is no longer needed, reuse it for the result
+            Sample* BOOST_RESTRICT out = suffix.data() + static_cast<std::size_t>(j) * row_size;
+            for (std::ptrdiff_t x = 0; x < width; ++x)
+                out[x] = op(top[x], acc[x]);
+            store_morph_row(dst_view, block + j, out);
+        }
+    }
+}
+
+/// \brief Morphological operation with arbitrary structuring element
+///
+/// Structuring element is decomposed into horizontal runs. Every source row is filtered
+/// by van Herk/Gil-Werman running extremum once per distinct run length, and each output
+/// row combines one shifted filtered row per run, so cost per pixel is proportional to
+/// number of runs rather than number of structuring element elements.
+///
+/// Every source row is read before the destination row of the same index is written,
+/// so the destination may be the source itself.
+template <typename Sample, typename SrcView, typename DstView, typename Op>
+void morph_runs(
+    SrcView const& src_view,
+    DstView const& dst_view,
+    morph_structuring_element const& element,
+    Op op)
+{
+    std::ptrdiff_t const width = src_view.width();
+    std::ptrdiff_t const height = src_view.height();
+    std::ptrdiff_t const left = -element.x_min;
+    std::ptrdiff_t const padded_width = width + element.x_max - element.x_min;
+
+    std::vector<std::ptrdiff_t> lengths;
+    for (auto const& run : element.runs)
+        lengths.push_back(run.length);
+    std::sort(lengths.begin(), lengths.end());
+    lengths.erase(std::unique(lengths.begin(), lengths.end()), lengths.end());
+
+    // Ring of filtered rows for every distinct run length, source row sy in slot sy % ring_size;
+    // filtered[i] is extremum of samples of padded row at [i, i + length)
+    std::ptrdiff_t const ring_size = element.y_max - element.y_min + 1;
+    auto const filtered_size = static_cast<std::size_t>(padded_width);
+    std::vector<Sample> ring(lengths.size() * static_cast<std::size_t>(ring_size) * filtered_size);
+    std::vector<Sample> padded(static_cast<std::size_t>(padded_width));
+    std::vector<Sample> suffix(static_cast<std::size_t>(lengths.back()));
+    auto filtered_row = [&](std::size_t length_index, std::ptrdiff_t sy) -> Sample* {
+        std::ptrdiff_t const slot = ((sy % ring_size) + ring_size) % ring_size;
+        std::size_t const row_index =
+            length_index * static_cast<std::size_t>(ring_size) + static_cast<std::size_t>(slot);
+        return ring.data() + row_index * filtered_size;
+    };
+    auto load_row = [&](std::ptrdiff_t sy) {
+        if (sy < 0 || sy >= height)
+            return;
+        load_morph_row<Sample, Op>(src_view, sy, left, padded);
+        for (std::size_t i = 0; i < lengths.size(); ++i)
+        {
+            running_extremum(padded.data(), padded_width - lengths[i] + 1, lengths[i],
+                filtered_row(i, sy), suffix.data(), op);
+        }
+    };
+
+    std::vector<std::size_t> run_length_index;
+    for (auto const& run : element.runs)
+    {
+        run_length_index.push_back(static_cast<std::size_t>(
+            std::lower_bound(lengths.begin(), lengths.end(), run.length) - lengths.begin()));
+    }
+
+    for (std::ptrdiff_t sy = element.y_min; sy < element.y_max; ++sy)
+        load_row(sy);
+
+    std::vector<Sample> out(static_cast<std::size_t>(width));
+    for (std::ptrdiff_t y = 0; y < height; ++y)
+    {
+        load_row(y + element.y_max);
+        std::fill(out.begin(), out.end(), Op::neutral());
+        for (std::size_t r = 0; r < element.runs.size(); ++r)
+        {
+            morph_run const& run = element.runs[r];
+            std::ptrdiff_t const sy = y + run.dy;
+            if (sy < 0 || sy >= height)
+                continue;
+
+            Sample const* BOOST_RESTRICT in = filtered_row(run_length_index[r], sy) + run.dx + left;
+            Sample* BOOST_RESTRICT acc = out.data();
+            for (std::ptrdiff_t x = 0; x < width; ++x)
+                acc[x] = op(acc[x], in[x]);
+        }
+        store_morph_row(dst_view, y, out.data());
+    }
+}
+
 /// \brief Implements morphological operations at pixel level.This function
 /// compares neighbouring pixel values according to the kernel and choose
 /// minimum/mamximum neighbouring pixel value and assigns it to the pixel under
-/// consideration.
+/// consideration. Samples outside of the view are ignored.
+///
+/// Rectangular structuring elements, including lines, are processed in constant
+/// time per pixel, arbitrary ones in time proportional to number of their
+/// horizontal runs. Destination may be the source view itself.
 /// \param src_view - Source/Input image view.
 /// \param dst_view - View which stores the final result of operations performed by this function.
 /// \param kernel - Kernel matrix/structuring element containing 0's and 1's
@@ -42,57 +374,31 @@ template <typename SrcView, typename DstView, typename Kernel>
 void morph_impl(SrcView const& src_view, DstView const& dst_view, Kernel const& kernel,
                 morphological_operation identifier)
 {
-    std::ptrdiff_t flip_ker_row, flip_ker_col, row_boundary, col_boundary;
-    typename channel_type<typename SrcView::value_type>::type target_element;
-    for (std::ptrdiff_t view_row = 0; view_row < src_view.height(); ++view_row)
+    using sample_t = typename base_channel_type<typename channel_type<SrcView>::type>::type;
+
+    if (src_view.width() == 0 || src_view.height() == 0)
+        return;
+
+    morph_structuring_element const element = make_morph_structuring_element(kernel);
+    if (identifier == morphological_operation::dilation)
     {
-        for (std::ptrdiff_t view_col = 0; view_col < src_view.width(); ++view_col)
-        {
-            target_element = src_view(view_col, view_row);
-            for (std::size_t kernel_row = 0; kernel_row < kernel.size(); ++kernel_row)
-            {
-                flip_ker_row = kernel.size() - 1 - kernel_row; // row index of flipped kernel
-
-                for (std::size_t kernel_col = 0; kernel_col < kernel.size(); ++kernel_col)
-                {
-                    flip_ker_col = kernel.size() - 1 - kernel_col; // column index of flipped kernel
-
-                    // We ensure that we consider only those pixels which are overlapped
-                    // on a non-zero kernel_element as
-                    if (kernel.at(flip_ker_row, flip_ker_col) == 0)
-                    {
-                        continue;
-                    }
-                    // index of input signal, used for checking boundary
-                    row_boundary = view_row + (kernel.center_y() - flip_ker_row);
-                    col_boundary = view_col + (kernel.center_x() - flip_ker_col);
-
-                    // ignore input samples which are out of bound
-                    if (row_boundary >= 0 && row_boundary < src_view.height() &&
-                        col_boundary >= 0 && col_boundary < src_view.width())
-                    {
-
-                        if (identifier == morphological_operation::dilation)
-                        {
-                            target_element =
-                                (std::max)(src_view(col_boundary, row_boundary)[0], target_element);
-                        }
-                        else if (identifier == morphological_operation::erosion)
-                        {
-                            target_element =
-                                (std::min)(src_view(col_boundary, row_boundary)[0], target_element);
-                        }
-                    }
-                }
-            }
-            dst_view(view_col, view_row) = target_element;
-        }
+        if (element.rectangle)
+            morph_rectangle<sample_t>(src_view, dst_view, element, morph_max<sample_t>());
+        else
+            morph_runs<sample_t>(src_view, dst_view, element, morph_max<sample_t>());
+    }
+    else
+    {
+        if (element.rectangle)
+            morph_rectangle<sample_t>(src_view, dst_view, element, morph_min<sample_t>());
+        else
+            morph_runs<sample_t>(src_view, dst_view, element, morph_min<sample_t>());
     }
 }
 
 /// \brief Checks feasibility of the desired operation and passes parameter
 /// values to the function morph_impl alongwith individual channel views of the
-/// input image.
+/// input image. Destination may be the source view itself.
 /// \param src_view - Source/Input image view.
 /// \param dst_view - View which stores the final result of operations performed by this function.
 /// \param kernel - Kernel matrix/structuring element containing 0's and 1's
@@ -112,14 +418,11 @@ void morph(SrcView const& src_view, DstView const& dst_view, Kernel const& ker_m
     gil_function_requires<ColorSpacesCompatibleConcept<typename color_space_type<SrcView>::type,
                                                        typename color_space_type<DstView>::type>>();
 
-    gil::image<typename DstView::value_type> intermediate_img(src_view.dimensions());
-
     for (std::size_t i = 0; i < src_view.num_channels(); i++)
     {
-        morph_impl(nth_channel_view(src_view, i), nth_channel_view(view(intermediate_img), i),
-                   ker_mat, identifier);
+        morph_impl(nth_channel_view(src_view, static_cast<int>(i)),
+                   nth_channel_view(dst_view, static_cast<int>(i)), ker_mat, identifier);
     }
-    copy_pixels(view(intermediate_img), dst_view);
 }
 
 /// \brief Calculates the difference between pixel values of first image_view
@@ -179,8 +482,14 @@ template <typename SrcView, typename IntOpView, typename Kernel>
 void dilate(SrcView const& src_view, IntOpView const& int_op_view, Kernel const& ker_mat,
             int iterations)
 {
-    copy_pixels(src_view, int_op_view);
-    for (int i = 0; i < iterations; ++i)
+    if (iterations <= 0)
+    {
+        copy_pixels(src_view, int_op_view);
+        return;
+    }
+
+    morph(src_view, int_op_view, ker_mat, detail::morphological_operation::dilation);
+    for (int i = 1; i < iterations; ++i)
         morph(int_op_view, int_op_view, ker_mat, detail::morphological_operation::dilation);
 }
 
@@ -200,8 +509,14 @@ template <typename SrcView, typename IntOpView, typename Kernel>
 void erode(SrcView const& src_view, IntOpView const& int_op_view, Kernel const& ker_mat,
            int iterations)
 {
-    copy_pixels(src_view, int_op_view);
-    for (int i = 0; i < iterations; ++i)
+    if (iterations <= 0)
+    {
+        copy_pixels(src_view, int_op_view);
+        return;
+    }
+
+    morph(src_view, int_op_view, ker_mat, detail::morphological_operation::erosion);
+    for (int i = 1; i < iterations; ++i)
         morph(int_op_view, int_op_view, ker_mat, detail::morphological_operation::erosion);
 }
 
@@ -40,8 +40,8 @@ inline double normalized_sinc(double x)
 ///
 /// Lanczos response is defined as:
 /// x == 0: 1
-/// -a < x && x < a: 0
-/// otherwise: normalized_sinc(x) / normalized_sinc(x / a)
+/// -a < x && x < a: normalized_sinc(x) * normalized_sinc(x / a)
+/// otherwise: 0
 inline double lanczos(double x, std::ptrdiff_t a)
 {
     // means == but <= avoids compiler warning
@@ -49,7 +49,7 @@ inline double lanczos(double x, std::ptrdiff_t a)
         return 1;
 
     if (static_cast<double>(-a) < x && x < static_cast<double>(a))
-        return normalized_sinc(x) / normalized_sinc(x / static_cast<double>(a));
+        return normalized_sinc(x) * normalized_sinc(x / static_cast<double>(a));
 
     return 0;
 }
@@ -0,0 +1,845 @@
+//
+// Copyright 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#ifndef BOOST_GIL_IMAGE_PROCESSING_PYRAMID_HPP
+#define BOOST_GIL_IMAGE_PROCESSING_PYRAMID_HPP
+
+#include <boost/gil/channel.hpp>
+#include <boost/gil/color_base_algorithm.hpp>
+#include <boost/gil/concepts.hpp>
+#include <boost/gil/execution.hpp>
+#include <boost/gil/image_view.hpp>
+#include <boost/gil/image_view_factory.hpp>
+#include <boost/gil/metafunctions.hpp>
+#include <boost/gil/pixel.hpp>
+#include <boost/gil/extension/numeric/algorithm.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace boost { namespace gil {
+
+/// \defgroup ImagePyramid
+/// \ingroup ImageProcessing
+/// \brief Gaussian and Laplacian image pyramids
+///
+/// Every level of a Gaussian pyramid is the previous one smoothed by the 5-tap binomial
+/// filter [1 4 6 4 1] / 16 in both directions and subsampled by two, rounded up. Expansion
+/// interpolates a level to twice its size with the same filter. Samples outside of a level
+/// are reflected about its border, without repeating the border sample.
+
+namespace detail {
+
+/// \brief Sums of weighted samples, in 32-bit integers for integral samples, rounded to
+/// nearest when normalized
+template <typename Sample, bool Integral = std::is_integral<Sample>::value>
+struct pyramid_arithmetic
+{
+    using accumulator_t = std::int32_t;
+
+    static auto normalize(accumulator_t sum, int shift) -> Sample
+    {
+        return static_cast<Sample>((sum + (accumulator_t(1) << (shift - 1))) >> shift);
+    }
+};
+
+template <typename Sample>
+struct pyramid_arithmetic<Sample, false>
+{
+    using accumulator_t = Sample;
+
+    static auto normalize(accumulator_t sum, int shift) -> Sample
+    {
+        return sum / static_cast<Sample>(std::int32_t(1) << shift);
+    }
+};
+
+/// \brief Pointer to samples of view, of its base channel type, const unless view is mutable
+template <typename View>
+using pyramid_sample_pointer = typename std::conditional<view_is_mutable<View>::value,
+    typename base_channel_type<typename channel_type<View>::type>::type*,
+    typename base_channel_type<typename channel_type<View>::type>::type const*>::type;
+
+/// \brief Samples of interleaved view row
+template <typename View>
+auto pyramid_row(View const& view, std::ptrdiff_t y) -> pyramid_sample_pointer<View>
+{
+    return reinterpret_cast<pyramid_sample_pointer<View>>(view.row_begin(y));
+}
+
+/// \brief Reduces rows [y_begin, y_end) of destination, source rows are filtered horizontally
+/// once into ring of five rows, which are then filtered vertically
+template <typename SrcView, typename DstView>
+void pyramid_reduce_rows(
+    SrcView const& src, DstView const& dst, std::ptrdiff_t y_begin, std::ptrdiff_t y_end)
+{
+    using sample_t = typename base_channel_type<typename channel_type<DstView>::type>::type;
+    using arithmetic = pyramid_arithmetic<sample_t>;
+    using accumulator_t = typename arithmetic::accumulator_t;
+    constexpr std::ptrdiff_t channels = num_channels<DstView>::value;
+
+    std::ptrdiff_t const src_width = src.width();
+    std::ptrdiff_t const src_height = src.height();
+    std::ptrdiff_t const dst_width = dst.width();
+    std::ptrdiff_t const row_size = dst_width * channels;
+    // Destination columns [interior_begin, interior_end) have all taps inside the source
+    std::ptrdiff_t const interior_begin = (std::min)(std::ptrdiff_t(1), dst_width);
+    std::ptrdiff_t const interior_end =
+        (std::max)(interior_begin, (std::min)(dst_width, (src_width - 1) / 2));
+
+    std::vector<accumulator_t> ring(static_cast<std::size_t>(5 * row_size));
+    std::ptrdiff_t cached[5] = {-1, -1, -1, -1, -1};
+    auto const filtered_row = [&](std::ptrdiff_t src_y) -> accumulator_t const* {
+        std::ptrdiff_t const slot = src_y % 5;
+        accumulator_t* out = ring.data() + slot * row_size;
+        if (cached[slot] == src_y)
+            return out;
+        cached[slot] = src_y;
+
+        auto const* s = pyramid_row(src, src_y);
+        auto const border = [&](std::ptrdiff_t x) {
+            std::ptrdiff_t taps[5];
+            for (std::ptrdiff_t k = 0; k < 5; ++k)
+            {
+                taps[k] = channels *
+                    extend_coordinate(2 * x - 2 + k, src_width, boundary_mode::reflect_101);
+            }
+            for (std::ptrdiff_t c = 0; c < channels; ++c)
+            {
+                out[x * channels + c] = static_cast<accumulator_t>(s[taps[0] + c]) +
+                    4 * (static_cast<accumulator_t>(s[taps[1] + c]) + s[taps[3] + c]) +
+                    6 * static_cast<accumulator_t>(s[taps[2] + c]) + s[taps[4] + c];
+            }
+        };
+        for (std::ptrdiff_t x = 0; x < interior_begin; ++x)
+            border(x);
+        for (std::ptrdiff_t x = interior_begin; x < interior_end; ++x)
+        {
+            auto const* t = s + (2 * x - 2) * channels;
+            for (std::ptrdiff_t c = 0; c < channels; ++c)
+            {
+                out[x * channels + c] = static_cast<accumulator_t>(t[c]) +
+                    4 * (static_cast<accumulator_t>(t[channels + c]) + t[3 * channels + c]) +
+                    6 * static_cast<accumulator_t>(t[2 * channels + c]) + t[4 * channels + c];
+            }
+        }
+        for (std::ptrdiff_t x = interior_end; x < dst_width; ++x)
+            border(x);
+        return out;
+    };
+
+    for (std::ptrdiff_t y = y_begin; y < y_end; ++y)
+    {
+        accumulator_t const* rows[5];
+        for (std::ptrdiff_t k = 0; k < 5; ++k)
+        {
+            rows[k] = filtered_row(
+                extend_coordinate(2 * y - 2 + k, src_height, boundary_mode::reflect_101));
+        }
+
+        auto* d = pyramid_row(dst, y);
+        for (std::ptrdiff_t i = 0; i < row_size; ++i)
+        {
+            accumulator_t const sum = rows[0][i] + 4 * (rows[1][i] + rows[3][i]) +
+                6 * rows[2][i] + rows[4][i];
+            d[i] = arithmetic::normalize(sum, 8);
+        }
+    }
+}
+
+/// \brief Expands source into rows [y_begin, y_end) of destination, combining every
+/// interpolated sample with the destination one, source rows are interpolated horizontally
+/// once into ring of three rows, which are then interpolated vertically
+template <typename SrcView, typename DstView, typename Combine>
+void pyramid_expand_rows(
+    SrcView const& src, DstView const& dst, std::ptrdiff_t y_begin, std::ptrdiff_t y_end,
+    Combine combine)
+{
+    using sample_t = typename base_channel_type<typename channel_type<DstView>::type>::type;
+    using arithmetic = pyramid_arithmetic<sample_t>;
+    using accumulator_t = typename arithmetic::accumulator_t;
+    constexpr std::ptrdiff_t channels = num_channels<DstView>::value;
+
+    std::ptrdiff_t const src_width = src.width();
+    std::ptrdiff_t const src_height = src.height();
+    std::ptrdiff_t const dst_width = dst.width();
+    std::ptrdiff_t const row_size = dst_width * channels;
+    // Source columns [1, interior_end) have both neighbours inside the source
+    std::ptrdiff_t const interior_end = (std::max)(
+        std::ptrdiff_t(1), (std::min)(src_width - 1, dst_width / 2));
+
+    std::vector<accumulator_t> ring(static_cast<std::size_t>(3 * row_size));
+    std::ptrdiff_t cached[3] = {-1, -1, -1};
+    auto const interpolated_row = [&](std::ptrdiff_t src_y) -> accumulator_t const* {
+        std::ptrdiff_t const slot = src_y % 3;
+        accumulator_t* out = ring.data() + slot * row_size;
+        if (cached[slot] == src_y)
+            return out;
+        cached[slot] = src_y;
+
+        auto const* s = pyramid_row(src, src_y);
+        // Even destination samples are weighted 1 6 1 around source one, odd ones 4 4
+        auto const border = [&](std::ptrdiff_t x) {
+            std::ptrdiff_t const k = x / 2;
+            std::ptrdiff_t const next =
+                channels * extend_coordinate(k + 1, src_width, boundary_mode::reflect_101);
+            for (std::ptrdiff_t c = 0; c < channels; ++c)
+            {
+                if (x % 2 == 0)
+                {
+                    std::ptrdiff_t const previous =
+                        channels * extend_coordinate(k - 1, src_width, boundary_mode::reflect_101);
+                    out[x * channels + c] = static_cast<accumulator_t>(s[previous + c]) +
+                        6 * static_cast<accumulator_t>(s[k * channels + c]) + s[next + c];
+                }
+                else
+                {
+                    out[x * channels + c] =
+                        4 * (static_cast<accumulator_t>(s[k * channels + c]) + s[next + c]);
+                }
+            }
+        };
+        border(0);
+        if (dst_width > 1)
+            border(1);
+        for (std::ptrdiff_t k = 1; k < interior_end; ++k)
+        {
+            auto const* t = s + (k - 1) * channels;
+            accumulator_t* even = out + 2 * k * channels;
+            for (std::ptrdiff_t c = 0; c < channels; ++c)
+            {
+                even[c] = static_cast<accumulator_t>(t[c]) +
+                    6 * static_cast<accumulator_t>(t[channels + c]) + t[2 * channels + c];
+                even[channels + c] =
+                    4 * (static_cast<accumulator_t>(t[channels + c]) + t[2 * channels + c]);
+            }
+        }
+        for (std::ptrdiff_t x = (std::max)(std::ptrdiff_t(2), 2 * interior_end); x < dst_width;
+            ++x)
+        {
+            border(x);
+        }
+        return out;
+    };
+
+    for (std::ptrdiff_t y = y_begin; y < y_end; ++y)
+    {
+        std::ptrdiff_t const k = y / 2;
+        auto* d = pyramid_row(dst, y);
+        accumulator_t const* center = interpolated_row(k);
+        accumulator_t const* next =
+            interpolated_row(extend_coordinate(k + 1, src_height, boundary_mode::reflect_101));
+        if (y % 2 == 0)
+        {
+            accumulator_t const* previous =
+                interpolated_row(extend_coordinate(k - 1, src_height, boundary_mode::reflect_101));
+            for (std::ptrdiff_t i = 0; i < row_size; ++i)
+                combine(d[i], arithmetic::normalize(previous[i] + 6 * center[i] + next[i], 6));
+        }
+        else
+        {
+            for (std::ptrdiff_t i = 0; i < row_size; ++i)
+                combine(d[i], arithmetic::normalize(4 * (center[i] + next[i]), 6));
+        }
+    }
+}
+
+struct pyramid_assign
+{
+    template <typename Sample>
+    void operator()(Sample& dst, Sample value) const { dst = value; }
+};
+
+struct pyramid_subtract
+{
+    template <typename Sample>
+    void operator()(Sample& dst, Sample value) const { dst = static_cast<Sample>(dst - value); }
+};
+
+struct pyramid_add
+{
+    template <typename Sample>
+    void operator()(Sample& dst, Sample value) const { dst = static_cast<Sample>(dst + value); }
+};
+
+template <typename SrcView, typename DstView>
+void check_pyramid_views(SrcView const&, DstView const&)
+{
+    static_assert(std::is_pointer<typename SrcView::x_iterator>::value &&
+        std::is_pointer<typename DstView::x_iterator>::value,
+        "Pyramid views must be interleaved views of contiguous pixels");
+    static_assert(std::is_same<typename std::remove_const<typename SrcView::value_type>::type,
+        typename DstView::value_type>::value,
+        "Pyramid views must have the same pixel type");
+}
+
+template <typename Tag, typename SrcView, typename DstView, typename Combine>
+void pyramid_expand(
+    execution::execution_policy<Tag> const& policy,
+    SrcView const& src, DstView const& dst, Combine combine)
+{
+    check_pyramid_views(src, dst);
+    if ((dst.width() + 1) / 2 != src.width() || (dst.height() + 1) / 2 != src.height())
+        throw std::invalid_argument("pyramid_expand: destination must be twice source size");
+
+    for_each_row_band(policy, dst.width(), dst.height(),
+        [&](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+            pyramid_expand_rows(src, dst, y_begin, y_end, combine);
+        });
+}
+
+/// \brief Converts channels numerically, without rescaling them to range of the destination,
+/// rounding and clamping floating-point values stored into integral channels
+struct pyramid_convert_channel
+{
+    template <typename Src, typename Dst>
+    void operator()(Src const& src, Dst& dst) const
+    {
+        using src_t = typename base_channel_type<Src>::type;
+        using dst_t = typename base_channel_type<Dst>::type;
+        convert(static_cast<src_t>(src), dst, std::integral_constant<bool,
+            std::is_floating_point<src_t>::value && std::is_integral<dst_t>::value>());
+    }
+
+    template <typename Src, typename Dst>
+    void convert(Src src, Dst& dst, std::false_type) const
+    {
+        using dst_t = typename base_channel_type<Dst>::type;
+        dst = static_cast<dst_t>(src);
+    }
+
+    template <typename Src, typename Dst>
+    void convert(Src src, Dst& dst, std::true_type) const
+    {
+        using dst_t = typename base_channel_type<Dst>::type;
+        Src const rounded = std::floor(src + Src(0.5));
+        Src const low = static_cast<Src>((std::numeric_limits<dst_t>::min)());
+        Src const high = static_cast<Src>((std::numeric_limits<dst_t>::max)());
+        dst = static_cast<dst_t>((std::min)((std::max)(rounded, low), high));
+    }
+};
+
+template <typename Tag, typename SrcView, typename DstView>
+void convert_pyramid_pixels(
+    execution::execution_policy<Tag> const& policy, SrcView const& src, DstView const& dst)
+{
+    static_assert(color_spaces_are_compatible<
+        typename color_space_type<SrcView>::type, typename color_space_type<DstView>::type>::value,
+        "Pyramid views must have compatible color spaces");
+    for_each_row_band(policy, dst.width(), dst.height(),
+        [&](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+            for (std::ptrdiff_t y = y_begin; y < y_end; ++y)
+            {
+                auto src_it = src.row_begin(y);
+                auto dst_it = dst.row_begin(y);
+                for (std::ptrdiff_t x = 0; x < dst.width(); ++x)
+                {
+                    typename DstView::reference d = dst_it[x];
+                    static_for_each(src_it[x], d, pyramid_convert_channel());
+                }
+            }
+        });
+}
+
+/// \brief Levels of a pyramid, stored one after another in one allocation
+template <typename Pixel>
+class pyramid_levels
+{
+public:
+    using value_type = Pixel;
+    using view_t = typename view_type_from_pixel<Pixel>::type;
+    using const_view_t = typename view_t::const_t;
+
+    /// \brief Number of levels, the first of them of the size of the source
+    auto levels() const -> std::size_t { return dimensions_.size(); }
+
+    auto level(std::size_t i) -> view_t
+    {
+        BOOST_ASSERT(i < levels());
+        return interleaved_view(dimensions_[i].x, dimensions_[i].y,
+            pixels_.data() + offsets_[i], row_size(i));
+    }
+
+    auto level(std::size_t i) const -> const_view_t
+    {
+        BOOST_ASSERT(i < levels());
+        return interleaved_view(dimensions_[i].x, dimensions_[i].y,
+            static_cast<Pixel const*>(pixels_.data() + offsets_[i]), row_size(i));
+    }
+
+protected:
+    /// \brief Allocates levels halving given dimensions, rounded up, until both of them
+    /// are one or the number of levels is reached
+    void allocate(point_t dimensions, std::size_t max_levels)
+    {
+        dimensions_.clear();
+        offsets_.clear();
+        std::size_t size = 0;
+        if (dimensions.x > 0 && dimensions.y > 0)
+        {
+            while (dimensions_.size() < max_levels)
+            {
+                dimensions_.push_back(dimensions);
+                offsets_.push_back(size);
+                size += static_cast<std::size_t>(dimensions.x * dimensions.y);
+                if (dimensions.x == 1 && dimensions.y == 1)
+                    break;
+                dimensions = point_t((dimensions.x + 1) / 2, (dimensions.y + 1) / 2);
+            }
+        }
+        pixels_.assign(size, Pixel());
+    }
+
+    /// \brief Fills levels following the first one by reducing the previous one
+    template <typename Tag>
+    void reduce_levels(execution::execution_policy<Tag> const& policy)
+    {
+        for (std::size_t i = 1; i < levels(); ++i)
+        {
+            const_view_t const src = static_cast<pyramid_levels const&>(*this).level(i - 1);
+            view_t const dst = level(i);
+            detail::for_each_row_band(policy, dst.width(), dst.height(),
+                [&](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+                    detail::pyramid_reduce_rows(src, dst, y_begin, y_end);
+                });
+        }
+    }
+
+private:
+    auto row_size(std::size_t i) const -> std::ptrdiff_t
+    {
+        return dimensions_[i].x * static_cast<std::ptrdiff_t>(sizeof(Pixel));
+    }
+
+    std::vector<Pixel> pixels_;
+    std::vector<point_t> dimensions_;
+    std::vector<std::size_t> offsets_;
+};
+
+} // namespace detail
+
+/// \ingroup ImagePyramid
+/// \brief Reduces source to destination of half its size, rounded up, by the 5-tap binomial
+/// filter, bands of rows reduced in parallel according to the execution policy
+///
+/// Source rows are filtered horizontally once, in a ring of five rows kept in cache, from
+/// which every destination row is filtered vertically. Integral samples are accumulated
+/// in 32-bit integers and rounded to nearest.
+///
+/// \throws std::invalid_argument if destination is not of half the source size
+template <typename Tag, typename SrcView, typename DstView>
+void pyramid_reduce(
+    execution::execution_policy<Tag> const& policy, SrcView const& src, DstView const& dst)
+{
+    detail::check_pyramid_views(src, dst);
+    if (dst.width() != (src.width() + 1) / 2 || dst.height() != (src.height() + 1) / 2)
+        throw std::invalid_argument("pyramid_reduce: destination must be half source size");
+
+    detail::for_each_row_band(policy, dst.width(), dst.height(),
+        [&](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+            detail::pyramid_reduce_rows(src, dst, y_begin, y_end);
+        });
+}
+
+/// \ingroup ImagePyramid
+/// \overload
+template <typename SrcView, typename DstView>
+void pyramid_reduce(SrcView const& src, DstView const& dst)
+{
+    pyramid_reduce(execution::seq, src, dst);
+}
+
+/// \ingroup ImagePyramid
+/// \brief Expands source to destination of twice its size, or one less, by interpolation
+/// with the 5-tap binomial filter, bands of rows expanded in parallel according to the
+/// execution policy
+///
+/// \throws std::invalid_argument if source is not of half the destination size, rounded up
+template <typename Tag, typename SrcView, typename DstView>
+void pyramid_expand(
+    execution::execution_policy<Tag> const& policy, SrcView const& src, DstView const& dst)
+{
+    detail::pyramid_expand(policy, src, dst, detail::pyramid_assign());
+}
+
+/// \ingroup ImagePyramid
+/// \overload
+template <typename SrcView, typename DstView>
+void pyramid_expand(SrcView const& src, DstView const& dst)
+{
+    pyramid_expand(execution::seq, src, dst);
+}
+
+/// \ingroup ImagePyramid
+/// \brief Gaussian pyramid of an image, levels of which are owned in one allocation
+///
+/// Level 0 holds the source converted numerically to \p Pixel, every following level is
+/// reduced from the previous one by pyramid_reduce, down to 1x1 at most.
+///
+/// \tparam Pixel Pixel type of the levels, integral or floating-point channels
+template <typename Pixel>
+class gaussian_pyramid : public detail::pyramid_levels<Pixel>
+{
+public:
+    gaussian_pyramid() = default;
+
+    /// \brief Builds at most given number of levels of the view on the calling thread
+    template <typename View>
+    gaussian_pyramid(View const& view, std::size_t max_levels)
+    {
+        build(execution::seq, view, max_levels);
+    }
+
+    /// \brief Builds at most given number of levels of the view, bands of rows of every
+    /// level processed using threads allowed by execution policy
+    template <typename Tag, typename View>
+    gaussian_pyramid(
+        execution::execution_policy<Tag> const& policy, View const& view, std::size_t max_levels)
+    {
+        build(policy, view, max_levels);
+    }
+
+private:
+    template <typename Tag, typename View>
+    void build(execution::execution_policy<Tag> const& policy, View const& view,
+        std::size_t max_levels)
+    {
+        this->allocate(view.dimensions(), max_levels);
+        if (this->levels() == 0)
+            return;
+        detail::convert_pyramid_pixels(policy, view, this->level(0));
+        this->reduce_levels(policy);
+    }
+};
+
+/// \ingroup ImagePyramid
+/// \brief Laplacian pyramid of an image, levels of which are owned in one allocation
+///
+/// Every level holds the difference between the level of the Gaussian pyramid and the
+/// following one expanded by pyramid_expand, the last one the last Gaussian level itself.
+/// The pyramid is built in place, from the Gaussian one. Reconstruction is exact for
+/// integral samples.
+///
+/// \tparam Pixel Pixel type of the levels, with signed integral or floating-point channels
+template <typename Pixel>
+class laplacian_pyramid : public detail::pyramid_levels<Pixel>
+{
+    static_assert(std::is_signed<typename base_channel_type<
+        typename channel_type<Pixel>::type>::type>::value,
+        "Laplacian pyramid needs signed channels");
+
+public:
+    laplacian_pyramid() = default;
+
+    /// \brief Builds at most given number of levels of the view on the calling thread
+    template <typename View>
+    laplacian_pyramid(View const& view, std::size_t max_levels)
+    {
+        build(execution::seq, view, max_levels);
+    }
+
+    /// \brief Builds at most given number of levels of the view, bands of rows of every
+    /// level processed using threads allowed by execution policy
+    template <typename Tag, typename View>
+    laplacian_pyramid(
+        execution::execution_policy<Tag> const& policy, View const& view, std::size_t max_levels)
+    {
+        build(policy, view, max_levels);
+    }
+
+    /// \brief Reconstructs the image, of the size of level 0, into the view on the calling
+    /// thread
+    template <typename View>
+    void reconstruct(View const& view) const
+    {
+        reconstruct(execution::seq, view);
+    }
+
+    /// \brief Reconstructs the image, of the size of level 0, into the view, bands of rows
+    /// of every level processed using threads allowed by execution policy
+    ///
+    /// Levels are collapsed from the last one into a copy of the pyramid, its first level
+    /// converted numerically into the view, with floating-point values rounded and clamped
+    /// when stored into integral channels.
+    ///
+    /// \throws std::invalid_argument if the view is not of the size of level 0
+    template <typename Tag, typename View>
+    void reconstruct(execution::execution_policy<Tag> const& policy, View const& view) const
+    {
+        if (this->levels() == 0 || view.dimensions() != this->level(0).dimensions())
+            throw std::invalid_argument("laplacian_pyramid: view must be of size of level 0");
+
+        laplacian_pyramid collapsed(*this);
+        for (std::size_t i = collapsed.levels() - 1; i > 0; --i)
+        {
+            auto const& levels = static_cast<laplacian_pyramid const&>(collapsed);
+            detail::pyramid_expand(
+                policy, levels.level(i), collapsed.level(i - 1), detail::pyramid_add());
+        }
+        detail::convert_pyramid_pixels(
+            policy, static_cast<laplacian_pyramid const&>(collapsed).level(0), view);
+    }
+
+private:
+    template <typename Tag, typename View>
+    void build(execution::execution_policy<Tag> const& policy, View const& view,
+        std::size_t max_levels)
+    {
+        this->allocate(view.dimensions(), max_levels);
+        if (this->levels() == 0)
+            return;
+        detail::convert_pyramid_pixels(policy, view, this->level(0));
+        this->reduce_levels(policy);
+
+        // Level following the one subtracted from still holds Gaussian level
+        for (std::size_t i = 0; i + 1 < this->levels(); ++i)
+        {
+            auto const& levels = static_cast<laplacian_pyramid const&>(*this);
+            detail::pyramid_expand(
+                policy, levels.level(i + 1), this->level(i), detail::pyramid_subtract());
+        }
+    }
+};
+
+namespace detail {
+
+/// \brief Averages every 2x2 block of two source rows of samples into destination row,
+/// last column of odd width averaged vertically only
+template <std::ptrdiff_t Channels, typename Sample>
+void downsample_2x_row(Sample const* row0, Sample const* row1, Sample* dst,
+    std::ptrdiff_t src_width, std::ptrdiff_t dst_width)
+{
+    using arithmetic = pyramid_arithmetic<Sample>;
+    using accumulator_t = typename arithmetic::accumulator_t;
+
+    std::ptrdiff_t const pairs = src_width / 2;
+    for (std::ptrdiff_t x = 0; x < pairs; ++x)
+    {
+        for (std::ptrdiff_t c = 0; c < Channels; ++c)
+        {
+            std::ptrdiff_t const i = 2 * x * Channels + c;
+            accumulator_t const sum = static_cast<accumulator_t>(row0[i]) +
+                row0[i + Channels] + row1[i] + row1[i + Channels];
+            dst[x * Channels + c] = arithmetic::normalize(sum, 2);
+        }
+    }
+    if (pairs < dst_width)
+    {
+        for (std::ptrdiff_t c = 0; c < Channels; ++c)
+        {
+            std::ptrdiff_t const i = 2 * pairs * Channels + c;
+            accumulator_t const sum = 2 * (static_cast<accumulator_t>(row0[i]) + row1[i]);
+            dst[pairs * Channels + c] = arithmetic::normalize(sum, 2);
+        }
+    }
+}
+
+/// \brief Downsamples source rows into destination rows [y_begin, y_end), last row of odd
+/// height averaged horizontally only
+template <typename SrcView, typename DstView>
+void downsample_2x_rows(SrcView const& src, DstView const& dst,
+    std::ptrdiff_t y_begin, std::ptrdiff_t y_end, std::false_type /* planar */)
+{
+    for (std::ptrdiff_t y = y_begin; y < y_end; ++y)
+    {
+        downsample_2x_row<num_channels<DstView>::value>(pyramid_row(src, 2 * y),
+            pyramid_row(src, (std::min)(2 * y + 1, src.height() - 1)), pyramid_row(dst, y),
+            src.width(), dst.width());
+    }
+}
+
+template <typename SrcView, typename DstView>
+void downsample_2x_rows(SrcView const& src, DstView const& dst,
+    std::ptrdiff_t y_begin, std::ptrdiff_t y_end, std::true_type /* planar */)
+{
+    for (int c = 0; c < static_cast<int>(num_channels<DstView>::value); ++c)
+    {
+        downsample_2x_rows(nth_channel_view(src, c), nth_channel_view(dst, c),
+            y_begin, y_end, std::false_type());
+    }
+}
+
+} // namespace detail
+
+/// \ingroup ImagePyramid
+/// \brief Downsamples source to destination of half its size, rounded up, averaging every
+/// 2x2 block of pixels, bands of rows downsampled in parallel according to the execution
+/// policy
+///
+/// Integral samples are rounded to nearest, halves up. Pixels of the last column or row of
+/// odd width or height are averaged with themselves, as if replicated. Planar views are
+/// downsampled plane by plane.
+///
+/// \throws std::invalid_argument if destination is not of half the source size
+template <typename Tag, typename SrcView, typename DstView>
+void downsample_2x(
+    execution::execution_policy<Tag> const& policy, SrcView const& src, DstView const& dst)
+{
+    using planar_t = typename is_planar<DstView>::type;
+    static_assert(is_planar<SrcView>::value == planar_t::value,
+        "Views must be both planar or both interleaved");
+    static_assert(planar_t::value || std::is_pointer<typename SrcView::x_iterator>::value,
+        "Interleaved views must be views of contiguous pixels");
+    static_assert(std::is_same<typename std::remove_const<typename SrcView::value_type>::type,
+        typename DstView::value_type>::value,
+        "Views must have the same pixel type");
+    if (dst.width() != (src.width() + 1) / 2 || dst.height() != (src.height() + 1) / 2)
+        throw std::invalid_argument("downsample_2x: destination must be half source size");
+
+    detail::for_each_row_band(policy, dst.width(), dst.height(),
+        [&](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+            detail::downsample_2x_rows(src, dst, y_begin, y_end, planar_t());
+        });
+}
+
+/// \ingroup ImagePyramid
+/// \overload
+template <typename SrcView, typename DstView>
+void downsample_2x(SrcView const& src, DstView const& dst)
+{
+    downsample_2x(execution::seq, src, dst);
+}
+
+/// \ingroup ImagePyramid
+/// \brief Chain of mipmaps of an image, levels of which are owned in one allocation
+///
+/// Level 0 holds a copy of the source, every following level is downsampled from the
+/// previous one by downsample_2x, down to 1x1 at most. All levels are produced in a single
+/// pass over the source: as soon as two rows of a level are complete, the row of the
+/// following level is averaged from them, while they are still in cache. Bands of rows
+/// processed in parallel end at the deepest level with a row for every band, the few
+/// smaller levels below it are downsampled afterwards.
+///
+/// \tparam Pixel Interleaved pixel type of the source, planar sources are stored interleaved
+template <typename Pixel>
+class mip_chain : public detail::pyramid_levels<Pixel>
+{
+public:
+    using view_t = typename detail::pyramid_levels<Pixel>::view_t;
+
+    mip_chain() = default;
+
+    /// \brief Builds at most given number of levels of the view on the calling thread
+    template <typename View>
+    mip_chain(View const& view, std::size_t max_levels)
+    {
+        build(execution::seq, view, max_levels);
+    }
+
+    /// \brief Builds at most given number of levels of the view, using threads allowed by
+    /// execution policy for bands of rows of the deepest level with a row for every band, and
+    /// all rows they are averaged from
+    template <typename Tag, typename View>
+    mip_chain(
+        execution::execution_policy<Tag> const& policy, View const& view, std::size_t max_levels)
+    {
+        build(policy, view, max_levels);
+    }
+
+private:
+    template <typename Tag, typename View>
+    void build(execution::execution_policy<Tag> const& policy, View const& view,
+        std::size_t max_levels)
+    {
+        static_assert(std::is_same<typename std::remove_const<typename View::value_type>::type,
+            Pixel>::value, "View must have pixel type of the chain");
+
+        this->allocate(view.dimensions(), max_levels);
+        if (this->levels() == 0)
+            return;
+
+        // Rows of every level down to the split one are averaged from rows of the same band
+        // of the split level, levels with fewer rows than bands are left for the calling thread
+        std::ptrdiff_t const bands = detail::row_band_count(policy, view.width(), view.height());
+        std::size_t split = 0;
+        while (split + 1 < this->levels() && this->level(split + 1).height() >= bands)
+            ++split;
+
+        std::ptrdiff_t const split_height = this->level(split).height();
+        std::ptrdiff_t const rows_per_band_row = (view.height() + split_height - 1) / split_height;
+        detail::for_each_row_band(policy, view.width() * rows_per_band_row, split_height,
+            [&](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+                build_rows(view, split, y_begin, y_end);
+            });
+
+        for (std::size_t i = split + 1; i < this->levels(); ++i)
+        {
+            auto const& levels = static_cast<mip_chain const&>(*this);
+            view_t const dst = this->level(i);
+            detail::downsample_2x_rows(
+                levels.level(i - 1), dst, 0, dst.height(), std::false_type());
+        }
+    }
+
+    /// \brief Builds rows of all levels down to the split one averaged into its rows
+    /// [y_begin, y_end)
+    template <typename View>
+    void build_rows(
+        View const& view, std::size_t last, std::ptrdiff_t y_begin, std::ptrdiff_t y_end)
+    {
+        constexpr std::ptrdiff_t channels = num_channels<Pixel>::value;
+
+        for (std::size_t i = last; i > 0; --i)
+        {
+            y_begin *= 2;
+            y_end = (std::min)(2 * y_end, this->level(i - 1).height());
+        }
+
+        view_t const base = this->level(0);
+        for (std::ptrdiff_t y = y_begin; y < y_end; ++y)
+        {
+            std::copy(view.row_begin(y), view.row_end(y), base.row_begin(y));
+
+            // Average completed pair of rows, or single last row, into the following level
+            std::ptrdiff_t row = y;
+            for (std::size_t i = 0; i < last; ++i)
+            {
+                view_t const src = this->level(i);
+                if (row % 2 == 0 && row + 1 < src.height())
+                    break;
+                view_t const dst = this->level(i + 1);
+                detail::downsample_2x_row<channels>(
+                    detail::pyramid_row(src, row - row % 2), detail::pyramid_row(src, row),
+                    detail::pyramid_row(dst, row / 2), src.width(), dst.width());
+                row /= 2;
+            }
+        }
+    }
+};
+
+/// \ingroup ImagePyramid
+/// \brief Builds mipmaps of the view, down to 1x1, in a single pass over it, bands of rows
+/// built in parallel according to the execution policy
+template <typename Tag, typename View>
+auto build_mip_chain(execution::execution_policy<Tag> const& policy, View const& view)
+    -> mip_chain<typename std::remove_const<typename View::value_type>::type>
+{
+    return mip_chain<typename std::remove_const<typename View::value_type>::type>(
+        policy, view, (std::numeric_limits<std::size_t>::max)());
+}
+
+/// \ingroup ImagePyramid
+/// \overload
+template <typename View>
+auto build_mip_chain(View const& view)
+    -> mip_chain<typename std::remove_const<typename View::value_type>::type>
+{
+    return build_mip_chain(execution::seq, view);
+}
+
+}} // namespace boost::gil
+
+#endif
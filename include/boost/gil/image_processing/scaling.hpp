@@ -8,11 +8,23 @@
 #ifndef BOOST_GIL_IMAGE_PROCESSING_SCALING_HPP
 #define BOOST_GIL_IMAGE_PROCESSING_SCALING_HPP
 
+#include <boost/gil/channel.hpp>
+#include <boost/gil/execution.hpp>
 #include <boost/gil/image_view.hpp>
 #include <boost/gil/rgb.hpp>
 #include <boost/gil/pixel.hpp>
+#include <boost/gil/extension/numeric/convolve.hpp>
 #include <boost/gil/image_processing/numeric.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
 namespace boost { namespace gil {
 
 /// \defgroup ScalingAlgorithms
@@ -82,11 +94,400 @@ void lanczos_at(
     output_view(target_x, target_y) = result_pixel;
 }
 
+/// \ingroup ScalingAlgorithms
+/// \brief Filters of scale_separable
+enum class resampling_filter
+{
+    lanczos2, ///< Lanczos window of 2 lobes
+    lanczos3, ///< Lanczos window of 3 lobes
+    bicubic,  ///< Keys cubic convolution with a = -0.5
+    mitchell, ///< Mitchell-Netravali cubic with B = C = 1/3
+    area      ///< Mean over area of source covered by destination pixel
+};
+
+namespace detail {
+
+inline double bicubic_response(double x)
+{
+    double const a = -0.5;
+    x = std::abs(x);
+    if (x < 1)
+        return ((a + 2) * x - (a + 3)) * x * x + 1;
+    if (x < 2)
+        return ((a * x - 5 * a) * x + 8 * a) * x - 4 * a;
+    return 0;
+}
+
+inline double mitchell_response(double x)
+{
+    double const b = 1.0 / 3;
+    double const c = 1.0 / 3;
+    x = std::abs(x);
+    if (x < 1)
+    {
+        return ((12 - 9 * b - 6 * c) * x * x * x + (-18 + 12 * b + 6 * c) * x * x +
+                (6 - 2 * b)) / 6;
+    }
+    if (x < 2)
+    {
+        return ((-b - 6 * c) * x * x * x + (6 * b + 30 * c) * x * x + (-12 * b - 48 * c) * x +
+                (8 * b + 24 * c)) / 6;
+    }
+    return 0;
+}
+
+/// \brief Contributions of source samples to every destination sample along one axis
+///
+/// Destination sample i is the sum of weights[i * taps + k] * source[start[i] + k]. Weights
+/// are normalized, and those of samples outside of the source are moved to the nearest
+/// border sample. Fixed-point weights have fixed_point_bits fractional bits and the same sum.
+struct resampling_weights
+{
+    static constexpr int fixed_point_bits = 14;
+
+    std::ptrdiff_t taps = 0;
+    std::vector<std::ptrdiff_t> start;
+    std::vector<float> weights;
+    std::vector<std::int32_t> fixed_weights;
+};
+
+/// \brief Computes contributions for filter response of support in source samples
+///
+/// Sample centers are at half-integer coordinates of both source and destination, so
+/// borders of the images are aligned.
+template <typename Response>
+resampling_weights make_resampling_weights(
+    std::ptrdiff_t src_size, std::ptrdiff_t dst_size, double support, Response response)
+{
+    double const scale = static_cast<double>(dst_size) / static_cast<double>(src_size);
+    std::vector<std::vector<double>> contributions(static_cast<std::size_t>(dst_size));
+    std::vector<std::ptrdiff_t> first(static_cast<std::size_t>(dst_size));
+    resampling_weights result;
+    for (std::ptrdiff_t i = 0; i < dst_size; ++i)
+    {
+        double const center = (static_cast<double>(i) + 0.5) / scale;
+        auto const j_begin = static_cast<std::ptrdiff_t>(std::floor(center - support));
+        auto const j_end = static_cast<std::ptrdiff_t>(std::ceil(center + support));
+        auto const clamp = [src_size](std::ptrdiff_t j) {
+            return (std::max)(std::ptrdiff_t(0), (std::min)(j, src_size - 1));
+        };
+        std::ptrdiff_t const lower = clamp(j_begin);
+        std::ptrdiff_t const upper = clamp(j_end);
+
+        auto& contribution = contributions[static_cast<std::size_t>(i)];
+        contribution.assign(static_cast<std::size_t>(upper - lower + 1), 0.0);
+        double sum = 0;
+        for (std::ptrdiff_t j = j_begin; j <= j_end; ++j)
+        {
+            double const w = response(static_cast<double>(j) + 0.5 - center);
+            std::ptrdiff_t const clamped = (std::max)(lower, (std::min)(j, upper));
+            contribution[static_cast<std::size_t>(clamped - lower)] += w;
+            sum += w;
+        }
+        // Sums cancelling out to almost nothing would blow up normalized weights
+        if (std::abs(sum) > std::numeric_limits<double>::epsilon())
+        {
+            for (auto& w : contribution)
+                w /= sum;
+        }
+        first[static_cast<std::size_t>(i)] = lower;
+        result.taps = (std::max)(result.taps, upper - lower + 1);
+    }
+
+    // Every destination sample gets the same number of taps, which fit inside the source
+    result.start.resize(static_cast<std::size_t>(dst_size));
+    result.weights.assign(static_cast<std::size_t>(dst_size * result.taps), 0.0f);
+    result.fixed_weights.assign(result.weights.size(), 0);
+    double const one = static_cast<double>(std::int32_t(1) << resampling_weights::fixed_point_bits);
+    for (std::size_t i = 0; i < contributions.size(); ++i)
+    {
+        auto const& contribution = contributions[i];
+        std::ptrdiff_t const start = (std::min)(first[i], src_size - result.taps);
+        auto const offset = static_cast<std::size_t>(first[i] - start);
+        result.start[i] = start;
+        std::size_t const row = i * static_cast<std::size_t>(result.taps);
+        float* weights = result.weights.data() + row;
+        std::int32_t* fixed = result.fixed_weights.data() + row;
+
+        // Rounding error of fixed-point weights goes to the largest one, so that they sum to one
+        std::int32_t fixed_sum = 0;
+        std::size_t largest = offset;
+        for (std::size_t k = 0; k < contribution.size(); ++k)
+        {
+            weights[offset + k] = static_cast<float>(contribution[k]);
+            fixed[offset + k] = static_cast<std::int32_t>(std::lround(contribution[k] * one));
+            fixed_sum += fixed[offset + k];
+            if (std::abs(contribution[k]) > std::abs(contribution[largest - offset]))
+                largest = offset + k;
+        }
+        fixed[largest] += static_cast<std::int32_t>(one) - fixed_sum;
+    }
+    return result;
+}
+
+/// \brief Computes contributions of filter for scaling from src_size to dst_size samples
+///
+/// On downscaling, response is stretched by the scale, so that the filter removes
+/// frequencies the destination can not represent.
+inline resampling_weights make_resampling_weights(
+    std::ptrdiff_t src_size, std::ptrdiff_t dst_size, resampling_filter filter)
+{
+    double const scale = static_cast<double>(dst_size) / static_cast<double>(src_size);
+    double const stretch = (std::max)(1.0, 1.0 / scale);
+    switch (filter)
+    {
+    case resampling_filter::lanczos2:
+    case resampling_filter::lanczos3:
+    {
+        std::ptrdiff_t const a = filter == resampling_filter::lanczos2 ? 2 : 3;
+        return make_resampling_weights(src_size, dst_size, static_cast<double>(a) * stretch,
+            [=](double x) { return lanczos(x / stretch, a); });
+    }
+    case resampling_filter::bicubic:
+        return make_resampling_weights(src_size, dst_size, 2 * stretch,
+            [=](double x) { return bicubic_response(x / stretch); });
+    case resampling_filter::mitchell:
+        return make_resampling_weights(src_size, dst_size, 2 * stretch,
+            [=](double x) { return mitchell_response(x / stretch); });
+    case resampling_filter::area:
+    default:
+    {
+        // Overlap of source sample with area covered by destination sample
+        double const half = 0.5 / scale;
+        return make_resampling_weights(src_size, dst_size, half + 0.5, [=](double x) {
+            return (std::max)(0.0, (std::min)(x + 0.5, half) - (std::max)(x - 0.5, -half));
+        });
+    }
+    }
+}
+
+/// \brief Arithmetic of passes of scale_separable
+///
+/// 8-bit samples are filtered with fixed-point weights into intermediate samples with
+/// intermediate_bits fractional bits, which keep overshoots of the filter for the vertical
+/// pass. Other samples are filtered in floating-point.
+template <bool FixedPoint>
+struct resampling_arithmetic
+{
+    using sample_t = std::uint8_t;
+    using intermediate_t = std::int16_t;
+    using acc_t = std::int32_t;
+
+    static constexpr int intermediate_bits = 6;
+
+    static acc_t weight(resampling_weights const& weights, std::size_t i)
+    {
+        return weights.fixed_weights[i];
+    }
+
+    static intermediate_t to_intermediate(acc_t acc)
+    {
+        constexpr int shift = resampling_weights::fixed_point_bits - intermediate_bits;
+        acc_t const value = (acc + (acc_t(1) << (shift - 1))) >> shift;
+        return static_cast<intermediate_t>((std::max)(
+            acc_t((std::numeric_limits<intermediate_t>::min)()),
+            (std::min)(acc_t((std::numeric_limits<intermediate_t>::max)()), value)));
+    }
+
+    static float to_output(acc_t acc)
+    {
+        constexpr int shift = resampling_weights::fixed_point_bits + intermediate_bits;
+        return static_cast<float>((acc + (acc_t(1) << (shift - 1))) >> shift);
+    }
+};
+
+template <>
+struct resampling_arithmetic<false>
+{
+    using sample_t = float;
+    using intermediate_t = float;
+    using acc_t = float;
+
+    static acc_t weight(resampling_weights const& weights, std::size_t i)
+    {
+        return weights.weights[i];
+    }
+
+    static intermediate_t to_intermediate(acc_t acc) { return acc; }
+    static float to_output(acc_t acc) { return acc; }
+};
+
+/// \brief Horizontal pass of one row of interleaved samples
+template <std::size_t Channels, typename Arithmetic>
+void resample_row(
+    typename Arithmetic::sample_t const* src,
+    typename Arithmetic::intermediate_t* dst,
+    std::ptrdiff_t dst_width,
+    resampling_weights const& weights,
+    Arithmetic)
+{
+    using acc_t = typename Arithmetic::acc_t;
+    constexpr auto n = static_cast<std::ptrdiff_t>(Channels);
+    std::ptrdiff_t const taps = weights.taps;
+    for (std::ptrdiff_t x = 0; x < dst_width; ++x)
+    {
+        acc_t acc[Channels] = {};
+        auto const w = static_cast<std::size_t>(x * taps);
+        auto const* s = src + weights.start[static_cast<std::size_t>(x)] * n;
+        for (std::ptrdiff_t k = 0; k < taps; ++k, s += n)
+        {
+            acc_t const weight = Arithmetic::weight(weights, w + static_cast<std::size_t>(k));
+            for (std::size_t c = 0; c < Channels; ++c)
+                acc[c] += weight * static_cast<acc_t>(s[c]);
+        }
+        for (std::size_t c = 0; c < Channels; ++c)
+            dst[x * n + static_cast<std::ptrdiff_t>(c)] = Arithmetic::to_intermediate(acc[c]);
+    }
+}
+
+template <typename Channel>
+void store_resampled_channel(float value, Channel& dst, std::true_type /* integral */)
+{
+    double const lower = static_cast<double>(channel_traits<Channel>::min_value());
+    double const upper = static_cast<double>(channel_traits<Channel>::max_value());
+    double const rounded = std::floor(static_cast<double>(value) + 0.5);
+    dst = static_cast<Channel>((std::max)(lower, (std::min)(upper, rounded)));
+}
+
+template <typename Channel>
+void store_resampled_channel(float value, Channel& dst, std::false_type /* floating-point */)
+{
+    dst = static_cast<Channel>(value);
+}
+
+/// \brief Scales src into dst, by horizontal pass into rows of intermediate samples
+/// followed by vertical pass
+///
+/// Bands of destination rows are processed in parallel, each with its own intermediate rows.
+/// Vertical pass accumulates whole rows of intermediate samples, in vectorized loops.
+template <typename Arithmetic, typename ExecutionPolicy, typename SrcView, typename DstView>
+void scale_separable_impl(
+    ExecutionPolicy const& policy, SrcView const& src, DstView const& dst,
+    resampling_weights const& weights_x, resampling_weights const& weights_y)
+{
+    using sample_t = typename Arithmetic::sample_t;
+    using intermediate_t = typename Arithmetic::intermediate_t;
+    using acc_t = typename Arithmetic::acc_t;
+    using dst_channel_t = typename channel_type<DstView>::type;
+    constexpr std::size_t channels = num_channels<SrcView>::value;
+    constexpr auto n = static_cast<std::ptrdiff_t>(channels);
+
+    std::ptrdiff_t const src_width = src.width();
+    std::ptrdiff_t const dst_width = dst.width();
+    std::ptrdiff_t const row_size = dst_width * n;
+    std::ptrdiff_t const taps = weights_y.taps;
+
+    for_each_row_band(policy, dst_width, dst.height(),
+        [&](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+            std::ptrdiff_t const first_row = weights_y.start[static_cast<std::size_t>(y_begin)];
+            std::ptrdiff_t const last_row =
+                weights_y.start[static_cast<std::size_t>(y_end - 1)] + taps;
+            std::vector<sample_t> src_row(static_cast<std::size_t>(src_width * n));
+            std::vector<intermediate_t> rows(
+                static_cast<std::size_t>((last_row - first_row) * row_size));
+            for (std::ptrdiff_t sy = first_row; sy < last_row; ++sy)
+            {
+                auto it = src.row_begin(sy);
+                for (std::ptrdiff_t x = 0; x < src_width; ++x)
+                {
+                    for (std::size_t c = 0; c < channels; ++c)
+                    {
+                        src_row[static_cast<std::size_t>(x * n) + c] =
+                            static_cast<sample_t>(it[x][c]);
+                    }
+                }
+                resample_row<channels>(src_row.data(),
+                    rows.data() + (sy - first_row) * row_size, dst_width, weights_x, Arithmetic{});
+            }
+
+            std::vector<acc_t> acc(static_cast<std::size_t>(row_size));
+            for (std::ptrdiff_t y = y_begin; y < y_end; ++y)
+            {
+                std::fill(acc.begin(), acc.end(), acc_t(0));
+                auto const w = static_cast<std::size_t>(y * taps);
+                std::ptrdiff_t const start = weights_y.start[static_cast<std::size_t>(y)];
+                for (std::ptrdiff_t k = 0; k < taps; ++k)
+                {
+                    acc_t const weight =
+                        Arithmetic::weight(weights_y, w + static_cast<std::size_t>(k));
+                    if (detail::is_zero(weight))
+                        continue;
+                    accumulate_weighted_samples(rows.data() + (start + k - first_row) * row_size,
+                        weight, acc.data(), row_size);
+                }
+
+                auto it = dst.row_begin(y);
+                for (std::ptrdiff_t x = 0; x < dst_width; ++x)
+                {
+                    for (std::size_t c = 0; c < channels; ++c)
+                    {
+                        store_resampled_channel(
+                            Arithmetic::to_output(acc[static_cast<std::size_t>(x * n) + c]),
+                            it[x][c], std::is_integral<dst_channel_t>{});
+                    }
+                }
+            }
+        });
+}
+
+template <typename ExecutionPolicy, typename SrcView, typename DstView>
+void scale_separable_weights(
+    ExecutionPolicy const& policy, SrcView const& src, DstView const& dst,
+    resampling_weights const& weights_x, resampling_weights const& weights_y)
+{
+    static_assert(num_channels<SrcView>::value == num_channels<DstView>::value,
+        "Source and destination views must have the same number of channels");
+    using arithmetic_t = resampling_arithmetic<
+        std::is_same<typename channel_type<SrcView>::type, std::uint8_t>::value &&
+        std::is_same<typename channel_type<DstView>::type, std::uint8_t>::value>;
+    scale_separable_impl<arithmetic_t>(policy, src, dst, weights_x, weights_y);
+}
+
+} // namespace detail
+
+/// \ingroup ScalingAlgorithms
+/// \brief Scales source view to dimensions of destination view with separable filter,
+/// using threads allowed by execution policy
+///
+/// Contributions of source pixels to every destination column and row are computed once,
+/// with start index and normalized weights, then source rows are filtered horizontally into
+/// intermediate rows, which are filtered vertically. The filter is stretched on downscaling,
+/// so that the result is not aliased. Pixels outside of source replicate its border.
+/// Views with 8-bit channels are processed in fixed-point arithmetic, others in
+/// floating-point with results rounded and saturated for integral channels.
+template <typename ExecutionPolicy, typename SrcView, typename DstView>
+auto scale_separable(
+    ExecutionPolicy const& policy, SrcView const& src, DstView const& dst,
+    resampling_filter filter = resampling_filter::lanczos3)
+    -> typename std::enable_if<execution::is_execution_policy<ExecutionPolicy>::value>::type
+{
+    if (dst.width() == 0 || dst.height() == 0)
+        return;
+    if (src.width() == 0 || src.height() == 0)
+        throw std::invalid_argument("scale_separable: source view is empty");
+
+    detail::scale_separable_weights(policy, src, dst,
+        detail::make_resampling_weights(src.width(), dst.width(), filter),
+        detail::make_resampling_weights(src.height(), dst.height(), filter));
+}
+
+/// \ingroup ScalingAlgorithms
+/// \brief Scales source view to dimensions of destination view with separable filter
+/// \overload
+template <typename SrcView, typename DstView>
+void scale_separable(
+    SrcView const& src, DstView const& dst,
+    resampling_filter filter = resampling_filter::lanczos3)
+{
+    scale_separable(execution::seq, src, dst, filter);
+}
+
 /// \brief Complete Lanczos algorithm
 /// \ingroup DownScalingAlgorithms
 ///
 /// This algorithm does full pass over resulting image and convolves pixels from
-/// original image. Do note that it might be a good idea to have a look at test
+/// original image, with contributions computed once per column and row as in
+/// scale_separable. Do note that it might be a good idea to have a look at test
 /// output as there might be ringing artifacts.
 /// Based on wikipedia article:
 /// https://en.wikipedia.org/wiki/Lanczos_resampling
@@ -94,20 +495,19 @@ void lanczos_at(
 template <typename ImageView>
 void scale_lanczos(ImageView input_view, ImageView output_view, std::ptrdiff_t a)
 {
-    double scale_x = (static_cast<double>(output_view.width()))
-                     / static_cast<double>(input_view.width());
-    double scale_y = (static_cast<double>(output_view.height()))
-                     / static_cast<double>(input_view.height());
+    if (output_view.width() == 0 || output_view.height() == 0)
+        return;
 
-    using x_coord_t = typename ImageView::x_coord_t;
-    using y_coord_t = typename ImageView::y_coord_t;
-    for (y_coord_t y = 0; y < output_view.height(); ++y)
-    {
-        for (x_coord_t x = 0; x < output_view.width(); ++x)
-        {
-            lanczos_at(input_view, output_view, x / scale_x, y / scale_y, x, y, a);
-        }
-    }
+    auto const weights = [a](std::ptrdiff_t src_size, std::ptrdiff_t dst_size) {
+        double const scale = static_cast<double>(dst_size) / static_cast<double>(src_size);
+        double const stretch = (std::max)(1.0, 1.0 / scale);
+        return detail::make_resampling_weights(src_size, dst_size,
+            static_cast<double>(a) * stretch,
+            [=](double x) { return lanczos(x / stretch, a); });
+    };
+    detail::scale_separable_weights(execution::seq, input_view, output_view,
+        weights(input_view.width(), output_view.width()),
+        weights(input_view.height(), output_view.height()));
 }
 
 }} // namespace boost::gil
@@ -0,0 +1,407 @@
+//
+// Copyright 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#ifndef BOOST_GIL_IMAGE_PROCESSING_STENCIL_HPP
+#define BOOST_GIL_IMAGE_PROCESSING_STENCIL_HPP
+
+#include <boost/gil/extension/numeric/algorithm.hpp>
+
+#include <boost/gil/concepts.hpp>
+#include <boost/gil/execution.hpp>
+#include <boost/gil/image.hpp>
+#include <boost/gil/point.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace boost { namespace gil {
+
+/// \ingroup ImageProcessing
+/// \brief Neighbourhood of pixel, which stencil operation is applied to
+///
+/// Neighbour i is the pixel at i-th offset of the stencil, relative to the center pixel.
+/// Offsets are cached by the locator, so for memory-based views reading a neighbour
+/// is a single memory access, without recomputing its coordinates.
+template <typename Locator>
+class stencil_neighbourhood
+{
+public:
+    using locator_t = Locator;
+    using cached_location_t = typename Locator::cached_location_t;
+    using reference = typename Locator::reference;
+
+    stencil_neighbourhood(
+        Locator const& center,
+        cached_location_t const* offsets,
+        std::size_t size)
+        : center_(center), offsets_(offsets), size_(size)
+    {
+    }
+
+    /// \brief Pixel at i-th offset of the stencil
+    auto operator[](std::size_t i) const -> reference
+    {
+        BOOST_ASSERT(i < size_);
+        return center_[offsets_[i]];
+    }
+
+    auto center() const -> reference { return *center_; }
+    auto size() const -> std::size_t { return size_; }
+    auto locator() const -> Locator const& { return center_; }
+
+private:
+    Locator center_;
+    cached_location_t const* offsets_;
+    std::size_t size_;
+};
+
+namespace detail {
+
+/// \brief How stencil engine handles pixels with neighbours outside the source view
+struct stencil_boundary
+{
+    boundary_mode mode{boundary_mode::replicate};
+    bool interior_only{false};  // pixels with neighbours outside are not computed
+    bool zero_border{false};    // pixels not computed are set to zero
+    bool padded{false};         // neighbours outside are read from the source memory
+};
+
+inline auto make_stencil_boundary(boundary_option option) -> stencil_boundary
+{
+    stencil_boundary boundary;
+    switch (option)
+    {
+    case boundary_option::output_ignore:
+        boundary.interior_only = true;
+        break;
+    case boundary_option::output_zero:
+        boundary.interior_only = true;
+        boundary.zero_border = true;
+        break;
+    case boundary_option::extend_padded:
+        boundary.padded = true;
+        break;
+    case boundary_option::extend_zero:
+        boundary.mode = boundary_mode::constant;
+        break;
+    case boundary_option::extend_constant:
+        boundary.mode = boundary_mode::replicate;
+        break;
+    }
+    return boundary;
+}
+
+/// \brief Caches stencil offsets for locator of given type
+template <typename Locator>
+auto cache_offsets(Locator const& loc, std::vector<point_t> const& offsets)
+    -> std::vector<typename Locator::cached_location_t>
+{
+    std::vector<typename Locator::cached_location_t> cached;
+    cached.reserve(offsets.size());
+    for (auto const& offset : offsets)
+        cached.push_back(loc.cache_location(offset.x, offset.y));
+    return cached;
+}
+
+/// \brief Applies stencil operation to pixels of rows [y_begin, y_end) of computed region
+///
+/// Pixels of interior region read their neighbours directly from the source. Remaining
+/// pixels of computed region, in the border strips, read them from the extended view.
+template <typename SrcView, typename ExtendedView, typename DstView, typename Op>
+void apply_stencil_rows(
+    SrcView const& src_view,
+    ExtendedView const& extended_view,
+    DstView const& dst_view,
+    std::vector<point_t> const& offsets,
+    Op& op,
+    view_region const& computed,
+    view_region const& interior,
+    std::ptrdiff_t y_begin,
+    std::ptrdiff_t y_end)
+{
+    using src_locator_t = typename SrcView::xy_locator;
+    using extended_locator_t = typename ExtendedView::xy_locator;
+    auto const src_offsets = cache_offsets(src_view.xy_at(0, 0), offsets);
+    auto const extended_offsets = cache_offsets(extended_view.xy_at(0, 0), offsets);
+
+    auto checked = [&](std::ptrdiff_t x_begin, std::ptrdiff_t x_end, std::ptrdiff_t y) {
+        if (x_begin >= x_end)
+            return;
+        auto dst_it = dst_view.row_begin(y);
+        auto loc = extended_view.xy_at(x_begin, y);
+        for (std::ptrdiff_t x = x_begin; x < x_end; ++x, ++loc.x())
+        {
+            dst_it[x] = op(stencil_neighbourhood<extended_locator_t>(
+                loc, extended_offsets.data(), offsets.size()));
+        }
+    };
+
+    for (std::ptrdiff_t y = (std::max)(y_begin, computed.y_begin);
+        y < (std::min)(y_end, computed.y_end); ++y)
+    {
+        // Unchecked span [x0, x1) of the row, empty for rows of the border strips
+        bool const inner_row = y >= interior.y_begin && y < interior.y_end;
+        std::ptrdiff_t const x0 = inner_row ? interior.x_begin : computed.x_end;
+        std::ptrdiff_t const x1 = inner_row ? interior.x_end : computed.x_end;
+
+        checked(computed.x_begin, x0, y);
+        if (x0 < x1)
+        {
+            auto dst_it = dst_view.row_begin(y);
+            auto loc = src_view.xy_at(x0, y);
+            for (std::ptrdiff_t x = x0; x < x1; ++x, ++loc.x())
+            {
+                dst_it[x] = op(stencil_neighbourhood<src_locator_t>(
+                    loc, src_offsets.data(), offsets.size()));
+            }
+        }
+        checked(x1, computed.x_end, y);
+    }
+}
+
+/// \brief Reach of the stencil before and after the center pixel
+inline void stencil_reach(std::vector<point_t> const& offsets, point_t& before, point_t& after)
+{
+    before = point_t(0, 0);
+    after = point_t(0, 0);
+    for (auto const& offset : offsets)
+    {
+        before.x = (std::max)(before.x, -offset.x);
+        before.y = (std::max)(before.y, -offset.y);
+        after.x = (std::max)(after.x, offset.x);
+        after.y = (std::max)(after.y, offset.y);
+    }
+}
+
+template <typename Tag, typename SrcView, typename DstView, typename Op>
+void apply_stencil_impl(
+    execution::execution_policy<Tag> const& policy,
+    SrcView const& src_view,
+    DstView const& dst_view,
+    std::vector<point_t> const& offsets,
+    Op const& op,
+    stencil_boundary const& boundary,
+    typename SrcView::value_type const& constant)
+{
+    gil_function_requires<ImageViewConcept<SrcView>>();
+    gil_function_requires<MutableImageViewConcept<DstView>>();
+    BOOST_ASSERT(src_view.dimensions() == dst_view.dimensions());
+
+    point_t before;
+    point_t after;
+    stencil_reach(offsets, before, after);
+
+    view_region all;
+    all.x_end = src_view.width();
+    all.y_end = src_view.height();
+    view_region const interior =
+        boundary.padded ? all : interior_region(src_view, before, after);
+    view_region const computed = boundary.interior_only ? interior : all;
+    auto const extended_view = boundary_extended_view(src_view, 0, boundary.mode, constant);
+
+    typename DstView::value_type dst_zero;
+    pixel_zeros_t<typename DstView::value_type>()(dst_zero);
+
+    detail::for_each_row_band(policy, src_view.width(), src_view.height(),
+        [&](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+            // Each band applies its own copy of the operation
+            Op band_op(op);
+            apply_stencil_rows(src_view, extended_view, dst_view, offsets, band_op,
+                computed, interior, y_begin, y_end);
+
+            if (!boundary.zero_border)
+                return;
+            for (std::ptrdiff_t y = y_begin; y < y_end; ++y)
+            {
+                auto dst_it = dst_view.row_begin(y);
+                if (y < computed.y_begin || y >= computed.y_end || computed.empty())
+                {
+                    std::fill(dst_it, dst_it + dst_view.width(), dst_zero);
+                    continue;
+                }
+                std::fill(dst_it, dst_it + computed.x_begin, dst_zero);
+                std::fill(dst_it + computed.x_end, dst_it + dst_view.width(), dst_zero);
+            }
+        });
+}
+
+} // namespace detail
+
+/// \ingroup ImageProcessing
+/// \brief Applies stencil operation to every pixel of source view, using threads allowed
+/// by execution policy
+///
+/// For each pixel, op is invoked with stencil_neighbourhood of the pixel, giving its
+/// neighbours at the given offsets, and returns the destination pixel. Offsets are
+/// cached from the locator once, before the loops. Pixels with all neighbours inside
+/// the view read them directly, without any bounds checks. Only pixels of the border
+/// strips read their neighbours through boundary_extended_view, according to the
+/// boundary option. Bands of rows are processed in parallel, each with its own copy
+/// of op, so op must be callable with neighbourhoods of both locator types.
+/// Destination view must not alias the source view, as neighbours of a pixel are read
+/// after preceding pixels have been written.
+///
+/// \param offsets Offsets of the neighbours relative to the center pixel
+/// \param option Handling of pixels with neighbours outside the view, as for convolution
+/// \tparam SrcView Models ImageViewConcept
+/// \tparam DstView Models MutableImageViewConcept
+template <typename Tag, typename SrcView, typename DstView, typename Op>
+void apply_stencil(
+    execution::execution_policy<Tag> const& policy,
+    SrcView const& src_view,
+    DstView const& dst_view,
+    std::vector<point_t> const& offsets,
+    Op const& op,
+    boundary_option option = boundary_option::extend_constant)
+{
+    typename SrcView::value_type zero;
+    pixel_zeros_t<typename SrcView::value_type>()(zero);
+    detail::apply_stencil_impl(
+        policy, src_view, dst_view, offsets, op, detail::make_stencil_boundary(option), zero);
+}
+
+/// \ingroup ImageProcessing
+/// \brief Applies stencil operation to every pixel of source view, extended beyond its
+/// boundary according to boundary mode, using threads allowed by execution policy
+/// \param constant Pixel read outside the view for constant mode
+template <typename Tag, typename SrcView, typename DstView, typename Op>
+void apply_stencil(
+    execution::execution_policy<Tag> const& policy,
+    SrcView const& src_view,
+    DstView const& dst_view,
+    std::vector<point_t> const& offsets,
+    Op const& op,
+    boundary_mode mode,
+    typename SrcView::value_type const& constant)
+{
+    detail::stencil_boundary boundary;
+    boundary.mode = mode;
+    detail::apply_stencil_impl(policy, src_view, dst_view, offsets, op, boundary, constant);
+}
+
+/// \ingroup ImageProcessing
+/// \brief Applies stencil operation to every pixel of source view on the calling thread
+template <typename SrcView, typename DstView, typename Op>
+void apply_stencil(
+    SrcView const& src_view,
+    DstView const& dst_view,
+    std::vector<point_t> const& offsets,
+    Op const& op,
+    boundary_option option = boundary_option::extend_constant)
+{
+    apply_stencil(execution::seq, src_view, dst_view, offsets, op, option);
+}
+
+/// \ingroup ImageProcessing
+/// \brief Applies stencil operation to every pixel of source view, extended beyond its
+/// boundary according to boundary mode, on the calling thread
+template <typename SrcView, typename DstView, typename Op>
+void apply_stencil(
+    SrcView const& src_view,
+    DstView const& dst_view,
+    std::vector<point_t> const& offsets,
+    Op const& op,
+    boundary_mode mode,
+    typename SrcView::value_type const& constant)
+{
+    apply_stencil(execution::seq, src_view, dst_view, offsets, op, mode, constant);
+}
+
+/// \ingroup ImageProcessing
+/// \brief Applies stencil operation to corresponding pixels of three source views of the
+/// same dimensions, using threads allowed by execution policy
+///
+/// For each pixel with all neighbours inside the views, op is invoked with the three
+/// stencil_neighbourhood of the pixel, one of each source view, like entries of a tensor
+/// given by separate views. Remaining pixels of destination view are left unchanged.
+/// Destination view must not alias any of the source views.
+template
+<
+    typename Tag,
+    typename SrcView0, typename SrcView1, typename SrcView2,
+    typename DstView,
+    typename Op
+>
+void apply_stencil(
+    execution::execution_policy<Tag> const& policy,
+    SrcView0 const& src_view0,
+    SrcView1 const& src_view1,
+    SrcView2 const& src_view2,
+    DstView const& dst_view,
+    std::vector<point_t> const& offsets,
+    Op const& op)
+{
+    gil_function_requires<ImageViewConcept<SrcView0>>();
+    gil_function_requires<ImageViewConcept<SrcView1>>();
+    gil_function_requires<ImageViewConcept<SrcView2>>();
+    gil_function_requires<MutableImageViewConcept<DstView>>();
+    BOOST_ASSERT(src_view0.dimensions() == src_view1.dimensions());
+    BOOST_ASSERT(src_view1.dimensions() == src_view2.dimensions());
+    BOOST_ASSERT(src_view2.dimensions() == dst_view.dimensions());
+
+    point_t before;
+    point_t after;
+    detail::stencil_reach(offsets, before, after);
+    view_region const interior = interior_region(src_view0, before, after);
+    if (interior.empty())
+        return;
+
+    using locator0_t = typename SrcView0::xy_locator;
+    using locator1_t = typename SrcView1::xy_locator;
+    using locator2_t = typename SrcView2::xy_locator;
+    auto const offsets0 = detail::cache_offsets(src_view0.xy_at(0, 0), offsets);
+    auto const offsets1 = detail::cache_offsets(src_view1.xy_at(0, 0), offsets);
+    auto const offsets2 = detail::cache_offsets(src_view2.xy_at(0, 0), offsets);
+
+    detail::for_each_row_band(policy, src_view0.width(), src_view0.height(),
+        [&](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+            Op band_op(op);
+            for (std::ptrdiff_t y = (std::max)(y_begin, interior.y_begin);
+                y < (std::min)(y_end, interior.y_end); ++y)
+            {
+                auto dst_it = dst_view.row_begin(y);
+                auto loc0 = src_view0.xy_at(interior.x_begin, y);
+                auto loc1 = src_view1.xy_at(interior.x_begin, y);
+                auto loc2 = src_view2.xy_at(interior.x_begin, y);
+                for (std::ptrdiff_t x = interior.x_begin; x < interior.x_end;
+                    ++x, ++loc0.x(), ++loc1.x(), ++loc2.x())
+                {
+                    dst_it[x] = band_op(
+                        stencil_neighbourhood<locator0_t>(loc0, offsets0.data(), offsets.size()),
+                        stencil_neighbourhood<locator1_t>(loc1, offsets1.data(), offsets.size()),
+                        stencil_neighbourhood<locator2_t>(loc2, offsets2.data(), offsets.size()));
+                }
+            }
+        });
+}
+
+/// \ingroup ImageProcessing
+/// \brief Applies stencil operation to corresponding pixels of three source views of the
+/// same dimensions on the calling thread
+template
+<
+    typename SrcView0, typename SrcView1, typename SrcView2,
+    typename DstView,
+    typename Op
+>
+void apply_stencil(
+    SrcView0 const& src_view0,
+    SrcView1 const& src_view1,
+    SrcView2 const& src_view2,
+    DstView const& dst_view,
+    std::vector<point_t> const& offsets,
+    Op const& op)
+{
+    apply_stencil(execution::seq, src_view0, src_view1, src_view2, dst_view, offsets, op);
+}
+
+}} // namespace boost::gil
+
+#endif
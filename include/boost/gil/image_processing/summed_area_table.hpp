@@ -0,0 +1,217 @@
+//
+// Copyright 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#ifndef BOOST_GIL_IMAGE_PROCESSING_SUMMED_AREA_TABLE_HPP
+#define BOOST_GIL_IMAGE_PROCESSING_SUMMED_AREA_TABLE_HPP
+
+#include <boost/gil/concepts.hpp>
+#include <boost/gil/execution.hpp>
+#include <boost/gil/pixel.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace boost { namespace gil {
+
+/// \ingroup ImageProcessing
+/// \brief Summed-area table (integral image) of an image view
+///
+/// Holds, for every channel, sums of samples of all rectangles anchored at the top-left
+/// corner of the image, so sum over any rectangle is computed from four table entries
+/// in constant time, regardless of its size. Optionally holds sums of squared samples
+/// as well, giving variance of any rectangle in constant time.
+///
+/// Table of each channel is (width + 1) x (height + 1), with zero first row and column.
+/// It is built in two passes: prefix sums along rows, processed by bands of rows in
+/// parallel, followed by accumulation of rows down the columns, processed by strips
+/// of columns in parallel. The column pass adds contiguous rows, which the compiler
+/// vectorizes.
+///
+/// \tparam T Accumulator type, double (default), std::int64_t or std::uint64_t.
+/// Double is exact for sums of integer samples below 2^53.
+template <typename T = double>
+class summed_area_table
+{
+    static_assert(
+        std::is_same<T, double>::value ||
+        std::is_same<T, std::int64_t>::value ||
+        std::is_same<T, std::uint64_t>::value,
+        "Accumulator must be double, std::int64_t or std::uint64_t");
+
+public:
+    using value_type = T;
+
+    summed_area_table() = default;
+
+    /// \brief Builds table of given view on the calling thread
+    /// \param with_squares If true, also builds table of sums of squared samples
+    template <typename View>
+    explicit summed_area_table(View const& view, bool with_squares = false)
+    {
+        build(execution::seq, view, with_squares);
+    }
+
+    /// \brief Builds table of given view using threads allowed by execution policy
+    /// \param with_squares If true, also builds table of sums of squared samples
+    template <typename Tag, typename View>
+    summed_area_table(
+        execution::execution_policy<Tag> const& policy, View const& view, bool with_squares = false)
+    {
+        build(policy, view, with_squares);
+    }
+
+    auto width() const -> std::ptrdiff_t { return width_; }
+    auto height() const -> std::ptrdiff_t { return height_; }
+    auto num_channels() const -> std::size_t { return num_channels_; }
+    auto has_squares() const -> bool { return !squares_.empty(); }
+
+    /// \brief Sum of samples of given channel over rectangle of given origin and size
+    auto rect_sum(
+        std::ptrdiff_t x,
+        std::ptrdiff_t y,
+        std::ptrdiff_t w,
+        std::ptrdiff_t h,
+        std::size_t channel = 0) const -> T
+    {
+        return rect(sums_, x, y, w, h, channel);
+    }
+
+    /// \brief Sum of squared samples of given channel over rectangle of given origin and size
+    /// \pre Table has been built with squares
+    auto rect_square_sum(
+        std::ptrdiff_t x,
+        std::ptrdiff_t y,
+        std::ptrdiff_t w,
+        std::ptrdiff_t h,
+        std::size_t channel = 0) const -> T
+    {
+        BOOST_ASSERT(has_squares());
+        return rect(squares_, x, y, w, h, channel);
+    }
+
+    /// \brief Sum of samples of given channel over rectangle [0, x) x [0, y)
+    auto at(std::ptrdiff_t x, std::ptrdiff_t y, std::size_t channel = 0) const -> T
+    {
+        BOOST_ASSERT(x >= 0 && x <= width_ && y >= 0 && y <= height_);
+        BOOST_ASSERT(channel < num_channels_);
+        return sums_[index(x, y, channel)];
+    }
+
+private:
+    auto stride() const -> std::size_t { return static_cast<std::size_t>(width_ + 1); }
+
+    auto plane_size() const -> std::size_t
+    {
+        return stride() * static_cast<std::size_t>(height_ + 1);
+    }
+
+    auto index(std::ptrdiff_t x, std::ptrdiff_t y, std::size_t channel) const -> std::size_t
+    {
+        return channel * plane_size() + static_cast<std::size_t>(y) * stride() +
+               static_cast<std::size_t>(x);
+    }
+
+    auto rect(
+        std::vector<T> const& table,
+        std::ptrdiff_t x,
+        std::ptrdiff_t y,
+        std::ptrdiff_t w,
+        std::ptrdiff_t h,
+        std::size_t channel) const -> T
+    {
+        BOOST_ASSERT(x >= 0 && y >= 0 && w >= 0 && h >= 0);
+        BOOST_ASSERT(x + w <= width_ && y + h <= height_);
+        BOOST_ASSERT(channel < num_channels_);
+        std::size_t const top = index(x, y, channel);
+        std::size_t const bottom = index(x, y + h, channel);
+        std::size_t const right = static_cast<std::size_t>(w);
+        // Additions first keep intermediate values non-negative for unsigned accumulator
+        return (table[bottom + right] + table[top]) - (table[top + right] + table[bottom]);
+    }
+
+    template <typename Tag, typename View>
+    void build(execution::execution_policy<Tag> const& policy, View const& view, bool with_squares)
+    {
+        gil_function_requires<ImageViewConcept<View>>();
+
+        width_ = view.width();
+        height_ = view.height();
+        num_channels_ = gil::num_channels<View>::value;
+        sums_.assign(num_channels_ * plane_size(), T(0));
+        if (with_squares)
+            squares_.assign(sums_.size(), T(0));
+
+        std::ptrdiff_t const table_stride = static_cast<std::ptrdiff_t>(stride());
+
+        // Prefix sums along rows, rows are independent
+        detail::for_each_row_band(policy, width_, height_,
+            [&](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+                for (std::ptrdiff_t y = y_begin; y < y_end; ++y)
+                {
+                    auto src_it = view.row_begin(y);
+                    for (std::size_t c = 0; c < num_channels_; ++c)
+                    {
+                        T* row = sums_.data() + index(1, y + 1, c);
+                        T* square_row = with_squares ? squares_.data() + index(1, y + 1, c) : nullptr;
+                        T sum(0);
+                        T square_sum(0);
+                        for (std::ptrdiff_t x = 0; x < width_; ++x)
+                        {
+                            T const sample = static_cast<T>(dynamic_at_c(src_it[x], c));
+                            sum += sample;
+                            row[x] = sum;
+                            if (square_row)
+                            {
+                                square_sum += sample * sample;
+                                square_row[x] = square_sum;
+                            }
+                        }
+                    }
+                }
+            });
+
+        // Accumulation down the columns, strips of columns are independent.
+        // Columns play the role of rows for splitting the work into bands.
+        detail::for_each_row_band(policy, height_, table_stride - 1,
+            [&](std::ptrdiff_t x_begin, std::ptrdiff_t x_end) {
+                for (std::size_t c = 0; c < num_channels_; ++c)
+                {
+                    accumulate_columns(sums_, c, x_begin + 1, x_end + 1);
+                    if (with_squares)
+                        accumulate_columns(squares_, c, x_begin + 1, x_end + 1);
+                }
+            });
+    }
+
+    void accumulate_columns(
+        std::vector<T>& table, std::size_t channel, std::ptrdiff_t x_begin, std::ptrdiff_t x_end)
+    {
+        std::ptrdiff_t const n = x_end - x_begin;
+        for (std::ptrdiff_t y = 2; y <= height_; ++y)
+        {
+            T const* BOOST_RESTRICT above = table.data() + index(x_begin, y - 1, channel);
+            T* BOOST_RESTRICT row = table.data() + index(x_begin, y, channel);
+            for (std::ptrdiff_t x = 0; x < n; ++x)
+                row[x] += above[x];
+        }
+    }
+
+    std::ptrdiff_t width_{0};
+    std::ptrdiff_t height_{0};
+    std::size_t num_channels_{0};
+    std::vector<T> sums_;
+    std::vector<T> squares_;
+};
+
+}} // namespace boost::gil
+
+#endif
@@ -21,6 +21,7 @@
 #include <boost/gil/image.hpp>
 #include <boost/gil/extension/numeric/kernel.hpp>
 #include <boost/gil/extension/numeric/convolve.hpp>
+#include <boost/gil/image_processing/filter.hpp>
 #include <boost/gil/image_processing/numeric.hpp>
 
 namespace boost { namespace gil {
@@ -410,13 +411,8 @@ void threshold_adaptive
 
     if (method == threshold_adaptive_method::mean)
     {
-        std::vector<float> mean_kernel_values(kernel_size, 1.0f/kernel_size);
-        kernel_1d<float> kernel(mean_kernel_values.begin(), kernel_size, kernel_size/2);
-
-        detail::convolve_1d
-        <
-            pixel<float, typename SrcView::value_type::layout_t>
-        >(src_view, kernel, temp_view);
+        // Mean of window with zero samples outside of the image, in constant time per pixel
+        box_filter(src_view, temp_view, kernel_size, -1, true, boundary_option::extend_zero);
     }
     else if (method == threshold_adaptive_method::gaussian)
     {
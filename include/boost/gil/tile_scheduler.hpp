@@ -0,0 +1,383 @@
+//
+// Copyright 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#ifndef BOOST_GIL_TILE_SCHEDULER_HPP
+#define BOOST_GIL_TILE_SCHEDULER_HPP
+
+#include <boost/gil/execution.hpp>
+#include <boost/gil/image_view_factory.hpp>
+#include <boost/gil/point.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace boost { namespace gil {
+
+/// \defgroup TileScheduler Tile Scheduler
+/// \ingroup ImageViewAlgorithm
+/// \brief Parallel processing of image views split into rectangular tiles
+///
+/// The tile scheduler splits an image view into tiles sized to fit in cache and runs
+/// a user function object on each tile, distributing the tiles across the pool of threads
+/// shared with the parallel algorithms of \ref ExecutionPolicy.
+/// Each tile carries a halo, an outer margin clipped to the view bounds, which neighbourhood
+/// operations like convolution or morphology can read from while writing only the tile itself.
+///
+/// Tiles are initially assigned to threads in contiguous runs, to keep neighbouring tiles
+/// on the same thread. A thread which runs out of tiles steals from the back of the
+/// queue of another thread, so uneven per-tile cost does not leave threads idle.
+
+/// \ingroup TileScheduler
+/// \brief Rectangular region of image view processed as a single unit of work
+struct image_tile
+{
+    using point_t = point<std::ptrdiff_t>;
+
+    /// Sequential number of tile in row-major order of tiles
+    std::size_t index{0};
+    /// Top-left corner of the tile, in coordinates of the scheduled view
+    point_t origin;
+    /// Width and height of the tile
+    point_t dimensions;
+    /// Top-left corner of the tile extended by halo and clipped to the view
+    point_t halo_origin;
+    /// Width and height of the tile extended by halo and clipped to the view
+    point_t halo_dimensions;
+
+    /// Position of the tile origin relative to the halo origin
+    auto offset_in_halo() const -> point_t { return origin - halo_origin; }
+};
+
+/// \ingroup TileScheduler
+/// \brief View of the tile within given view
+template <typename View>
+inline auto tile_view(View const& view, image_tile const& tile) -> View
+{
+    return subimage_view(view, tile.origin, tile.dimensions);
+}
+
+/// \ingroup TileScheduler
+/// \brief View of the tile extended by its halo within given view
+template <typename View>
+inline auto tile_halo_view(View const& view, image_tile const& tile) -> View
+{
+    return subimage_view(view, tile.halo_origin, tile.halo_dimensions);
+}
+
+/// \ingroup TileScheduler
+/// \brief Per-thread bump allocator for temporary buffers used while processing a tile
+///
+/// Memory allocated from the scratch is released in bulk before the next tile is processed
+/// by the same thread, so a tile function must not keep pointers to it across invocations.
+/// The storage retained between tiles grows to the peak demand of a single tile,
+/// so in steady state processing a tile does not allocate from the heap.
+class tile_scratch
+{
+public:
+    tile_scratch() = default;
+    tile_scratch(tile_scratch const&) = delete;
+    tile_scratch& operator=(tile_scratch const&) = delete;
+    tile_scratch(tile_scratch&&) = default;
+    tile_scratch& operator=(tile_scratch&&) = default;
+
+    /// \brief Returns uninitialized storage suitably aligned for n objects of type T
+    template <typename T>
+    auto allocate(std::size_t n) -> T*
+    {
+        static_assert(std::is_trivially_destructible<T>::value,
+            "scratch storage is released without calling destructors");
+        return static_cast<T*>(allocate_bytes(n * sizeof(T), alignof(T)));
+    }
+
+    /// \brief Releases all storage allocated since the last reset
+    void reset()
+    {
+        if (blocks_.size() > 1)
+        {
+            // Coalesce into single block able to serve the peak demand without spilling
+            std::size_t const capacity = peak_;
+            blocks_.clear();
+            add_block(capacity);
+        }
+        used_ = 0;
+        total_ = 0;
+    }
+
+    /// \brief Returns number of bytes available without allocating from the heap
+    auto capacity() const -> std::size_t
+    {
+        return blocks_.empty() ? 0 : blocks_.back().size;
+    }
+
+private:
+    struct block
+    {
+        std::unique_ptr<unsigned char[]> data;
+        std::size_t size;
+    };
+
+    static constexpr std::size_t max_alignment = alignof(std::max_align_t);
+
+    auto allocate_bytes(std::size_t bytes, std::size_t alignment) -> void*
+    {
+        BOOST_ASSERT(alignment <= max_alignment);
+        std::size_t offset = (used_ + alignment - 1) & ~(alignment - 1);
+        if (blocks_.empty() || offset + bytes > blocks_.back().size)
+        {
+            add_block(std::max(bytes, 2 * capacity()));
+            offset = 0;
+        }
+        used_ = offset + bytes;
+        total_ += bytes + alignment - 1;
+        peak_ = std::max(peak_, total_);
+        return blocks_.back().data.get() + offset;
+    }
+
+    void add_block(std::size_t size)
+    {
+        // Blocks are allocated by new[] and are aligned for any fundamental type
+        size = std::max<std::size_t>(size, 4096);
+        blocks_.push_back(block{std::unique_ptr<unsigned char[]>(new unsigned char[size]), size});
+        used_ = 0;
+    }
+
+    std::vector<block> blocks_;
+    std::size_t used_{0};
+    std::size_t total_{0};
+    std::size_t peak_{0};
+};
+
+/// \ingroup TileScheduler
+/// \brief Splits image views into tiles and processes them in parallel on work-stealing threads
+///
+/// The tile function is invoked as \p f(tile, scratch), where \p tile is \p image_tile
+/// and \p scratch is \p tile_scratch owned by the calling thread. Tiles are disjoint,
+/// so the function may write to its tile of an output view without synchronization.
+class tile_scheduler
+{
+public:
+    using point_t = point<std::ptrdiff_t>;
+
+    /// \brief Default amount of pixel data per tile, sized for typical per-core L2 cache
+    static constexpr std::size_t default_tile_bytes = 128 * 1024;
+
+    /// \param tile_dimensions Width and height of tiles, zero selects size from default_tile_bytes
+    /// \param halo Number of pixels the tiles are extended by on each side
+    /// \param concurrency Maximum number of threads, zero selects hardware concurrency
+    explicit tile_scheduler(
+        point_t tile_dimensions = point_t(0, 0),
+        std::ptrdiff_t halo = 0,
+        std::size_t concurrency = 0)
+        : tile_dimensions_(tile_dimensions)
+        , halo_(halo)
+        , concurrency_(execution::par(concurrency).concurrency())
+    {
+        BOOST_ASSERT(tile_dimensions_.x >= 0 && tile_dimensions_.y >= 0);
+        BOOST_ASSERT(halo_ >= 0);
+    }
+
+    /// \param policy Execution policy which determines maximum number of threads
+    /// \param tile_dimensions Width and height of tiles, zero selects size from default_tile_bytes
+    /// \param halo Number of pixels the tiles are extended by on each side
+    template <typename Tag>
+    tile_scheduler(
+        execution::execution_policy<Tag> const& policy,
+        point_t tile_dimensions = point_t(0, 0),
+        std::ptrdiff_t halo = 0)
+        : tile_scheduler(tile_dimensions, halo, policy.concurrency())
+    {}
+
+    auto halo() const -> std::ptrdiff_t { return halo_; }
+    auto concurrency() const -> std::size_t { return concurrency_; }
+
+    /// \brief Returns tile dimensions used for views of given type
+    template <typename View>
+    auto tile_dimensions() const -> point_t
+    {
+        if (tile_dimensions_.x > 0 && tile_dimensions_.y > 0)
+            return tile_dimensions_;
+
+        // Square tile with side rounded down to multiple of 16 pixels
+        std::size_t const pixel_bytes = sizeof(typename View::value_type);
+        auto side = static_cast<std::ptrdiff_t>(
+            std::sqrt(static_cast<double>(default_tile_bytes / pixel_bytes)));
+        side = std::max<std::ptrdiff_t>(16, side & ~std::ptrdiff_t(15));
+        return point_t(side, side);
+    }
+
+    /// \brief Returns all tiles of given view in row-major order
+    template <typename View>
+    auto make_tiles(View const& view) const -> std::vector<image_tile>
+    {
+        point_t const dims = tile_dimensions<View>();
+        std::vector<image_tile> tiles;
+        if (view.width() <= 0 || view.height() <= 0)
+            return tiles;
+
+        std::ptrdiff_t const nx = (view.width() + dims.x - 1) / dims.x;
+        std::ptrdiff_t const ny = (view.height() + dims.y - 1) / dims.y;
+        tiles.reserve(static_cast<std::size_t>(nx * ny));
+        for (std::ptrdiff_t ty = 0; ty < ny; ++ty)
+        {
+            for (std::ptrdiff_t tx = 0; tx < nx; ++tx)
+            {
+                image_tile tile;
+                tile.index = tiles.size();
+                tile.origin = point_t(tx * dims.x, ty * dims.y);
+                tile.dimensions = point_t(
+                    std::min(dims.x, view.width() - tile.origin.x),
+                    std::min(dims.y, view.height() - tile.origin.y));
+                tile.halo_origin = point_t(
+                    std::max<std::ptrdiff_t>(0, tile.origin.x - halo_),
+                    std::max<std::ptrdiff_t>(0, tile.origin.y - halo_));
+                point_t const halo_end(
+                    std::min(view.width(), tile.origin.x + tile.dimensions.x + halo_),
+                    std::min(view.height(), tile.origin.y + tile.dimensions.y + halo_));
+                tile.halo_dimensions = halo_end - tile.halo_origin;
+                tiles.push_back(tile);
+            }
+        }
+        return tiles;
+    }
+
+    /// \brief Invokes f(tile, scratch) for every tile of the view
+    ///
+    /// Returns once all tiles have been processed. If the function throws, remaining
+    /// tiles are abandoned and the first exception is rethrown in the calling thread.
+    template <typename View, typename F>
+    void run(View const& view, F f) const
+    {
+        std::vector<image_tile> const tiles = make_tiles(view);
+        if (tiles.empty())
+            return;
+
+        std::size_t const workers = std::min(concurrency_, tiles.size());
+        if (workers == 1)
+        {
+            tile_scratch scratch;
+            for (auto const& tile : tiles)
+            {
+                scratch.reset();
+                f(tile, scratch);
+            }
+            return;
+        }
+
+        // Deal contiguous runs of tiles to workers to preserve locality of neighbouring tiles
+        std::vector<work_queue> queues(workers);
+        for (std::size_t w = 0; w < workers; ++w)
+        {
+            std::size_t const first = w * tiles.size() / workers;
+            std::size_t const last = (w + 1) * tiles.size() / workers;
+            for (std::size_t i = first; i < last; ++i)
+                queues[w].tiles.push_back(i);
+        }
+
+        std::atomic<bool> failed{false};
+        std::exception_ptr error;
+        std::mutex error_mutex;
+
+        auto worker = [&](std::size_t self) {
+            tile_scratch scratch;
+            std::size_t i = 0;
+            while (!failed.load(std::memory_order_relaxed) && take(queues, self, i))
+            {
+                try
+                {
+                    scratch.reset();
+                    f(tiles[i], scratch);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (!error)
+                        error = std::current_exception();
+                    failed = true;
+                }
+            }
+        };
+
+        // Workers run on the pool shared with the row band algorithms. If the pool runs
+        // fewer of them at a time, queues of workers not started yet are stolen by the others.
+        auto run_worker = [&worker](std::ptrdiff_t w) { worker(static_cast<std::size_t>(w)); };
+        detail::row_band_thread_pool::instance().run(
+            static_cast<std::ptrdiff_t>(workers), run_worker);
+
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+private:
+    struct work_queue
+    {
+        std::mutex mutex;
+        std::deque<std::size_t> tiles;
+    };
+
+    // Pops tile from front of own queue, or steals from back of another queue.
+    static bool take(std::vector<work_queue>& queues, std::size_t self, std::size_t& tile)
+    {
+        {
+            std::lock_guard<std::mutex> lock(queues[self].mutex);
+            if (!queues[self].tiles.empty())
+            {
+                tile = queues[self].tiles.front();
+                queues[self].tiles.pop_front();
+                return true;
+            }
+        }
+
+        for (std::size_t k = 1; k < queues.size(); ++k)
+        {
+            work_queue& victim = queues[(self + k) % queues.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tiles.empty())
+            {
+                tile = victim.tiles.back();
+                victim.tiles.pop_back();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    point_t tile_dimensions_;
+    std::ptrdiff_t halo_{0};
+    std::size_t concurrency_{1};
+};
+
+/// \ingroup TileScheduler
+/// \brief Invokes f(tile, scratch) for every tile of the view, processing tiles in parallel
+/// \param policy Execution policy which determines maximum number of threads
+/// \param view Image view to split into tiles
+/// \param tile_dimensions Width and height of tiles, zero selects cache-sized default
+/// \param halo Number of pixels the tiles are extended by on each side
+/// \param f Function object invoked as f(image_tile const&, tile_scratch&)
+template <typename Tag, typename View, typename F>
+void for_each_tile(
+    execution::execution_policy<Tag> const& policy,
+    View const& view,
+    point<std::ptrdiff_t> const& tile_dimensions,
+    std::ptrdiff_t halo,
+    F f)
+{
+    tile_scheduler(policy, tile_dimensions, halo).run(view, f);
+}
+
+}} // namespace boost::gil
+
+#endif
@@ -243,6 +243,40 @@ struct dec
     T operator()(T x) const { return --x; }
 };
 
+/// \brief Whether value is exactly zero
+///
+/// Integral values, like weights of fixed-point kernels, are compared directly. Other
+/// values are compared as in lanczos, which does not trip -Wfloat-equal.
+template <typename T>
+constexpr auto is_zero(T const& value)
+    -> typename std::enable_if<std::is_integral<T>::value, bool>::type
+{
+    return value == 0;
+}
+
+template <typename T>
+constexpr auto is_zero(T const& value)
+    -> typename std::enable_if<!std::is_integral<T>::value, bool>::type
+{
+    return value <= 0 && value >= 0;
+}
+
+/// \brief Calls f(offset, length) for consecutive chunks of range [0, n), followed by
+/// the remainder
+///
+/// Loops of f over chunks of constant length are vectorized even under the cheapest cost
+/// model of the compiler.
+template <typename F>
+BOOST_FORCEINLINE
+void for_each_chunk(std::ptrdiff_t n, F const& f)
+{
+    constexpr std::ptrdiff_t chunk = 64;
+    std::ptrdiff_t i = 0;
+    for (; i + chunk <= n; i += chunk)
+        f(i, chunk);
+    f(i, n - i);
+}
+
 /// \brief Returns the index corresponding to the first occurrance of a given given type in
 //         a given Boost.MP11-compatible list (or size if the type is not present)
 template <typename Types, typename T>
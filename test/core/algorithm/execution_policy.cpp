@@ -0,0 +1,211 @@
+//
+// Copyright 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil/algorithm.hpp>
+#include <boost/gil/execution.hpp>
+#include <boost/gil/image.hpp>
+#include <boost/gil/typedefs.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+
+#include "test_utility_output_stream.hpp"
+
+namespace gil = boost::gil;
+
+// Image large enough to be split into several bands of rows
+std::ptrdiff_t const width = 256;
+std::ptrdiff_t const height = 131;
+
+gil::rgb8_image_t make_gradient_image()
+{
+    gil::rgb8_image_t image(width, height);
+    auto v = gil::view(image);
+    for (std::ptrdiff_t y = 0; y < v.height(); ++y)
+        for (std::ptrdiff_t x = 0; x < v.width(); ++x)
+            v(x, y) = gil::rgb8_pixel_t(
+                static_cast<std::uint8_t>(x),
+                static_cast<std::uint8_t>(y),
+                static_cast<std::uint8_t>(x + y));
+    return image;
+}
+
+void test_execution_policy_concurrency()
+{
+    BOOST_TEST_EQ(gil::execution::seq.concurrency(), 1u);
+    BOOST_TEST_EQ(gil::execution::seq(8).concurrency(), 1u);
+    BOOST_TEST_EQ(gil::execution::par(8).concurrency(), 8u);
+    BOOST_TEST_EQ(gil::execution::par_unseq(3).concurrency(), 3u);
+    BOOST_TEST_GE(gil::execution::par.concurrency(), 1u);
+
+    BOOST_TEST(gil::execution::is_execution_policy<gil::execution::parallel_policy>::value);
+    BOOST_TEST(!gil::execution::is_execution_policy<gil::rgb8_view_t>::value);
+}
+
+void test_row_band_count()
+{
+    auto const par4 = gil::execution::par(4);
+    BOOST_TEST_EQ(gil::detail::row_band_count(par4, 0, 100), 0);
+    BOOST_TEST_EQ(gil::detail::row_band_count(par4, 10, 10), 1);
+    BOOST_TEST_EQ(gil::detail::row_band_count(par4, 4096, 3), 3);
+    BOOST_TEST_EQ(gil::detail::row_band_count(par4, width, height), 4);
+    BOOST_TEST_EQ(gil::detail::row_band_count(gil::execution::seq, width, height), 1);
+}
+
+void test_for_each_row_band_covers_all_rows()
+{
+    std::atomic<std::ptrdiff_t> rows{0};
+    gil::detail::for_each_row_band(gil::execution::par(7), width, height,
+        [&rows](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+            rows += y_end - y_begin;
+        });
+    BOOST_TEST_EQ(rows.load(), height);
+}
+
+void test_for_each_row_band_rethrows()
+{
+    BOOST_TEST_THROWS(
+        gil::detail::for_each_row_band(gil::execution::par(4), width, height,
+            [](std::ptrdiff_t y_begin, std::ptrdiff_t) {
+                if (y_begin == 0)
+                    throw std::runtime_error("band failed");
+            }),
+        std::runtime_error);
+}
+
+void test_for_each_row_band_nested()
+{
+    // Bands calling parallel algorithms themselves share the pool with the outer call
+    for (int repeat = 0; repeat < 20; ++repeat)
+    {
+        std::atomic<std::ptrdiff_t> rows{0};
+        gil::detail::for_each_row_band(gil::execution::par(4), width, height,
+            [&rows](std::ptrdiff_t y_begin, std::ptrdiff_t y_end) {
+                gil::detail::for_each_row_band(gil::execution::par(4), width, y_end - y_begin,
+                    [&rows](std::ptrdiff_t inner_begin, std::ptrdiff_t inner_end) {
+                        rows += inner_end - inner_begin;
+                    });
+            });
+        BOOST_TEST_EQ(rows.load(), height);
+    }
+}
+
+void test_copy_pixels()
+{
+    auto const src = make_gradient_image();
+    gil::rgb8_image_t dst(width, height);
+    gil::copy_pixels(gil::execution::par(4), gil::const_view(src), gil::view(dst));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(src), gil::view(dst)));
+
+    // non-1D-traversable source and destination
+    gil::rgb8_image_t dst2(width, height, gil::rgb8_pixel_t(0, 0, 0));
+    auto const src_sub = gil::subimage_view(gil::const_view(src), 1, 1, width - 2, height - 2);
+    auto const dst_sub = gil::subimage_view(gil::view(dst2), 1, 1, width - 2, height - 2);
+    gil::copy_pixels(gil::execution::par_unseq(3), src_sub, dst_sub);
+    BOOST_TEST(gil::equal_pixels(src_sub, dst_sub));
+    BOOST_TEST(gil::view(dst2)(0, 0) == gil::rgb8_pixel_t(0, 0, 0));
+}
+
+void test_copy_and_convert_pixels()
+{
+    auto const src = make_gradient_image();
+    gil::gray8_image_t expected(width, height);
+    gil::copy_and_convert_pixels(gil::const_view(src), gil::view(expected));
+
+    gil::gray8_image_t dst(width, height);
+    gil::copy_and_convert_pixels(gil::execution::par(4), gil::const_view(src), gil::view(dst));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(dst)));
+
+    gil::gray8_image_t dst2(width, height);
+    gil::copy_and_convert_pixels(
+        gil::execution::par(4), gil::const_view(src), gil::view(dst2),
+        gil::default_color_converter());
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(dst2)));
+}
+
+void test_fill_pixels()
+{
+    gil::rgb8_pixel_t const red(255, 0, 0);
+    gil::rgb8_image_t image(width, height);
+    gil::fill_pixels(gil::execution::par(5), gil::view(image), red);
+
+    gil::rgb8_image_t expected(width, height, red);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(image)));
+
+    gil::rgb8_planar_image_t planar(width, height);
+    gil::fill_pixels(gil::execution::par(5), gil::view(planar), red);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(planar)));
+}
+
+void test_for_each_pixel()
+{
+    gil::gray8_image_t image(width, height, gil::gray8_pixel_t(2));
+    std::atomic<int> sum{0};
+    gil::for_each_pixel(gil::execution::par(4), gil::view(image),
+        [&sum](gil::gray8_pixel_t const& p) { sum += gil::at_c<0>(p); });
+    BOOST_TEST_EQ(sum.load(), 2 * width * height);
+}
+
+void test_generate_pixels()
+{
+    gil::gray16_image_t image(width, height);
+    gil::generate_pixels(gil::execution::par(4), gil::view(image),
+        []() { return gil::gray16_pixel_t(7); });
+
+    gil::gray16_image_t expected(width, height, gil::gray16_pixel_t(7));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(image)));
+}
+
+void test_transform_pixels()
+{
+    auto const src = make_gradient_image();
+    auto const invert = [](gil::rgb8c_ref_t p) {
+        return gil::rgb8_pixel_t(
+            static_cast<std::uint8_t>(255 - gil::at_c<0>(p)),
+            static_cast<std::uint8_t>(255 - gil::at_c<1>(p)),
+            static_cast<std::uint8_t>(255 - gil::at_c<2>(p)));
+    };
+
+    gil::rgb8_image_t expected(width, height);
+    gil::transform_pixels(gil::const_view(src), gil::view(expected), invert);
+
+    gil::rgb8_image_t dst(width, height);
+    gil::transform_pixels(gil::execution::par(4), gil::const_view(src), gil::view(dst), invert);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(dst)));
+
+    gil::rgb8_image_t dst2(width, height);
+    gil::transform_pixels(gil::execution::par(4),
+        gil::const_view(src), gil::const_view(dst), gil::view(dst2),
+        [](gil::rgb8c_ref_t a, gil::rgb8c_ref_t b) {
+            return gil::rgb8_pixel_t(
+                static_cast<std::uint8_t>(gil::at_c<0>(a) + gil::at_c<0>(b)),
+                static_cast<std::uint8_t>(gil::at_c<1>(a) + gil::at_c<1>(b)),
+                static_cast<std::uint8_t>(gil::at_c<2>(a) + gil::at_c<2>(b)));
+        });
+    gil::rgb8_image_t white(width, height, gil::rgb8_pixel_t(255, 255, 255));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(white), gil::const_view(dst2)));
+}
+
+int main()
+{
+    test_execution_policy_concurrency();
+    test_row_band_count();
+    test_for_each_row_band_covers_all_rows();
+    test_for_each_row_band_rethrows();
+    test_for_each_row_band_nested();
+    test_copy_pixels();
+    test_copy_and_convert_pixels();
+    test_fill_pixels();
+    test_for_each_pixel();
+    test_generate_pixels();
+    test_transform_pixels();
+
+    return ::boost::report_errors();
+}
@@ -0,0 +1,161 @@
+//
+// Copyright 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil/algorithm.hpp>
+#include <boost/gil/image.hpp>
+#include <boost/gil/tile_scheduler.hpp>
+#include <boost/gil/typedefs.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+
+namespace gil = boost::gil;
+
+using point_t = gil::point<std::ptrdiff_t>;
+
+void test_make_tiles()
+{
+    gil::gray8_image_t image(100, 70);
+    gil::tile_scheduler scheduler(point_t(32, 32), 2, 1);
+    auto const tiles = scheduler.make_tiles(gil::view(image));
+    BOOST_TEST_EQ(tiles.size(), 4u * 3u);
+
+    // first tile is clipped by the view at the top-left corner only
+    BOOST_TEST(tiles[0].origin == point_t(0, 0));
+    BOOST_TEST(tiles[0].dimensions == point_t(32, 32));
+    BOOST_TEST(tiles[0].halo_origin == point_t(0, 0));
+    BOOST_TEST(tiles[0].halo_dimensions == point_t(34, 34));
+
+    // interior tile gets halo on all sides
+    BOOST_TEST(tiles[5].origin == point_t(32, 32));
+    BOOST_TEST(tiles[5].halo_origin == point_t(30, 30));
+    BOOST_TEST(tiles[5].halo_dimensions == point_t(36, 36));
+    BOOST_TEST(tiles[5].offset_in_halo() == point_t(2, 2));
+
+    // last tile covers the remainder
+    BOOST_TEST(tiles[11].origin == point_t(96, 64));
+    BOOST_TEST(tiles[11].dimensions == point_t(4, 6));
+    BOOST_TEST(tiles[11].halo_dimensions == point_t(6, 8));
+}
+
+void test_default_tile_dimensions()
+{
+    gil::tile_scheduler scheduler;
+    auto const gray = scheduler.tile_dimensions<gil::gray8_view_t>();
+    auto const rgb = scheduler.tile_dimensions<gil::rgb32f_view_t>();
+    BOOST_TEST_EQ(gray.x, gray.y);
+    BOOST_TEST_EQ(gray.x % 16, 0);
+    BOOST_TEST_LT(rgb.x, gray.x);
+    BOOST_TEST_LE(rgb.x * rgb.y * 12, static_cast<std::ptrdiff_t>(gil::tile_scheduler::default_tile_bytes));
+}
+
+void test_run_visits_every_pixel_once()
+{
+    gil::gray32s_image_t counts(301, 203, gil::gray32s_pixel_t(0));
+    auto const v = gil::view(counts);
+    std::atomic<std::size_t> visited{0};
+
+    gil::tile_scheduler scheduler(point_t(16, 24), 3, 4);
+    scheduler.run(v, [&](gil::image_tile const& tile, gil::tile_scratch&) {
+        auto const tv = gil::tile_view(v, tile);
+        gil::for_each_pixel(tv, [](gil::gray32s_pixel_t& p) { ++gil::at_c<0>(p); });
+        ++visited;
+    });
+
+    BOOST_TEST_EQ(visited.load(), scheduler.make_tiles(v).size());
+    gil::gray32s_image_t expected(301, 203, gil::gray32s_pixel_t(1));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(counts)));
+}
+
+void test_run_stencil_reads_halo()
+{
+    // horizontal 3-tap box sum computed tile by tile must match whole-view computation
+    gil::gray16_image_t src(97, 61);
+    auto const sv = gil::view(src);
+    for (std::ptrdiff_t y = 0; y < sv.height(); ++y)
+        for (std::ptrdiff_t x = 0; x < sv.width(); ++x)
+            sv(x, y) = gil::gray16_pixel_t(static_cast<std::uint16_t>(x * 7 + y * 3));
+
+    auto box3 = [](gil::gray16c_view_t const& in, std::ptrdiff_t x, std::ptrdiff_t y) {
+        int sum = 0;
+        for (std::ptrdiff_t dx = -1; dx <= 1; ++dx)
+            if (x + dx >= 0 && x + dx < in.width())
+                sum += gil::at_c<0>(in(x + dx, y));
+        return sum;
+    };
+
+    gil::gray32s_image_t dst(97, 61);
+    auto const dv = gil::view(dst);
+    gil::for_each_tile(gil::execution::par(3), gil::const_view(src), point_t(20, 20), 1,
+        [&](gil::image_tile const& tile, gil::tile_scratch& scratch) {
+            auto const halo = gil::tile_halo_view(gil::const_view(src), tile);
+            auto const offset = tile.offset_in_halo();
+            int* row = scratch.allocate<int>(static_cast<std::size_t>(tile.dimensions.x));
+            for (std::ptrdiff_t y = 0; y < tile.dimensions.y; ++y)
+            {
+                for (std::ptrdiff_t x = 0; x < tile.dimensions.x; ++x)
+                {
+                    // halo is clipped to view, so out of halo means out of view
+                    row[x] = box3(halo, x + offset.x, y + offset.y);
+                }
+                for (std::ptrdiff_t x = 0; x < tile.dimensions.x; ++x)
+                    dv(tile.origin.x + x, tile.origin.y + y) = gil::gray32s_pixel_t(row[x]);
+            }
+        });
+
+    auto const cv = gil::const_view(src);
+    bool all_equal = true;
+    for (std::ptrdiff_t y = 0; y < cv.height(); ++y)
+        for (std::ptrdiff_t x = 0; x < cv.width(); ++x)
+            all_equal = all_equal && gil::at_c<0>(dv(x, y)) == box3(cv, x, y);
+    BOOST_TEST(all_equal);
+}
+
+void test_run_rethrows()
+{
+    gil::gray8_image_t image(64, 64);
+    gil::tile_scheduler scheduler(point_t(8, 8), 0, 4);
+    BOOST_TEST_THROWS(
+        scheduler.run(gil::view(image), [](gil::image_tile const& tile, gil::tile_scratch&) {
+            if (tile.index == 13)
+                throw std::runtime_error("tile failed");
+        }),
+        std::runtime_error);
+}
+
+void test_scratch()
+{
+    gil::tile_scratch scratch;
+    BOOST_TEST_EQ(scratch.capacity(), 0u);
+
+    auto* a = scratch.allocate<std::uint8_t>(3);
+    auto* b = scratch.allocate<double>(10);
+    BOOST_TEST(a != nullptr);
+    BOOST_TEST_EQ(reinterpret_cast<std::uintptr_t>(b) % alignof(double), 0u);
+    b[9] = 1.0;
+
+    // spill into second block, reset coalesces so next round fits in one block
+    auto* c = scratch.allocate<float>(10000);
+    c[9999] = 1.0f;
+    scratch.reset();
+    BOOST_TEST_GE(scratch.capacity(), 3 + 10 * sizeof(double) + 10000 * sizeof(float));
+}
+
+int main()
+{
+    test_make_tiles();
+    test_default_tile_dimensions();
+    test_run_visits_every_pixel_once();
+    test_run_stencil_reads_halo();
+    test_run_rethrows();
+    test_scratch();
+
+    return ::boost::report_errors();
+}
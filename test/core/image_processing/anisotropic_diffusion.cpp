@@ -16,7 +16,9 @@
 
 #include <boost/core/lightweight_test.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <limits>
 #include <random>
 
@@ -267,6 +269,71 @@ void laplace_functions_test()
                          [](gil::float32_t value) { BOOST_TEST(value == 4.4375); });
 }
 
+template <typename OutputImageType, typename LaplaceStrategy, typename BrightnessFunction,
+          typename DiffusivityFunction>
+void parallel_diffusion_check(LaplaceStrategy laplace, BrightnessFunction brightness,
+                              DiffusivityFunction diffusivity, float tolerance)
+{
+    gil::test::fixture::random_value<std::uint32_t> dist(7, 0,
+                                                         std::numeric_limits<gil::uint8_t>::max());
+    gil::rgb8_image_t image(131, 77);
+    for (auto& pixel : gil::view(image))
+    {
+        for (std::size_t channel_index = 0; channel_index < 3; ++channel_index)
+            pixel[channel_index] = static_cast<gil::uint8_t>(dist());
+    }
+    auto const input = gil::color_converted_view<typename OutputImageType::value_type>(
+        gil::const_view(image));
+
+    OutputImageType expected(image.dimensions());
+    gil::anisotropic_diffusion(input, gil::view(expected), 9, laplace, brightness, diffusivity);
+
+    // Iterations per tile which divide number of iterations, and which do not
+    for (unsigned int iterations_per_tile : {1u, 4u, 20u})
+    {
+        OutputImageType actual(image.dimensions());
+        gil::anisotropic_diffusion(gil::execution::par(3), input, gil::view(actual), 9, laplace,
+                                   brightness, diffusivity, iterations_per_tile);
+        float max_difference = 0;
+        for (std::ptrdiff_t y = 0; y < image.height(); ++y)
+        {
+            for (std::ptrdiff_t x = 0; x < image.width(); ++x)
+            {
+                for (std::size_t c = 0; c < gil::num_channels<OutputImageType>::value; ++c)
+                {
+                    float const difference = std::abs(
+                        gil::view(expected)(x, y)[c] - gil::view(actual)(x, y)[c]);
+                    max_difference = (std::max)(max_difference, difference);
+                }
+            }
+        }
+        BOOST_TEST(max_difference <= tolerance);
+    }
+}
+
+void parallel_diffusion_test()
+{
+    using gil::laplace_function::stencil_5points;
+    using gil::laplace_function::stencil_9points_standard;
+    using gil::brightness_function::identity;
+    namespace conductivity = gil::conductivity;
+
+    // Vectorized conductivity differs from the scalar one by rounding only
+    float const tolerance = 1e-3f;
+    parallel_diffusion_check<gil::gray32f_image_t>(
+        stencil_5points{}, identity{}, conductivity::perona_malik_conductivity{20}, tolerance);
+    parallel_diffusion_check<gil::rgb32f_image_t>(
+        stencil_9points_standard{}, identity{}, conductivity::gaussian_conductivity{30}, tolerance);
+    parallel_diffusion_check<gil::rgb32f_image_t>(
+        stencil_5points{}, identity{}, conductivity::wide_regions_conductivity{15}, tolerance);
+    parallel_diffusion_check<gil::gray32f_image_t>(stencil_9points_standard{}, identity{},
+        conductivity::more_wide_regions_conductivity{10}, tolerance);
+
+    // Bands of rows run the same code as sequential diffusion
+    parallel_diffusion_check<gil::rgb32f_image_t>(stencil_9points_standard{},
+        gil::brightness_function::rgb_luminance{}, conductivity::gaussian_conductivity{30}, 0.0f);
+}
+
 int main()
 {
     for (std::uint32_t seed = 0; seed < 100; ++seed)
@@ -300,5 +367,7 @@ int main()
 
     laplace_functions_test();
 
+    parallel_diffusion_test();
+
     return boost::report_errors();
 }
@@ -0,0 +1,200 @@
+//
+// Copyright 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil.hpp>
+#include <boost/gil/image_processing/binary_morphology.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace gil = boost::gil;
+
+using gray1_image_t = gil::bit_aligned_image1_type<1, gil::gray_layout_t>::type;
+using kernel_t = gil::detail::kernel_2d<float>;
+
+gil::gray8_image_t make_random_mask(std::ptrdiff_t width, std::ptrdiff_t height, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    gil::gray8_image_t mask(width, height);
+    for (auto& p : gil::view(mask))
+        p = gil::gray8_pixel_t(rng() % 5 == 0 ? 255 : 0);
+    return mask;
+}
+
+std::vector<kernel_t> make_structuring_elements()
+{
+    std::vector<kernel_t> kernels;
+    std::vector<float> const one(1, 1.0f);
+    std::vector<float> const square(9, 1.0f);
+    std::vector<float> const big_square(49, 1.0f);
+    kernels.emplace_back(one.begin(), one.size(), 0, 0);
+    kernels.emplace_back(square.begin(), square.size(), 1, 1);
+    kernels.emplace_back(big_square.begin(), big_square.size(), 5, 1);
+
+    // Horizontal line longer than a word, anchored off-center, and short vertical line
+    {
+        std::vector<float> v(71 * 71, 0.0f);
+        for (std::size_t i = 0; i < 71; ++i)
+            v[30 * 71 + i] = 1.0f;
+        kernels.emplace_back(v.begin(), v.size(), 30, 60);
+    }
+    {
+        std::vector<float> v(25, 0.0f);
+        for (std::size_t i = 0; i < 5; ++i)
+            v[i * 5 + 1] = 1.0f;
+        kernels.emplace_back(v.begin(), v.size(), 2, 2);
+    }
+    // Disk and random structuring element
+    {
+        std::vector<float> v(81, 0.0f);
+        for (int i = 0; i < 9; ++i)
+            for (int j = 0; j < 9; ++j)
+                v[static_cast<std::size_t>(i * 9 + j)] = (i - 4) * (i - 4) + (j - 4) * (j - 4) <= 16;
+        kernels.emplace_back(v.begin(), v.size(), 4, 4);
+    }
+    {
+        std::mt19937 rng(9);
+        std::vector<float> v(36);
+        for (auto& e : v)
+            e = static_cast<float>(rng() % 2);
+        kernels.emplace_back(v.begin(), v.size(), 1, 5);
+    }
+    return kernels;
+}
+
+template <typename View>
+gil::gray8_image_t unpack(View const& view)
+{
+    gil::gray8_image_t result(view.dimensions());
+    gil::unpack_binary_mask(view, gil::view(result));
+    return result;
+}
+
+void test_pack_unpack()
+{
+    for (std::ptrdiff_t width : {1, 7, 63, 64, 65, 130})
+    {
+        auto const mask = make_random_mask(width, 5, static_cast<unsigned>(width));
+        gray1_image_t packed(mask.dimensions());
+        gil::pack_binary_mask(gil::const_view(mask), gil::view(packed));
+
+        bool all_match = true;
+        for (std::ptrdiff_t y = 0; y < mask.height(); ++y)
+        {
+            for (std::ptrdiff_t x = 0; x < width; ++x)
+            {
+                bool const bit = gil::at_c<0>(gil::const_view(packed)(x, y)) != 0;
+                all_match = all_match && bit == (gil::const_view(mask)(x, y) != 0);
+            }
+        }
+        BOOST_TEST(all_match);
+        BOOST_TEST(gil::equal_pixels(gil::const_view(unpack(gil::const_view(packed))),
+            gil::const_view(mask)));
+    }
+
+    // Non-zero samples of float mask and unpacking to 16-bit
+    gil::gray32f_image_t mask(3, 1);
+    gil::view(mask)(1, 0) = gil::gray32f_pixel_t(0.5f);
+    gray1_image_t packed(mask.dimensions());
+    gil::pack_binary_mask(gil::const_view(mask), gil::view(packed));
+    gil::gray16_image_t unpacked(mask.dimensions());
+    gil::unpack_binary_mask(gil::const_view(packed), gil::view(unpacked));
+    BOOST_TEST_EQ(gil::const_view(unpacked)(0, 0), gil::gray16_pixel_t(0));
+    BOOST_TEST_EQ(gil::const_view(unpacked)(1, 0), gil::gray16_pixel_t(65535));
+    BOOST_TEST_EQ(gil::const_view(unpacked)(2, 0), gil::gray16_pixel_t(0));
+}
+
+void test_subimage_keeps_surrounding_pixels()
+{
+    auto const background = make_random_mask(150, 9, 1);
+    gray1_image_t packed(background.dimensions());
+    gil::pack_binary_mask(gil::const_view(background), gil::view(packed));
+
+    // Rows of the subimage start at bit offsets other than zero
+    auto const sub = gil::subimage_view(gil::view(packed), 3, 2, 131, 5);
+    auto const mask = make_random_mask(131, 5, 2);
+    gil::pack_binary_mask(gil::const_view(mask), sub);
+
+    gil::gray8_image_t expected(background);
+    gil::copy_pixels(gil::const_view(mask), gil::subimage_view(gil::view(expected), 3, 2, 131, 5));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(unpack(gil::const_view(packed))),
+        gil::const_view(expected)));
+}
+
+void test_morphology_matches_gray8()
+{
+    for (std::ptrdiff_t width : {1, 64, 130})
+    {
+        auto const mask = make_random_mask(width, 23, 3);
+        gray1_image_t packed(mask.dimensions());
+        gil::pack_binary_mask(gil::const_view(mask), gil::view(packed));
+
+        for (auto const& kernel : make_structuring_elements())
+        {
+            gil::gray8_image_t expected(mask.dimensions());
+            gray1_image_t actual(mask.dimensions());
+
+            gil::dilate(gil::const_view(mask), gil::view(expected), kernel, 1);
+            gil::binary_dilate(gil::const_view(packed), gil::view(actual), kernel, 1);
+            BOOST_TEST(gil::equal_pixels(gil::const_view(unpack(gil::const_view(actual))),
+                gil::const_view(expected)));
+
+            gil::erode(gil::const_view(mask), gil::view(expected), kernel, 1);
+            gil::binary_erode(gil::const_view(packed), gil::view(actual), kernel, 1);
+            BOOST_TEST(gil::equal_pixels(gil::const_view(unpack(gil::const_view(actual))),
+                gil::const_view(expected)));
+
+            gil::opening(gil::const_view(mask), gil::view(expected), kernel);
+            gil::binary_opening(gil::const_view(packed), gil::view(actual), kernel);
+            BOOST_TEST(gil::equal_pixels(gil::const_view(unpack(gil::const_view(actual))),
+                gil::const_view(expected)));
+
+            gil::closing(gil::const_view(mask), gil::view(expected), kernel);
+            gil::binary_closing(gil::const_view(packed), gil::view(actual), kernel);
+            BOOST_TEST(gil::equal_pixels(gil::const_view(unpack(gil::const_view(actual))),
+                gil::const_view(expected)));
+        }
+    }
+}
+
+void test_in_place_iterations_on_subimage()
+{
+    auto const background = make_random_mask(100, 30, 4);
+    gray1_image_t packed(background.dimensions());
+    gil::pack_binary_mask(gil::const_view(background), gil::view(packed));
+    auto const sub = gil::subimage_view(gil::view(packed), 5, 3, 77, 21);
+
+    std::vector<float> const square(9, 1.0f);
+    kernel_t const kernel(square.begin(), square.size(), 1, 1);
+
+    gil::gray8_image_t expected(background);
+    auto const expected_sub = gil::subimage_view(gil::view(expected), 5, 3, 77, 21);
+    gil::erode(expected_sub, expected_sub, kernel, 2);
+    gil::binary_erode(sub, sub, kernel, 2);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(unpack(gil::const_view(packed))),
+        gil::const_view(expected)));
+
+    // No iterations copies the source
+    gray1_image_t copy(sub.dimensions());
+    gil::binary_dilate(sub, gil::view(copy), kernel, 0);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(unpack(gil::const_view(copy))),
+        gil::const_view(unpack(sub))));
+}
+
+int main()
+{
+    test_pack_unpack();
+    test_subimage_keeps_surrounding_pixels();
+    test_morphology_matches_gray8();
+    test_in_place_iterations_on_subimage();
+
+    return ::boost::report_errors();
+}
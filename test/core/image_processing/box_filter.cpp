@@ -12,7 +12,13 @@
 
 #include <boost/core/lightweight_test.hpp>
 
+#include <cstddef>
+#include <cstdint>
+
+#include "core/image/test_fixture.hpp"
+
 namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
 
 std::uint8_t img[] =
 {
@@ -57,9 +63,180 @@ void test_box_filter_with_default_parameters()
     BOOST_TEST(gil::equal_pixels(out_view, dst_view));
 }
 
+// Straightforward per-pixel sum of box window used as reference
+template <typename SrcView>
+double reference_box_sum(
+    SrcView const& src, std::ptrdiff_t x, std::ptrdiff_t y,
+    std::ptrdiff_t left, std::ptrdiff_t right, gil::boundary_option option)
+{
+    double sum = 0.0;
+    auto const loc = src.xy_at(0, 0);
+    for (std::ptrdiff_t sy = y - left; sy <= y + right; ++sy)
+    {
+        for (std::ptrdiff_t sx = x - left; sx <= x + right; ++sx)
+        {
+            std::ptrdiff_t px = sx;
+            std::ptrdiff_t py = sy;
+            bool const inside = px >= 0 && px < src.width() && py >= 0 && py < src.height();
+            if (!inside && option == gil::boundary_option::extend_zero)
+                continue;
+            if (option == gil::boundary_option::extend_constant)
+            {
+                px = std::min(std::max<std::ptrdiff_t>(px, 0), src.width() - 1);
+                py = std::min(std::max<std::ptrdiff_t>(py, 0), src.height() - 1);
+            }
+            // locator reads past the view bounds for extend_padded
+            sum += static_cast<double>(gil::at_c<0>(loc(px, py)));
+        }
+    }
+    return sum;
+}
+
+template <typename Image>
+void test_box_filter_matches_reference(
+    std::size_t kernel_size, long int anchor, bool normalize, int max_value)
+{
+    std::ptrdiff_t const width = 41;
+    std::ptrdiff_t const height = 29;
+    std::ptrdiff_t const pad = 16;
+
+    // Source is a subimage of a larger image, so that extend_padded reads real pixels
+    auto const padded = fixture::generate_image<Image>(
+        width + 2 * pad, height + 2 * pad, fixture::random_value<int>(23, 0, max_value));
+    auto const src = gil::subimage_view(gil::const_view(padded), pad, pad, width, height);
+
+    std::ptrdiff_t const k = static_cast<std::ptrdiff_t>(kernel_size);
+    std::ptrdiff_t const right = anchor == -1 ? k / 2 : anchor;
+    std::ptrdiff_t const left = k - 1 - right;
+    using channel_t = typename gil::channel_type<typename Image::view_t>::type;
+
+    for (auto option : {
+        gil::boundary_option::output_ignore,
+        gil::boundary_option::output_zero,
+        gil::boundary_option::extend_padded,
+        gil::boundary_option::extend_zero,
+        gil::boundary_option::extend_constant})
+    {
+        Image dst(width, height);
+        gil::fill_pixels(gil::view(dst), typename Image::value_type(7));
+        gil::box_filter(src, gil::view(dst), kernel_size, anchor, normalize, option);
+
+        bool all_match = true;
+        for (std::ptrdiff_t y = 0; y < height; ++y)
+        {
+            for (std::ptrdiff_t x = 0; x < width; ++x)
+            {
+                bool const interior = x >= left && x < width - right &&
+                                      y >= left && y < height - right;
+                double expected = reference_box_sum(src, x, y, left, right, option);
+                if (normalize)
+                    expected /= static_cast<double>(k * k);
+                channel_t expected_channel = static_cast<channel_t>(expected);
+                if (!interior && option == gil::boundary_option::output_ignore)
+                    expected_channel = channel_t(7);
+                else if (!interior && option == gil::boundary_option::output_zero)
+                    expected_channel = channel_t(0);
+
+                all_match = all_match && gil::at_c<0>(gil::view(dst)(x, y)) == expected_channel;
+            }
+        }
+        BOOST_TEST(all_match);
+    }
+}
+
+void test_box_filter_8bit()
+{
+    test_box_filter_matches_reference<gil::gray8_image_t>(3, -1, true, 255);
+    test_box_filter_matches_reference<gil::gray8_image_t>(7, -1, true, 255);
+    test_box_filter_matches_reference<gil::gray8_image_t>(6, 1, true, 255);
+    test_box_filter_matches_reference<gil::gray8_image_t>(31, -1, true, 255);
+    test_box_filter_matches_reference<gil::gray8_image_t>(3, -1, false, 20);
+}
+
+void test_box_filter_16bit()
+{
+    test_box_filter_matches_reference<gil::gray16_image_t>(5, -1, true, 65535);
+    test_box_filter_matches_reference<gil::gray16_image_t>(9, 8, true, 65535);
+    test_box_filter_matches_reference<gil::gray16_image_t>(4, -1, false, 1000);
+}
+
+void test_box_filter_float()
+{
+    fixture::random_value<int> random(23, 0, 100);
+    auto const src = fixture::generate_image<gil::gray32f_image_t>(
+        30, 20, [&random] { return static_cast<float>(random()); });
+    gil::gray32f_image_t dst(30, 20);
+    gil::box_filter(gil::const_view(src), gil::view(dst), 5);
+
+    bool all_match = true;
+    for (std::ptrdiff_t y = 0; y < 20; ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < 30; ++x)
+        {
+            double const expected = reference_box_sum(
+                gil::const_view(src), x, y, 2, 2, gil::boundary_option::extend_zero) / 25.0;
+            all_match = all_match &&
+                std::abs(gil::at_c<0>(gil::view(dst)(x, y)) - expected) < 1e-4;
+        }
+    }
+    BOOST_TEST(all_match);
+}
+
+void test_blur_rgb()
+{
+    gil::rgb8_image_t src(20, 10, gil::rgb8_pixel_t(10, 100, 250));
+    gil::rgb8_image_t dst(20, 10);
+    gil::blur(gil::const_view(src), gil::view(dst), 5, -1, gil::boundary_option::extend_constant);
+
+    gil::rgb8_image_t expected(20, 10, gil::rgb8_pixel_t(10, 100, 250));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(dst)));
+}
+
+template <typename Image>
+void test_box_filter_in_place(std::size_t kernel_size, long int anchor, int max_value)
+{
+    for (auto option : {
+        gil::boundary_option::output_ignore,
+        gil::boundary_option::output_zero,
+        gil::boundary_option::extend_zero,
+        gil::boundary_option::extend_constant})
+    {
+        Image image = fixture::generate_image<Image>(
+            40, 30, fixture::random_value<int>(23, 0, max_value));
+        Image expected(40, 30);
+        gil::copy_pixels(gil::const_view(image), gil::view(expected));
+        gil::box_filter(gil::const_view(image), gil::view(expected), kernel_size, anchor, true,
+            option);
+        gil::box_filter(gil::view(image), gil::view(image), kernel_size, anchor, true, option);
+        BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(image)));
+    }
+}
+
+void test_box_filter_in_place()
+{
+    test_box_filter_in_place<gil::gray8_image_t>(5, -1, 255);
+    test_box_filter_in_place<gil::gray8_image_t>(6, 0, 255);
+    test_box_filter_in_place<gil::gray8_image_t>(4, 3, 255);
+    test_box_filter_in_place<gil::gray16_image_t>(9, -1, 65535);
+    test_box_filter_in_place<gil::gray32f_image_t>(3, -1, 1000);
+
+    // blur filters every channel of interleaved view in place
+    auto image = fixture::generate_image<gil::rgb8_image_t>(
+        40, 30, fixture::random_value<std::uint8_t>{});
+    gil::rgb8_image_t expected(40, 30);
+    gil::blur(gil::const_view(image), gil::view(expected), 3);
+    gil::blur(gil::view(image), gil::view(image), 3);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(image)));
+}
+
 int main()
 {
     test_box_filter_with_default_parameters();
+    test_box_filter_8bit();
+    test_box_filter_16bit();
+    test_box_filter_float();
+    test_blur_rgb();
+    test_box_filter_in_place();
 
     return ::boost::report_errors();
 }
@@ -0,0 +1,186 @@
+//
+// Copyright 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil.hpp>
+#include <boost/gil/image_processing/filter.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "core/image/test_fixture.hpp"
+
+namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
+
+// Separable Gaussian in double precision, truncated at six sigma, with replicated border
+template <typename View>
+std::vector<double> reference_blur(View const& view, double sigma)
+{
+    auto const radius = static_cast<std::ptrdiff_t>(std::ceil(6.0 * sigma));
+    std::vector<double> weights;
+    double sum = 0.0;
+    for (std::ptrdiff_t i = -radius; i <= radius; ++i)
+    {
+        double const x = static_cast<double>(i);
+        weights.push_back(std::exp(-x * x / (2.0 * sigma * sigma)));
+        sum += weights.back();
+    }
+    for (auto& w : weights)
+        w /= sum;
+
+    std::ptrdiff_t const width = view.width();
+    std::ptrdiff_t const height = view.height();
+    auto clamp = [](std::ptrdiff_t i, std::ptrdiff_t n) {
+        return (std::min)((std::max)(i, std::ptrdiff_t(0)), n - 1);
+    };
+    std::vector<double> rows(static_cast<std::size_t>(width * height));
+    for (std::ptrdiff_t y = 0; y < height; ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < width; ++x)
+        {
+            double acc = 0.0;
+            for (std::ptrdiff_t i = -radius; i <= radius; ++i)
+            {
+                acc += weights[static_cast<std::size_t>(i + radius)] *
+                       static_cast<double>(gil::at_c<0>(view(clamp(x + i, width), y)));
+            }
+            rows[static_cast<std::size_t>(y * width + x)] = acc;
+        }
+    }
+    std::vector<double> result(rows.size());
+    for (std::ptrdiff_t y = 0; y < height; ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < width; ++x)
+        {
+            double acc = 0.0;
+            for (std::ptrdiff_t i = -radius; i <= radius; ++i)
+            {
+                acc += weights[static_cast<std::size_t>(i + radius)] *
+                       rows[static_cast<std::size_t>(clamp(y + i, height) * width + x)];
+            }
+            result[static_cast<std::size_t>(y * width + x)] = acc;
+        }
+    }
+    return result;
+}
+
+template <typename View>
+double max_difference(View const& view, std::vector<double> const& expected)
+{
+    double result = 0.0;
+    for (std::ptrdiff_t y = 0; y < view.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < view.width(); ++x)
+        {
+            double const v = static_cast<double>(gil::at_c<0>(view(x, y)));
+            result = (std::max)(
+                result, std::abs(v - expected[static_cast<std::size_t>(y * view.width() + x)]));
+        }
+    }
+    return result;
+}
+
+void test_methods_match_reference()
+{
+    auto const image = fixture::generate_image<gil::gray8_image_t>(
+        67, 45, fixture::random_value<std::uint8_t>(1, 0, 255));
+    gil::gray8_image_t result(image.dimensions());
+    for (double sigma : {0.3, 0.8, 1.5, 2.0, 3.7, 9.0})
+    {
+        auto const expected = reference_blur(gil::const_view(image), sigma);
+
+        gil::gaussian_blur(
+            gil::const_view(image), gil::view(result), sigma, gil::gaussian_blur_method::fir);
+        BOOST_TEST_LE(max_difference(gil::const_view(result), expected), 1.0);
+
+        // Recursive filter is defined down to sigma of 0.5, below it uses FIR
+        gil::gaussian_blur(
+            gil::const_view(image), gil::view(result), sigma, gil::gaussian_blur_method::recursive);
+        BOOST_TEST_LE(max_difference(gil::const_view(result), expected), 1.0);
+    }
+}
+
+void test_large_sigma_and_border()
+{
+    // Ramp must stay close to ramp, large sigma extends over the whole image
+    gil::gray8_image_t image(120, 30);
+    for (std::ptrdiff_t y = 0; y < image.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < image.width(); ++x)
+            gil::view(image)(x, y) = gil::gray8_pixel_t(static_cast<std::uint8_t>(2 * x));
+    }
+    gil::gray8_image_t result(image.dimensions());
+    for (double sigma : {5.0, 40.0})
+    {
+        auto const expected = reference_blur(gil::const_view(image), sigma);
+        gil::gaussian_blur(gil::const_view(image), gil::view(result), sigma);
+        BOOST_TEST_LE(max_difference(gil::const_view(result), expected), 2.0);
+    }
+}
+
+void test_constant_image()
+{
+    gil::gray16_image_t image(33, 19, gil::gray16_pixel_t(40000));
+    gil::gray16_image_t result(image.dimensions());
+    for (double sigma : {1.0, 4.0, 25.0})
+    {
+        gil::gaussian_blur(gil::const_view(image), gil::view(result), sigma);
+        BOOST_TEST(gil::equal_pixels(gil::const_view(image), gil::const_view(result)));
+    }
+
+    // Images thinner than the recursion order
+    gil::gray8_image_t thin(1, 2, gil::gray8_pixel_t(7));
+    gil::gray8_image_t thin_result(thin.dimensions());
+    gil::gaussian_blur(gil::const_view(thin), gil::view(thin_result), 3.0);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(thin), gil::const_view(thin_result)));
+}
+
+void test_rgb_and_float()
+{
+    auto const image = fixture::generate_image<gil::rgb8_image_t>(
+        40, 30, fixture::random_value<std::uint8_t>(2, 0, 255));
+    gil::rgb8_image_t result(image.dimensions());
+    gil::gaussian_blur(gil::const_view(image), gil::view(result), 3.0);
+    for (int c = 0; c < 3; ++c)
+    {
+        auto const channel = gil::nth_channel_view(gil::const_view(image), c);
+        auto const expected = reference_blur(channel, 3.0);
+        BOOST_TEST_LE(
+            max_difference(gil::nth_channel_view(gil::const_view(result), c), expected), 1.0);
+    }
+
+    // Float results are not rounded, blurring in place
+    auto const gray = fixture::generate_image<gil::gray8_image_t>(
+        25, 35, fixture::random_value<std::uint8_t>(5, 0, 255));
+    gil::gray32f_image_t image_float(gray.dimensions());
+    std::transform(gil::const_view(gray).begin(), gil::const_view(gray).end(),
+        gil::view(image_float).begin(), [](gil::gray8_pixel_t p) {
+            return gil::gray32f_pixel_t(static_cast<float>(p) / 8.0f);
+        });
+    auto const expected = reference_blur(gil::const_view(image_float), 2.5);
+    gil::gaussian_blur(gil::view(image_float), gil::view(image_float), 2.5);
+    BOOST_TEST_LE(max_difference(gil::const_view(image_float), expected), 0.01);
+
+    auto const expected_fir = reference_blur(gil::const_view(image_float), 1.0);
+    gil::gaussian_blur(gil::view(image_float), gil::view(image_float), 1.0);
+    BOOST_TEST_LE(max_difference(gil::const_view(image_float), expected_fir), 0.01);
+}
+
+int main()
+{
+    test_methods_match_reference();
+    test_large_sigma_and_border();
+    test_constant_image();
+    test_rgb_and_float();
+
+    return ::boost::report_errors();
+}
@@ -12,6 +12,12 @@
 
 #include <boost/core/lightweight_test.hpp>
 
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
 namespace gil = boost::gil;
 
 bool are_equal(gil::gray32f_view_t expected, gil::gray32f_view_t actual) {
@@ -66,8 +72,192 @@ void test_blank_image()
     BOOST_TEST(are_equal(gil::view(expected), gil::view(harris_response)));
 }
 
+gil::gray8_image_t make_blocks_image(std::ptrdiff_t width, std::ptrdiff_t height, unsigned seed)
+{
+    // Random rectangles of random intensities make corners of varying strength
+    std::mt19937 rng(seed);
+    gil::gray8_image_t image(width, height, gil::gray8_pixel_t(0), 0);
+    for (int i = 0; i < 40; ++i)
+    {
+        std::ptrdiff_t const x = rng() % width;
+        std::ptrdiff_t const y = rng() % height;
+        std::ptrdiff_t const w = 1 + rng() % (width - x);
+        std::ptrdiff_t const h = 1 + rng() % (height - y);
+        gil::gray8_pixel_t const value(static_cast<std::uint8_t>(rng() % 256));
+        gil::fill_pixels(gil::subimage_view(gil::view(image), x, y, w, h), value);
+    }
+    return image;
+}
+
+// Full-frame Harris detector summing in the same order as the streaming one
+gil::harris_corners_result brute_force_harris_corners(
+    gil::gray8c_view_t view, gil::harris_corners_params const& params)
+{
+    auto const window = gil::detail::make_harris_window(params);
+    std::ptrdiff_t const half = static_cast<std::ptrdiff_t>(window.size() / 2);
+    std::ptrdiff_t const border = half + 1;
+    std::ptrdiff_t const r = static_cast<std::ptrdiff_t>(params.suppression_radius);
+    std::ptrdiff_t const width = view.width();
+    std::ptrdiff_t const height = view.height();
+    auto at = [&](std::ptrdiff_t x, std::ptrdiff_t y) { return static_cast<float>(view(x, y)); };
+
+    std::vector<float> products(static_cast<std::size_t>(3 * width * height), 0.0f);
+    for (std::ptrdiff_t y = 1; y < height - 1; ++y)
+    {
+        for (std::ptrdiff_t x = 1; x < width - 1; ++x)
+        {
+            float const dx = (at(x + 1, y - 1) - at(x - 1, y - 1)) +
+                2.0f * (at(x + 1, y) - at(x - 1, y)) + (at(x + 1, y + 1) - at(x - 1, y + 1));
+            float const dy = (at(x - 1, y + 1) - at(x - 1, y - 1)) +
+                2.0f * (at(x, y + 1) - at(x, y - 1)) + (at(x + 1, y + 1) - at(x + 1, y - 1));
+            std::size_t const i = static_cast<std::size_t>(3 * (y * width + x));
+            products[i] = dx * dx;
+            products[i + 1] = dx * dy;
+            products[i + 2] = dy * dy;
+        }
+    }
+    auto sum_rows = [&](std::vector<float> const& in, std::ptrdiff_t dx, std::ptrdiff_t dy) {
+        std::vector<float> out(in.size(), 0.0f);
+        for (std::ptrdiff_t y = half * dy + 1; y < height - half * dy - 1; ++y)
+            for (std::ptrdiff_t x = half * dx + 1; x < width - half * dx - 1; ++x)
+                for (std::size_t c = 0; c < 3; ++c)
+                    for (std::size_t j = 0; j < window.size(); ++j)
+                    {
+                        std::ptrdiff_t const o = static_cast<std::ptrdiff_t>(j) - half;
+                        std::ptrdiff_t const from = (y + o * dy) * width + x + o * dx;
+                        out[static_cast<std::size_t>(3 * (y * width + x)) + c] +=
+                            window[j] * in[static_cast<std::size_t>(3 * from) + c];
+                    }
+        return out;
+    };
+    auto const tensor = sum_rows(sum_rows(products, 1, 0), 0, 1);
+    auto response = [&](std::ptrdiff_t x, std::ptrdiff_t y) {
+        std::size_t const i = static_cast<std::size_t>(3 * (y * width + x));
+        float const trace = tensor[i] + tensor[i + 2];
+        return tensor[i] * tensor[i + 2] - tensor[i + 1] * tensor[i + 1] - params.k * trace * trace;
+    };
+
+    std::vector<std::pair<float, gil::point_t>> corners;
+    for (std::ptrdiff_t y = border; y < height - border; ++y)
+    {
+        for (std::ptrdiff_t x = border; x < width - border; ++x)
+        {
+            float const score = response(x, y);
+            bool maximum = score > params.threshold;
+            for (std::ptrdiff_t ny = y - r; ny <= y + r; ++ny)
+                for (std::ptrdiff_t nx = x - r; nx <= x + r; ++nx)
+                {
+                    if (nx < border || ny < border || nx >= width - border || ny >= height - border)
+                        continue;
+                    float const n = response(nx, ny);
+                    bool const before = ny < y || (ny == y && nx < x);
+                    maximum = maximum && !(before ? n >= score : n > score);
+                }
+            if (maximum)
+                corners.emplace_back(score, gil::point_t(x, y));
+        }
+    }
+    std::sort(corners.begin(), corners.end(), [](
+        std::pair<float, gil::point_t> const& a, std::pair<float, gil::point_t> const& b) {
+        if (a.first > b.first)
+            return true;
+        if (a.first < b.first)
+            return false;
+        return a.second.y != b.second.y ? a.second.y < b.second.y : a.second.x < b.second.x;
+    });
+    if (params.max_corners != 0 && corners.size() > params.max_corners)
+        corners.resize(params.max_corners);
+
+    gil::harris_corners_result result;
+    for (auto const& corner : corners)
+    {
+        result.points.push_back(corner.second);
+        result.scores.push_back(corner.first);
+    }
+    return result;
+}
+
+bool are_equal(gil::harris_corners_result const& expected, gil::harris_corners_result const& actual)
+{
+    if (expected.points != actual.points || expected.scores.size() != actual.scores.size())
+        return false;
+    for (std::size_t i = 0; i < expected.scores.size(); ++i)
+    {
+        if (std::abs(expected.scores[i] - actual.scores[i]) > 1e-4f * std::abs(expected.scores[i]))
+            return false;
+    }
+    return true;
+}
+
+void test_harris_corners_blank_image()
+{
+    gil::gray8_image_t image(30, 20, gil::gray8_pixel_t(77), 0);
+    auto const corners = gil::harris_corners(gil::view(image));
+    BOOST_TEST(corners.points.empty());
+    BOOST_TEST(corners.scores.empty());
+
+    // Too small for any window to fit
+    gil::gray8_image_t tiny(6, 40);
+    BOOST_TEST(gil::harris_corners(gil::view(tiny)).points.empty());
+}
+
+void test_harris_corners_of_rectangle()
+{
+    gil::gray8_image_t image(40, 30, gil::gray8_pixel_t(0), 0);
+    gil::fill_pixels(gil::subimage_view(gil::view(image), 10, 8, 20, 12), gil::gray8_pixel_t(200));
+
+    gil::harris_corners_params params;
+    params.suppression_radius = 3;
+    params.max_corners = 4;
+    auto const corners = gil::harris_corners(gil::view(image), params);
+    BOOST_TEST_EQ(corners.points.size(), 4u);
+
+    // Each corner of rectangle is found within a pixel
+    for (gil::point_t const corner : {gil::point_t(10, 8), gil::point_t(29, 8),
+        gil::point_t(10, 19), gil::point_t(29, 19)})
+    {
+        bool found = false;
+        for (auto const& p : corners.points)
+            found = found || (std::abs(p.x - corner.x) <= 1 && std::abs(p.y - corner.y) <= 1);
+        BOOST_TEST(found);
+    }
+    for (std::size_t i = 1; i < corners.scores.size(); ++i)
+        BOOST_TEST(corners.scores[i - 1] >= corners.scores[i]);
+}
+
+void test_harris_corners_match_brute_force()
+{
+    auto const image = make_blocks_image(211, 157, 3);
+    auto const view = gil::const_view(image);
+
+    gil::harris_corners_params params;
+    params.window_size = 7;
+    params.window_sigma = 1.5f;
+    params.threshold = 1000.0f;
+    params.suppression_radius = 2;
+    auto const all = gil::harris_corners(view, params);
+    auto const expected = brute_force_harris_corners(view, params);
+    BOOST_TEST(!expected.points.empty());
+    BOOST_TEST(are_equal(expected, all));
+
+    // Bands of rows find the same corners as sequential pass
+    BOOST_TEST(are_equal(all, gil::harris_corners(gil::execution::par(4), view, params)));
+
+    // Strongest corners are prefix of all corners
+    params.max_corners = 10;
+    auto const strongest = gil::harris_corners(gil::execution::par(3), view, params);
+    BOOST_TEST_EQ(strongest.points.size(), 10u);
+    BOOST_TEST(std::equal(strongest.points.begin(), strongest.points.end(), all.points.begin()));
+
+    params.window_size = 4;
+    BOOST_TEST_THROWS(gil::harris_corners(view, params), std::invalid_argument);
+}
+
 int main(int argc, char* argv[])
 {
     test_blank_image();
+    test_harris_corners_blank_image();
+    test_harris_corners_of_rectangle();
+    test_harris_corners_match_brute_force();
     return boost::report_errors();
 }
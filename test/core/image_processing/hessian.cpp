@@ -12,6 +12,11 @@
 
 #include <boost/core/lightweight_test.hpp>
 
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 namespace gil = boost::gil;
 
 bool are_equal(gil::gray32f_view_t expected, gil::gray32f_view_t actual) {
@@ -65,8 +70,99 @@ void test_blank_image()
     BOOST_TEST(are_equal(gil::view(expected), gil::view(hessian_response)));
 }
 
+struct disk
+{
+    gil::point_t center;
+    std::ptrdiff_t radius;
+};
+
+std::vector<disk> const disks = {{{60, 60}, 6}, {{250, 70}, 12}, {{176, 176}, 22}};
+
+gil::gray8_image_t make_disks_image()
+{
+    gil::gray8_image_t image(320, 320, gil::gray8_pixel_t(20), 0);
+    auto const view = gil::view(image);
+    for (auto const& d : disks)
+    {
+        for (std::ptrdiff_t y = d.center.y - d.radius; y <= d.center.y + d.radius; ++y)
+        {
+            for (std::ptrdiff_t x = d.center.x - d.radius; x <= d.center.x + d.radius; ++x)
+            {
+                std::ptrdiff_t const dx = x - d.center.x;
+                std::ptrdiff_t const dy = y - d.center.y;
+                if (dx * dx + dy * dy <= d.radius * d.radius)
+                    view(x, y) = gil::gray8_pixel_t(220);
+            }
+        }
+    }
+    return image;
+}
+
+void test_hessian_blobs_blank_image()
+{
+    gil::gray8_image_t image(100, 80, gil::gray8_pixel_t(50), 0);
+    BOOST_TEST(gil::hessian_blobs(gil::const_view(image)).empty());
+
+    // Too small for any octave
+    gil::gray8_image_t tiny(20, 20);
+    BOOST_TEST(gil::hessian_blobs(gil::const_view(tiny)).empty());
+}
+
+void test_hessian_blobs_of_disks()
+{
+    auto const image = make_disks_image();
+    gil::hessian_blobs_params params;
+    params.initial_step = 1;
+    params.threshold = 100.0f;
+    params.max_blobs = disks.size();
+    auto const blobs = gil::hessian_blobs(gil::const_view(image), params);
+    BOOST_TEST_EQ(blobs.size(), disks.size());
+
+    // Each disk is found close to its center, at scale of Gaussian blob of equal radius
+    for (auto const& d : disks)
+    {
+        bool found = false;
+        for (auto const& blob : blobs)
+        {
+            double const expected_scale = static_cast<double>(d.radius) / std::sqrt(2.0);
+            found = found ||
+                (std::abs(blob.position.x - d.center.x) <= 2 &&
+                 std::abs(blob.position.y - d.center.y) <= 2 &&
+                 blob.scale > 0.6 * expected_scale && blob.scale < 1.6 * expected_scale);
+        }
+        BOOST_TEST(found);
+    }
+    for (std::size_t i = 1; i < blobs.size(); ++i)
+        BOOST_TEST(blobs[i - 1].response >= blobs[i].response);
+}
+
+void test_hessian_blobs_parallel()
+{
+    auto const image = make_disks_image();
+    gil::hessian_blobs_params params;
+    auto const expected = gil::hessian_blobs(gil::const_view(image), params);
+    auto const actual = gil::hessian_blobs(gil::execution::par(3), gil::const_view(image), params);
+    BOOST_TEST(!expected.empty());
+    BOOST_TEST_EQ(expected.size(), actual.size());
+    bool all_match = expected.size() == actual.size();
+    for (std::size_t i = 0; all_match && i < expected.size(); ++i)
+    {
+        float const tolerance = 1e-6f * (1.0f + std::abs(expected[i].response));
+        all_match = expected[i].position == actual[i].position &&
+            std::abs(expected[i].scale - actual[i].scale) < 1e-6f &&
+            std::abs(expected[i].response - actual[i].response) <= tolerance;
+    }
+    BOOST_TEST(all_match);
+
+    params.initial_step = 0;
+    BOOST_TEST_THROWS(gil::hessian_blobs(gil::const_view(image), params), std::invalid_argument);
+}
+
 int main(int argc, char* argv[])
 {
     test_blank_image();
+    test_hessian_blobs_blank_image();
+    test_hessian_blobs_of_disks();
+    test_hessian_blobs_parallel();
     return boost::report_errors();
 }
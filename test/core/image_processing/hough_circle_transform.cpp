@@ -8,14 +8,17 @@
 //
 #include <boost/core/lightweight_test.hpp>
 
+#include <boost/gil/algorithm.hpp>
 #include <boost/gil/image.hpp>
 #include <boost/gil/image_processing/hough_transform.hpp>
 #include <boost/gil/image_view.hpp>
 #include <boost/gil/typedefs.hpp>
 
 #include <cstddef>
+#include <cstdlib>
 #include <iostream>
 #include <limits>
+#include <stdexcept>
 #include <vector>
 
 namespace gil = boost::gil;
@@ -62,8 +65,99 @@ void exact_fit_test(std::ptrdiff_t radius, gil::point_t offset, Rasterizer raste
     BOOST_TEST(output_views[0](0, 0) == rasterizer.point_count(radius));
 }
 
+struct disk
+{
+    gil::point_t center;
+    std::ptrdiff_t radius;
+};
+
+// Filled disks for the gradient, with their rasterized circles as the edge map
+void draw_disks(std::vector<disk> const& disks, gil::gray8_image_t& input,
+                gil::gray8_image_t& edges)
+{
+    gil::fill_pixels(gil::view(input), gil::gray8_pixel_t(20));
+    gil::fill_pixels(gil::view(edges), gil::gray8_pixel_t(0));
+    for (auto const& d : disks)
+    {
+        for (std::ptrdiff_t y = -d.radius; y <= d.radius; ++y)
+        {
+            for (std::ptrdiff_t x = -d.radius; x <= d.radius; ++x)
+            {
+                if (x * x + y * y <= d.radius * d.radius)
+                    gil::view(input)(d.center.x + x, d.center.y + y) = 200;
+            }
+        }
+        auto const rasterizer = gil::midpoint_circle_rasterizer{};
+        std::vector<gil::point_t> circle_points(rasterizer.point_count(d.radius));
+        rasterizer(d.radius, d.center, circle_points.begin());
+        for (auto const& p : circle_points)
+            gil::view(edges)(p) = 255;
+    }
+}
+
+void gradient_circles_test()
+{
+    std::vector<disk> const disks = {{{40, 45}, 12}, {{120, 60}, 25}, {{70, 130}, 18}};
+    gil::gray8_image_t input(180, 170);
+    gil::gray8_image_t edges(input.dimensions());
+    draw_disks(disks, input, edges);
+
+    auto const radius = gil::hough_parameter<std::ptrdiff_t>{8, 1, 25};
+    gil::gray32_image_t centers(input.dimensions(), gil::gray32_pixel_t(0), 0);
+    gil::hough_circle_transform_gradient(
+        gil::const_view(edges), gil::const_view(input), radius, 0.05, gil::view(centers));
+
+    auto const circles = gil::hough_circle_peaks(
+        gil::const_view(edges), gil::const_view(centers), radius, 20, 5);
+    BOOST_TEST_EQ(circles.size(), disks.size());
+    for (auto const& d : disks)
+    {
+        bool found = false;
+        for (auto const& c : circles)
+        {
+            found = found || (std::abs(c.center.x - d.center.x) <= 1 &&
+                              std::abs(c.center.y - d.center.y) <= 1 &&
+                              std::abs(c.radius - d.radius) <= 1);
+        }
+        BOOST_TEST(found);
+    }
+    for (std::size_t i = 1; i < circles.size(); ++i)
+        BOOST_TEST(circles[i - 1].votes >= circles[i].votes);
+
+    auto const strongest = gil::hough_circle_peaks(
+        gil::const_view(edges), gil::const_view(centers), radius, 20, 5, 1);
+    BOOST_TEST_EQ(strongest.size(), 1u);
+
+    // Bands narrower than the largest radius vote into rows of several other bands
+    for (std::size_t threads : {3u, 8u})
+    {
+        gil::gray32_image_t banded(input.dimensions(), gil::gray32_pixel_t(0), 0);
+        gil::hough_circle_transform_gradient(gil::execution::par(threads),
+            gil::const_view(edges), gil::const_view(input), radius, 0.05, gil::view(banded));
+        BOOST_TEST(gil::equal_pixels(gil::const_view(banded), gil::const_view(centers)));
+    }
+
+    gil::gray32_image_t parallel(input.dimensions(), gil::gray32_pixel_t(0), 0);
+    gil::hough_circle_transform_gradient(gil::execution::par(3), gil::const_view(edges),
+        gil::const_view(input), radius, 0.05, gil::view(parallel));
+    auto const parallel_circles = gil::hough_circle_peaks(gil::execution::par(3),
+        gil::const_view(edges), gil::const_view(parallel), radius, 20, 5);
+    BOOST_TEST_EQ(parallel_circles.size(), circles.size());
+    for (std::size_t i = 0; i < circles.size() && i < parallel_circles.size(); ++i)
+    {
+        BOOST_TEST(parallel_circles[i].center == circles[i].center);
+        BOOST_TEST_EQ(parallel_circles[i].radius, circles[i].radius);
+    }
+
+    gil::gray32_image_t small(10, 10);
+    BOOST_TEST_THROWS(gil::hough_circle_transform_gradient(gil::const_view(edges),
+        gil::const_view(input), radius, 0.0, gil::view(small)), std::invalid_argument);
+}
+
 int main()
 {
+    gradient_circles_test();
+
     const int test_dim_length = 20;
     for (std::ptrdiff_t radius = 5; radius < test_dim_length; ++radius)
     {
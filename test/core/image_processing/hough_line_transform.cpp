@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <boost/core/lightweight_test.hpp>
 #include <boost/gil/detail/math.hpp>
+#include <boost/gil/algorithm.hpp>
 #include <boost/gil/image.hpp>
 #include <boost/gil/image_processing/hough_transform.hpp>
 #include <boost/gil/image_view.hpp>
@@ -18,6 +19,7 @@
 #include <cmath>
 #include <cstddef>
 #include <iostream>
+#include <random>
 #include <sstream>
 #include <vector>
 
@@ -86,8 +88,105 @@ void hough_line_test(std::ptrdiff_t height, std::ptrdiff_t intercept)
     BOOST_TEST(match_found);
 }
 
+// Votes of the original per-pixel computation
+template <typename InputView>
+gil::gray32_image_t reference_transform(const InputView& input_view,
+                                        const gil::hough_parameter<double>& theta,
+                                        const gil::hough_parameter<std::ptrdiff_t>& radius)
+{
+    gil::gray32_image_t accumulator(
+        static_cast<std::ptrdiff_t>(theta.step_count),
+        static_cast<std::ptrdiff_t>(radius.step_count), gil::gray32_pixel_t(0));
+    const std::ptrdiff_t r_upper_bound =
+        radius.start_point + radius.step_size * static_cast<std::ptrdiff_t>(radius.step_count - 1);
+    for (std::ptrdiff_t y = 0; y < input_view.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < input_view.width(); ++x)
+        {
+            if (!input_view(x, y)[0])
+            {
+                continue;
+            }
+            for (std::size_t theta_index = 0; theta_index < theta.step_count; ++theta_index)
+            {
+                double theta_current =
+                    theta.start_point + theta.step_size * static_cast<double>(theta_index);
+                std::ptrdiff_t current_r =
+                    std::llround(static_cast<double>(x) * std::cos(theta_current) +
+                                 static_cast<double>(y) * std::sin(theta_current));
+                if (current_r < radius.start_point || current_r > r_upper_bound)
+                {
+                    continue;
+                }
+                std::size_t r_index = static_cast<std::size_t>(
+                    std::llround((current_r - radius.start_point) / radius.step_size));
+                gil::view(accumulator)(static_cast<std::ptrdiff_t>(theta_index),
+                                       static_cast<std::ptrdiff_t>(r_index))[0] += 1;
+            }
+        }
+    }
+    return accumulator;
+}
+
+void hough_line_reference_test()
+{
+    std::mt19937 rng(11);
+    gil::gray8_image_t image(203, 151, gil::gray8_pixel_t(0));
+    auto input = gil::view(image);
+    for (auto& p : input)
+    {
+        p = rng() % 7 == 0 ? 255 : 0;
+    }
+
+    for (std::ptrdiff_t step : {1, 3})
+    {
+        const auto theta_param = gil::hough_parameter<double>::from_step_count(
+            gil::detail::pi / 2, gil::detail::pi / 2, 90);
+        const auto radius_param =
+            gil::hough_parameter<std::ptrdiff_t>{-260, step, static_cast<std::size_t>(520 / step)};
+        const auto expected = reference_transform(input, theta_param, radius_param);
+
+        gil::gray32_image_t sequential(expected.dimensions(), gil::gray32_pixel_t(0), 0);
+        gil::hough_line_transform(input, gil::view(sequential), theta_param, radius_param);
+        BOOST_TEST(gil::equal_pixels(gil::const_view(sequential), gil::const_view(expected)));
+
+        gil::gray32_image_t parallel(expected.dimensions(), gil::gray32_pixel_t(0), 0);
+        gil::hough_line_transform(
+            gil::execution::par(3), input, gil::view(parallel), theta_param, radius_param);
+        BOOST_TEST(gil::equal_pixels(gil::const_view(parallel), gil::const_view(expected)));
+    }
+}
+
+void hough_line_peaks_test()
+{
+    gil::gray32_image_t accumulator(40, 30, gil::gray32_pixel_t(0));
+    auto view = gil::view(accumulator);
+    view(5, 5) = 10;
+    view(6, 5) = 9;
+    view(20, 12) = 30;
+    view(22, 12) = 30;
+    view(35, 25) = 20;
+    view(2, 28) = 20;
+
+    const auto all_peaks = gil::hough_line_peaks(gil::const_view(accumulator), 10, 0);
+    BOOST_TEST_EQ(all_peaks.size(), 6u);
+
+    // Equal neighbours keep the first in row-major order, equal peaks stay in that order
+    const auto peaks = gil::hough_line_peaks(gil::const_view(accumulator), 10, 2);
+    const std::vector<gil::point_t> expected = {{20, 12}, {35, 25}, {2, 28}, {5, 5}};
+    BOOST_TEST(peaks == expected);
+
+    const auto strongest = gil::hough_line_peaks(gil::const_view(accumulator), 2, 2);
+    BOOST_TEST(strongest == std::vector<gil::point_t>(expected.begin(), expected.begin() + 2));
+
+    gil::gray32_image_t empty(4, 4, gil::gray32_pixel_t(0));
+    BOOST_TEST(gil::hough_line_peaks(gil::const_view(empty), 3, 1).empty());
+}
+
 int main()
 {
+    hough_line_reference_test();
+    hough_line_peaks_test();
     for (std::ptrdiff_t height = 1; height < width; ++height)
     {
         for (std::ptrdiff_t intercept = 1; intercept < width - height; ++intercept)
@@ -5,12 +5,24 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 //
+#include <boost/gil/algorithm.hpp>
 #include <boost/gil/image.hpp>
 #include <boost/gil/image_processing/scaling.hpp>
+#include <boost/gil/typedefs.hpp>
 
 #include <boost/core/lightweight_test.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include "core/image/test_fixture.hpp"
+
 namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
 
 bool are_equal(gil::rgb8_view_t expected, gil::rgb8_view_t actual)
 {
@@ -59,9 +71,191 @@ void test_lanczos_response_on_zero()
     BOOST_TEST_EQ(gil::lanczos(0, 2), 1);
 }
 
+std::vector<gil::resampling_filter> const filters = {
+    gil::resampling_filter::lanczos2, gil::resampling_filter::lanczos3,
+    gil::resampling_filter::bicubic, gil::resampling_filter::mitchell,
+    gil::resampling_filter::area};
+
+template <typename View>
+double max_difference(View const& lhs, View const& rhs)
+{
+    double result = 0;
+    for (std::ptrdiff_t y = 0; y < lhs.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < lhs.width(); ++x)
+        {
+            for (std::size_t c = 0; c < gil::num_channels<View>::value; ++c)
+            {
+                double const difference = std::abs(
+                    static_cast<double>(lhs(x, y)[c]) - static_cast<double>(rhs(x, y)[c]));
+                result = (std::max)(result, difference);
+            }
+        }
+    }
+    return result;
+}
+
+void test_constant_image()
+{
+    gil::rgb8_image_t image(13, 9, gil::rgb8_pixel_t(10, 128, 250), 0);
+    for (auto filter : filters)
+    {
+        for (gil::point_t size : {gil::point_t(5, 4), gil::point_t(31, 20), gil::point_t(1, 1)})
+        {
+            gil::rgb8_image_t result(size);
+            gil::scale_separable(gil::const_view(image), gil::view(result), filter);
+            gil::rgb8_image_t expected(size, gil::rgb8_pixel_t(10, 128, 250), 0);
+            BOOST_TEST(gil::equal_pixels(gil::const_view(result), gil::const_view(expected)));
+        }
+    }
+}
+
+void test_identity()
+{
+    auto const image = fixture::generate_image<gil::rgb8_image_t>(
+        17, 11, fixture::random_value<std::uint8_t>(1, 0, 255));
+    for (auto filter : {gil::resampling_filter::lanczos2, gil::resampling_filter::lanczos3,
+                        gil::resampling_filter::bicubic, gil::resampling_filter::area})
+    {
+        gil::rgb8_image_t result(image.dimensions());
+        gil::scale_separable(gil::const_view(image), gil::view(result), filter);
+        BOOST_TEST(gil::equal_pixels(gil::const_view(result), gil::const_view(image)));
+    }
+}
+
+void test_area_mean()
+{
+    fixture::random_value<int> random(2, 0, 999);
+    auto const image = fixture::generate_image<gil::gray32f_image_t>(
+        8, 6, [&random] { return static_cast<float>(random()) / 1000.0f; });
+
+    gil::gray32f_image_t result(4, 3);
+    gil::scale_separable(gil::const_view(image), gil::view(result), gil::resampling_filter::area);
+    bool all_match = true;
+    for (std::ptrdiff_t y = 0; y < 3; ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < 4; ++x)
+        {
+            auto const v = gil::const_view(image);
+            float const mean = (v(2 * x, 2 * y)[0] + v(2 * x + 1, 2 * y)[0] +
+                v(2 * x, 2 * y + 1)[0] + v(2 * x + 1, 2 * y + 1)[0]) / 4;
+            all_match = all_match && std::abs(gil::const_view(result)(x, y)[0] - mean) < 1e-6f;
+        }
+    }
+    BOOST_TEST(all_match);
+}
+
+// Horizontal Lanczos filter, with samples outside of the row replicating its ends
+void test_lanczos_against_reference()
+{
+    std::ptrdiff_t const a = 3;
+    fixture::random_value<int> random(3, 0, 999);
+    auto const image = fixture::generate_image<gil::gray32f_image_t>(
+        23, 2, [&random] { return static_cast<float>(random()) / 1000.0f; });
+
+    for (std::ptrdiff_t width : {7, 23, 50})
+    {
+        gil::gray32f_image_t result(width, 2);
+        gil::scale_separable(gil::const_view(image), gil::view(result));
+
+        double const scale = static_cast<double>(width) / 23;
+        double const stretch = (std::max)(1.0, 1.0 / scale);
+        bool all_match = true;
+        for (std::ptrdiff_t y = 0; y < 2; ++y)
+        {
+            for (std::ptrdiff_t x = 0; x < width; ++x)
+            {
+                double const center = (static_cast<double>(x) + 0.5) / scale;
+                double sum = 0;
+                double weights = 0;
+                for (std::ptrdiff_t j = -40; j < 70; ++j)
+                {
+                    double const w =
+                        gil::lanczos((static_cast<double>(j) + 0.5 - center) / stretch, a);
+                    std::ptrdiff_t const sx =
+                        (std::max)(std::ptrdiff_t(0), (std::min)(j, std::ptrdiff_t(22)));
+                    sum += w * gil::const_view(image)(sx, y)[0];
+                    weights += w;
+                }
+                all_match = all_match &&
+                    std::abs(gil::const_view(result)(x, y)[0] - sum / weights) < 1e-5;
+            }
+        }
+        BOOST_TEST(all_match);
+    }
+}
+
+void test_antialiasing()
+{
+    // Checkerboard of single pixels, downscaled to its mean instead of aliasing
+    gil::gray8_image_t image(64, 64);
+    for (std::ptrdiff_t y = 0; y < 64; ++y)
+        for (std::ptrdiff_t x = 0; x < 64; ++x)
+            gil::view(image)(x, y) = gil::gray8_pixel_t((x + y) % 2 ? 255 : 0);
+
+    for (auto filter : filters)
+    {
+        gil::gray8_image_t result(13, 13);
+        gil::scale_separable(gil::const_view(image), gil::view(result), filter);
+        bool near_mean = true;
+        for (auto const& p : gil::const_view(result))
+            near_mean = near_mean && std::abs(static_cast<int>(p[0]) - 128) <= 12;
+        BOOST_TEST(near_mean);
+    }
+}
+
+void test_fixed_point_and_parallel()
+{
+    auto const image = fixture::generate_image<gil::rgb8_image_t>(
+        71, 53, fixture::random_value<std::uint8_t>(4, 0, 255));
+    gil::rgb32f_image_t image_f(image.dimensions());
+    gil::copy_pixels(gil::color_converted_view<gil::rgb32f_pixel_t>(gil::const_view(image)),
+        gil::view(image_f));
+    for (auto& p : gil::view(image_f))
+        for (std::size_t c = 0; c < 3; ++c)
+            p[c] = p[c] * 255.0f;
+
+    for (auto filter : filters)
+    {
+        for (gil::point_t size : {gil::point_t(29, 17), gil::point_t(160, 101)})
+        {
+            gil::rgb8_image_t fixed(size);
+            gil::scale_separable(gil::const_view(image), gil::view(fixed), filter);
+
+            gil::rgb32f_image_t floating(size);
+            gil::scale_separable(gil::const_view(image_f), gil::view(floating), filter);
+            gil::rgb8_image_t rounded(size);
+            for (std::ptrdiff_t y = 0; y < size.y; ++y)
+            {
+                for (std::ptrdiff_t x = 0; x < size.x; ++x)
+                {
+                    for (std::size_t c = 0; c < 3; ++c)
+                    {
+                        float const v = gil::const_view(floating)(x, y)[c];
+                        gil::view(rounded)(x, y)[c] = static_cast<std::uint8_t>(
+                            (std::max)(0.0f, (std::min)(255.0f, std::floor(v + 0.5f))));
+                    }
+                }
+            }
+            BOOST_TEST_LE(max_difference(gil::const_view(fixed), gil::const_view(rounded)), 2.0);
+
+            gil::rgb8_image_t parallel(size);
+            gil::scale_separable(
+                gil::execution::par(3), gil::const_view(image), gil::view(parallel), filter);
+            BOOST_TEST(gil::equal_pixels(gil::const_view(parallel), gil::const_view(fixed)));
+        }
+    }
+}
+
 int main()
 {
     test_lanczos_black_image();
+    test_constant_image();
+    test_identity();
+    test_area_mean();
+    test_lanczos_against_reference();
+    test_antialiasing();
+    test_fixed_point_and_parallel();
     test_lanczos_response_on_zero();
     return boost::report_errors();
 }
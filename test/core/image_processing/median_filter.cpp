@@ -12,6 +12,13 @@
 
 #include <boost/core/lightweight_test.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
 namespace gil = boost::gil;
 
 std::uint8_t img[] =
@@ -57,9 +64,129 @@ void test_median_filter_with_kernel_size_3()
     BOOST_TEST(gil::equal_pixels(out_view, dst_view));
 }
 
+// Straightforward per-pixel median of window with replicated border, used as reference
+template <typename View>
+auto reference_median_at(View const& src, std::ptrdiff_t x, std::ptrdiff_t y, std::ptrdiff_t k)
+    -> typename gil::channel_type<View>::type
+{
+    using channel_t = typename gil::channel_type<View>::type;
+    std::vector<channel_t> values;
+    for (std::ptrdiff_t j = y - k / 2; j < y - k / 2 + k; ++j)
+    {
+        for (std::ptrdiff_t i = x - k / 2; i < x - k / 2 + k; ++i)
+        {
+            std::ptrdiff_t const cx = std::min(std::max<std::ptrdiff_t>(i, 0), src.width() - 1);
+            std::ptrdiff_t const cy = std::min(std::max<std::ptrdiff_t>(j, 0), src.height() - 1);
+            values.push_back(gil::at_c<0>(src(cx, cy)));
+        }
+    }
+    std::nth_element(values.begin(), values.begin() + values.size() / 2, values.end());
+    return values[values.size() / 2];
+}
+
+template <typename Image>
+void test_median_filter_matches_reference(
+    std::ptrdiff_t width, std::ptrdiff_t height, std::size_t kernel_size, int max_value)
+{
+    using channel_t = typename gil::channel_type<typename Image::view_t>::type;
+    std::mt19937 rng(static_cast<unsigned>(kernel_size));
+    std::uniform_int_distribution<int> dist(0, max_value);
+    Image src(width, height);
+    for (auto& p : gil::view(src))
+        gil::at_c<0>(p) = channel_t(static_cast<float>(dist(rng)));
+
+    Image dst(width, height);
+    gil::median_filter(gil::const_view(src), gil::view(dst), kernel_size);
+
+    bool all_match = true;
+    for (std::ptrdiff_t y = 0; y < height; ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < width; ++x)
+        {
+            // Samples are whole numbers, also in floating-point channels
+            double const difference = double(gil::at_c<0>(gil::view(dst)(x, y))) - double(
+                reference_median_at(gil::const_view(src), x, y, static_cast<std::ptrdiff_t>(kernel_size)));
+            all_match = all_match && std::abs(difference) < 0.5;
+        }
+    }
+    BOOST_TEST(all_match);
+}
+
+void test_median_filter_networks()
+{
+    test_median_filter_matches_reference<gil::gray8_image_t>(23, 17, 3, 255);
+    test_median_filter_matches_reference<gil::gray8_image_t>(23, 17, 5, 7);
+    test_median_filter_matches_reference<gil::gray32f_image_t>(23, 17, 5, 1000);
+    test_median_filter_matches_reference<gil::gray8_image_t>(2, 3, 5, 255);
+}
+
+void test_median_filter_8bit_histogram()
+{
+    test_median_filter_matches_reference<gil::gray8_image_t>(41, 29, 7, 255);
+    test_median_filter_matches_reference<gil::gray8_image_t>(41, 29, 15, 255);
+    test_median_filter_matches_reference<gil::gray8_image_t>(41, 29, 4, 3);
+    test_median_filter_matches_reference<gil::gray8_image_t>(5, 4, 9, 255);
+}
+
+void test_median_filter_16bit_histogram()
+{
+    test_median_filter_matches_reference<gil::gray16_image_t>(41, 29, 7, 65535);
+    test_median_filter_matches_reference<gil::gray16_image_t>(41, 29, 15, 300);
+    test_median_filter_matches_reference<gil::gray16_image_t>(6, 3, 8, 65535);
+}
+
+void test_median_filter_other_channels()
+{
+    test_median_filter_matches_reference<gil::gray32f_image_t>(31, 19, 7, 100000);
+    test_median_filter_matches_reference<gil::gray8_image_t>(31, 19, 1, 255);
+}
+
+void test_median_filter_rgb()
+{
+    gil::rgb8_image_t src(20, 10, gil::rgb8_pixel_t(10, 100, 250));
+    gil::view(src)(4, 4) = gil::rgb8_pixel_t(0, 0, 0);
+    gil::rgb8_image_t dst(20, 10);
+    gil::median_filter(gil::const_view(src), gil::view(dst), 7);
+
+    gil::rgb8_image_t expected(20, 10, gil::rgb8_pixel_t(10, 100, 250));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(dst)));
+}
+
+template <typename Image>
+void test_median_filter_in_place(std::size_t kernel_size, int max_value)
+{
+    using channel_t = typename gil::channel_type<typename Image::view_t>::type;
+    std::mt19937 rng(static_cast<unsigned>(kernel_size));
+    std::uniform_int_distribution<int> dist(0, max_value);
+    Image image(40, 40);
+    for (auto& p : gil::view(image))
+        gil::at_c<0>(p) = channel_t(static_cast<float>(dist(rng)));
+
+    Image expected(40, 40);
+    gil::median_filter(gil::const_view(image), gil::view(expected), kernel_size);
+    gil::median_filter(gil::view(image), gil::view(image), kernel_size);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(image)));
+}
+
+void test_median_filter_in_place()
+{
+    test_median_filter_in_place<gil::gray8_image_t>(3, 255);
+    test_median_filter_in_place<gil::gray8_image_t>(5, 255);
+    test_median_filter_in_place<gil::gray8_image_t>(7, 255);
+    test_median_filter_in_place<gil::gray8_image_t>(16, 255);
+    test_median_filter_in_place<gil::gray16_image_t>(9, 65535);
+    test_median_filter_in_place<gil::gray32f_image_t>(7, 1000);
+}
+
 int main()
 {
     test_median_filter_with_kernel_size_3();
+    test_median_filter_networks();
+    test_median_filter_8bit_histogram();
+    test_median_filter_16bit_histogram();
+    test_median_filter_other_channels();
+    test_median_filter_rgb();
+    test_median_filter_in_place();
 
     return ::boost::report_errors();
 }
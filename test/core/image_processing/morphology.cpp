@@ -8,9 +8,17 @@
 
 #include <boost/core/lightweight_test.hpp>
 #include <boost/gil/image_processing/morphology.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
 #include <vector>
 
+#include "core/image/test_fixture.hpp"
+
 namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
 
 // This function helps us fill pixels of a view given as 2nd argument with
 // elements of the vector given as 1st argument.
@@ -27,6 +35,173 @@ void pixel_fill(std::vector<std::vector<int>>& original_binary_vector,
     }
 }
 
+// Straightforward per-tap definition of dilation and erosion of single-channel view,
+// samples outside of the view are ignored and the pixel itself is always included
+template <typename View>
+std::vector<double> reference_morph(
+    View const& src, gil::detail::kernel_2d<float> const& kernel, bool dilation)
+{
+    auto const size = static_cast<std::ptrdiff_t>(kernel.size());
+    auto const cx = static_cast<std::ptrdiff_t>(kernel.center_x());
+    auto const cy = static_cast<std::ptrdiff_t>(kernel.center_y());
+    std::vector<double> result;
+    for (std::ptrdiff_t y = 0; y < src.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < src.width(); ++x)
+        {
+            double value = gil::at_c<0>(src(x, y));
+            for (std::ptrdiff_t fr = 0; fr < size; ++fr)
+            {
+                for (std::ptrdiff_t fc = 0; fc < size; ++fc)
+                {
+                    auto const weight =
+                        kernel.at(static_cast<std::size_t>(fr), static_cast<std::size_t>(fc));
+                    if (std::fpclassify(weight) == FP_ZERO)
+                        continue;
+                    std::ptrdiff_t const sx = x + cx - fc;
+                    std::ptrdiff_t const sy = y + cy - fr;
+                    if (sx < 0 || sx >= src.width() || sy < 0 || sy >= src.height())
+                        continue;
+                    double const sample = gil::at_c<0>(src(sx, sy));
+                    value = dilation ? std::max(value, sample) : std::min(value, sample);
+                }
+            }
+            result.push_back(value);
+        }
+    }
+    return result;
+}
+
+// Results are samples of source, so tolerance only has to be far below spacing of samples
+template <typename View>
+bool matches_reference(View const& view, std::vector<double> const& expected)
+{
+    bool all_match = true;
+    std::size_t i = 0;
+    for (std::ptrdiff_t y = 0; y < view.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < view.width(); ++x)
+        {
+            double const difference = static_cast<double>(gil::at_c<0>(view(x, y))) - expected[i++];
+            all_match = all_match && std::abs(difference) < 1e-6;
+        }
+    }
+    return all_match;
+}
+
+gil::detail::kernel_2d<float> make_kernel(
+    std::vector<float> const& elements, std::size_t center_y, std::size_t center_x)
+{
+    return gil::detail::kernel_2d<float>(elements.begin(), elements.size(), center_y, center_x);
+}
+
+std::vector<gil::detail::kernel_2d<float>> make_structuring_elements()
+{
+    std::vector<gil::detail::kernel_2d<float>> kernels;
+    // Squares, centered and off-center
+    kernels.push_back(make_kernel(std::vector<float>(1, 1.0f), 0, 0));
+    kernels.push_back(make_kernel(std::vector<float>(9, 1.0f), 1, 1));
+    kernels.push_back(make_kernel(std::vector<float>(49, 1.0f), 5, 1));
+    // Rectangle inside of the kernel, horizontal and vertical lines through the center
+    {
+        std::vector<float> v(25, 0.0f);
+        for (std::size_t i = 5; i < 20; ++i)
+            v[i] = 1.0f;
+        kernels.push_back(make_kernel(v, 2, 2));
+    }
+    {
+        std::vector<float> v(81, 0.0f);
+        for (std::size_t i = 0; i < 9; ++i)
+            v[4 * 9 + i] = 1.0f;
+        kernels.push_back(make_kernel(v, 4, 4));
+        kernels.push_back(make_kernel(v, 4, 7));
+    }
+    {
+        std::vector<float> v(121, 0.0f);
+        for (std::size_t i = 0; i < 11; ++i)
+            v[i * 11 + 3] = 1.0f;
+        kernels.push_back(make_kernel(v, 3, 3));
+    }
+    // Line which does not pass through the center
+    {
+        std::vector<float> v(49, 0.0f);
+        for (std::size_t i = 0; i < 7; ++i)
+            v[i] = 1.0f;
+        kernels.push_back(make_kernel(v, 3, 3));
+    }
+    // Disk and random structuring elements
+    {
+        std::vector<float> v(81, 0.0f);
+        for (int i = 0; i < 9; ++i)
+            for (int j = 0; j < 9; ++j)
+                v[static_cast<std::size_t>(i * 9 + j)] =
+                    (i - 4) * (i - 4) + (j - 4) * (j - 4) <= 16;
+        kernels.push_back(make_kernel(v, 4, 4));
+    }
+    std::mt19937 rng(23);
+    for (std::size_t size : {4, 6})
+    {
+        std::vector<float> v(size * size);
+        for (auto& e : v)
+            e = static_cast<float>(rng() % 2);
+        kernels.push_back(make_kernel(v, size / 3, size - 1));
+    }
+    return kernels;
+}
+
+template <typename Image>
+void test_morph_matches_reference(int max_value)
+{
+    auto const src = fixture::generate_image<Image>(
+        37, 29, fixture::random_value<int>(7, 0, max_value));
+    for (auto const& kernel : make_structuring_elements())
+    {
+        Image dilated(src.dimensions());
+        Image eroded(src.dimensions());
+        gil::dilate(gil::const_view(src), gil::view(dilated), kernel, 1);
+        gil::erode(gil::const_view(src), gil::view(eroded), kernel, 1);
+
+        // In place application, twice
+        Image twice(src);
+        gil::dilate(gil::view(twice), gil::view(twice), kernel, 2);
+
+        for (int c = 0; c < static_cast<int>(gil::num_channels<Image>::value); ++c)
+        {
+            auto const plane = gil::nth_channel_view(gil::const_view(src), c);
+            BOOST_TEST(matches_reference(gil::nth_channel_view(gil::const_view(dilated), c),
+                reference_morph(plane, kernel, true)));
+            BOOST_TEST(matches_reference(gil::nth_channel_view(gil::const_view(eroded), c),
+                reference_morph(plane, kernel, false)));
+
+            // Second iteration of reference from result of the first one
+            auto const once = gil::nth_channel_view(gil::const_view(dilated), c);
+            BOOST_TEST(matches_reference(gil::nth_channel_view(gil::const_view(twice), c),
+                reference_morph(once, kernel, true)));
+        }
+    }
+}
+
+void test_morph_float()
+{
+    gil::gray32f_image_t src(23, 17);
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    for (auto& p : gil::view(src))
+        p = gil::gray32f_pixel_t(dist(rng));
+
+    for (auto const& kernel : make_structuring_elements())
+    {
+        gil::gray32f_image_t dilated(src.dimensions());
+        gil::gray32f_image_t eroded(src.dimensions());
+        gil::dilate(gil::const_view(src), gil::view(dilated), kernel, 1);
+        gil::erode(gil::const_view(src), gil::view(eroded), kernel, 1);
+        BOOST_TEST(matches_reference(
+            gil::const_view(dilated), reference_morph(gil::const_view(src), kernel, true)));
+        BOOST_TEST(matches_reference(
+            gil::const_view(eroded), reference_morph(gil::const_view(src), kernel, false)));
+    }
+}
+
 int main()
 {
     std::vector<std::vector<int>> original_binary_vector{
@@ -132,5 +307,10 @@ int main()
     BOOST_TEST(gil::equal_pixels(gil::view(obtained_dil_iter2), gil::view(expected_dil_iter2)));
     BOOST_TEST(gil::equal_pixels(gil::view(obtained_er_iter2), gil::view(expected_er_iter2)));
 
+    test_morph_matches_reference<gil::gray8_image_t>(255);
+    test_morph_matches_reference<gil::gray16_image_t>(65535);
+    test_morph_matches_reference<gil::rgb8_image_t>(255);
+    test_morph_float();
+
     return boost::report_errors();
 }
@@ -0,0 +1,360 @@
+//
+// Copyright 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil.hpp>
+#include <boost/gil/image_processing/pyramid.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gil = boost::gil;
+
+namespace {
+
+using taps_t = std::vector<std::pair<std::ptrdiff_t, int>>;
+
+auto reflect_101(std::ptrdiff_t i, std::ptrdiff_t n) -> std::ptrdiff_t
+{
+    return gil::extend_coordinate(i, n, gil::boundary_mode::reflect_101);
+}
+
+// Source samples and weights of the binomial filter of reduction, summing to 16
+taps_t reduce_taps(std::ptrdiff_t i, std::ptrdiff_t n)
+{
+    int const weights[] = {1, 4, 6, 4, 1};
+    taps_t taps;
+    for (std::ptrdiff_t k = 0; k < 5; ++k)
+        taps.emplace_back(reflect_101(2 * i - 2 + k, n), weights[k]);
+    return taps;
+}
+
+// Source samples and weights of the binomial filter of expansion, summing to 8
+taps_t expand_taps(std::ptrdiff_t i, std::ptrdiff_t n)
+{
+    std::ptrdiff_t const k = i / 2;
+    if (i % 2 == 0)
+    {
+        return taps_t{{reflect_101(k - 1, n), 1}, {k, 6}, {reflect_101(k + 1, n), 1}};
+    }
+    return taps_t{{k, 4}, {reflect_101(k + 1, n), 4}};
+}
+
+// Source samples of 2x2 box, last one replicated, summing to 2
+taps_t box_taps(std::ptrdiff_t i, std::ptrdiff_t n)
+{
+    return taps_t{{2 * i, 1}, {(std::min)(2 * i + 1, n - 1), 1}};
+}
+
+// Filters every destination pixel directly in 2D, normalizing integral sums by shift
+template <typename SrcView, typename DstView, typename Taps>
+void filter_reference(SrcView const& src, DstView const& dst, Taps taps, int shift)
+{
+    using sample_t =
+        typename gil::base_channel_type<typename gil::channel_type<DstView>::type>::type;
+    bool const integral = std::is_integral<sample_t>::value;
+    for (std::ptrdiff_t y = 0; y < dst.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < dst.width(); ++x)
+        {
+            for (std::size_t c = 0; c < gil::num_channels<DstView>::value; ++c)
+            {
+                double sum = 0;
+                for (auto const& ty : taps(y, src.height()))
+                    for (auto const& tx : taps(x, src.width()))
+                        sum += ty.second * tx.second * double(src(tx.first, ty.first)[c]);
+                sum /= double(1 << shift);
+                dst(x, y)[c] = static_cast<sample_t>(integral ? std::floor(sum + 0.5) : sum);
+            }
+        }
+    }
+}
+
+template <typename View>
+double max_channel_difference(View const& a, View const& b)
+{
+    double max_difference = 0;
+    for (std::ptrdiff_t y = 0; y < a.height(); ++y)
+        for (std::ptrdiff_t x = 0; x < a.width(); ++x)
+            for (std::size_t c = 0; c < gil::num_channels<View>::value; ++c)
+                max_difference = (std::max)(max_difference, std::abs(
+                    double(a(x, y)[c]) - double(b(x, y)[c])));
+    return max_difference;
+}
+
+template <typename Image>
+void fill_random(Image& image)
+{
+    using sample_t =
+        typename gil::base_channel_type<typename gil::channel_type<Image>::type>::type;
+    std::mt19937 rng(23);
+    for (auto& p : gil::view(image))
+        for (std::size_t c = 0; c < gil::num_channels<Image>::value; ++c)
+            p[c] = static_cast<sample_t>(rng() % 256);
+}
+
+} // namespace
+
+void test_level_dimensions()
+{
+    gil::gray8_image_t src(13, 8);
+    gil::gaussian_pyramid<gil::gray8_pixel_t> const pyramid(gil::const_view(src), 10);
+    BOOST_TEST_EQ(pyramid.levels(), 5u);
+    BOOST_TEST(pyramid.level(0).dimensions() == gil::point_t(13, 8));
+    BOOST_TEST(pyramid.level(1).dimensions() == gil::point_t(7, 4));
+    BOOST_TEST(pyramid.level(2).dimensions() == gil::point_t(4, 2));
+    BOOST_TEST(pyramid.level(3).dimensions() == gil::point_t(2, 1));
+    BOOST_TEST(pyramid.level(4).dimensions() == gil::point_t(1, 1));
+
+    // Levels are stored one after another
+    for (std::size_t i = 1; i < pyramid.levels(); ++i)
+    {
+        auto const previous = pyramid.level(i - 1);
+        BOOST_TEST(&pyramid.level(i)(0, 0) == &previous(0, 0) + previous.size());
+    }
+
+    gil::gaussian_pyramid<gil::gray8_pixel_t> const limited(gil::const_view(src), 2);
+    BOOST_TEST_EQ(limited.levels(), 2u);
+    gil::gaussian_pyramid<gil::gray8_pixel_t> const empty(gil::const_view(src), 0);
+    BOOST_TEST_EQ(empty.levels(), 0u);
+}
+
+template <typename Image>
+void test_reduce(std::ptrdiff_t width, std::ptrdiff_t height, double tolerance)
+{
+    Image src(width, height);
+    fill_random(src);
+    Image expected((width + 1) / 2, (height + 1) / 2);
+    Image reduced(expected.dimensions());
+    filter_reference(gil::const_view(src), gil::view(expected), reduce_taps, 8);
+    gil::pyramid_reduce(gil::const_view(src), gil::view(reduced));
+    BOOST_TEST_LE(
+        max_channel_difference(gil::const_view(expected), gil::const_view(reduced)), tolerance);
+}
+
+void test_reduce()
+{
+    test_reduce<gil::gray8_image_t>(37, 29, 0);
+    test_reduce<gil::gray8_image_t>(4, 3, 0);
+    test_reduce<gil::gray8_image_t>(1, 5, 0);
+    test_reduce<gil::rgb8_image_t>(36, 30, 0);
+    test_reduce<gil::rgba16_image_t>(21, 18, 0);
+    test_reduce<gil::gray16s_image_t>(22, 17, 0);
+    test_reduce<gil::rgb32f_image_t>(23, 19, 1e-3);
+
+    gil::gray8_image_t src(10, 10), dst(6, 5);
+    BOOST_TEST_THROWS(
+        gil::pyramid_reduce(gil::const_view(src), gil::view(dst)), std::invalid_argument);
+}
+
+template <typename Image>
+void test_expand(std::ptrdiff_t width, std::ptrdiff_t height, double tolerance)
+{
+    Image src((width + 1) / 2, (height + 1) / 2);
+    fill_random(src);
+    Image expected(width, height);
+    Image expanded(width, height);
+    filter_reference(gil::const_view(src), gil::view(expected), expand_taps, 6);
+    gil::pyramid_expand(gil::const_view(src), gil::view(expanded));
+    BOOST_TEST_LE(
+        max_channel_difference(gil::const_view(expected), gil::const_view(expanded)), tolerance);
+}
+
+void test_expand()
+{
+    test_expand<gil::gray8_image_t>(37, 29, 0);
+    test_expand<gil::gray8_image_t>(38, 28, 0);
+    test_expand<gil::gray8_image_t>(2, 1, 0);
+    test_expand<gil::gray8_image_t>(1, 4, 0);
+    test_expand<gil::rgb8_image_t>(36, 31, 0);
+    test_expand<gil::rgb32f_image_t>(23, 20, 1e-3);
+
+    gil::gray8_image_t src(5, 5), dst(12, 10);
+    BOOST_TEST_THROWS(
+        gil::pyramid_expand(gil::const_view(src), gil::view(dst)), std::invalid_argument);
+}
+
+void test_constant_levels()
+{
+    gil::rgb8_image_t src(45, 33, gil::rgb8_pixel_t(10, 128, 255), 0);
+    gil::gaussian_pyramid<gil::rgb8_pixel_t> const gaussian(gil::const_view(src), 8);
+    for (std::size_t i = 0; i < gaussian.levels(); ++i)
+        for (auto const& p : gaussian.level(i))
+            BOOST_TEST(p == gil::rgb8_pixel_t(10, 128, 255));
+
+    // Details of constant image vanish, leaving its value in the last level
+    gil::laplacian_pyramid<gil::rgb32f_pixel_t> const laplacian(gil::const_view(src), 3);
+    for (auto const& p : laplacian.level(0))
+        BOOST_TEST(p == gil::rgb32f_pixel_t(0, 0, 0));
+    for (auto const& p : laplacian.level(2))
+        BOOST_TEST(p == gil::rgb32f_pixel_t(10, 128, 255));
+}
+
+void test_gaussian_levels()
+{
+    gil::rgb8_image_t src(50, 41);
+    fill_random(src);
+    gil::gaussian_pyramid<gil::rgb8_pixel_t> const pyramid(gil::const_view(src), 4);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(src), pyramid.level(0)));
+    for (std::size_t i = 1; i < pyramid.levels(); ++i)
+    {
+        gil::rgb8_image_t expected(pyramid.level(i).dimensions());
+        gil::pyramid_reduce(pyramid.level(i - 1), gil::view(expected));
+        BOOST_TEST(gil::equal_pixels(gil::const_view(expected), pyramid.level(i)));
+    }
+}
+
+void test_laplacian_reconstruction()
+{
+    gil::gray8_image_t src(53, 38);
+    fill_random(src);
+
+    // Exact for integral samples
+    gil::laplacian_pyramid<gil::gray16s_pixel_t> const pyramid(gil::const_view(src), 6);
+    BOOST_TEST_EQ(pyramid.levels(), 6u);
+    gil::gray8_image_t reconstructed(src.dimensions());
+    pyramid.reconstruct(gil::view(reconstructed));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(src), gil::const_view(reconstructed)));
+
+    // Floating-point levels rounded back to integral samples
+    gil::laplacian_pyramid<gil::gray32f_pixel_t> const floating(gil::const_view(src), 6);
+    gil::gray8_image_t rounded(src.dimensions());
+    floating.reconstruct(gil::view(rounded));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(src), gil::const_view(rounded)));
+
+    gil::gray8_image_t wrong(10, 10);
+    BOOST_TEST_THROWS(pyramid.reconstruct(gil::view(wrong)), std::invalid_argument);
+}
+
+void test_parallel()
+{
+    // Large enough to be split into bands of rows processed in parallel
+    gil::rgb8_image_t src(321, 243);
+    fill_random(src);
+
+    gil::gaussian_pyramid<gil::rgb8_pixel_t> const sequential(gil::const_view(src), 5);
+    gil::gaussian_pyramid<gil::rgb8_pixel_t> const parallel(
+        gil::execution::par(3), gil::const_view(src), 5);
+    BOOST_TEST_EQ(parallel.levels(), sequential.levels());
+    for (std::size_t i = 0; i < sequential.levels(); ++i)
+        BOOST_TEST(gil::equal_pixels(sequential.level(i), parallel.level(i)));
+
+    using laplacian_t = gil::laplacian_pyramid<gil::rgb16s_pixel_t>;
+    laplacian_t const laplacian(gil::execution::par(3), gil::const_view(src), 5);
+    laplacian_t const laplacian_sequential(gil::const_view(src), 5);
+    for (std::size_t i = 0; i < laplacian.levels(); ++i)
+    {
+        BOOST_TEST(gil::equal_pixels(laplacian.level(i), laplacian_sequential.level(i)));
+    }
+
+    gil::rgb8_image_t reconstructed(src.dimensions());
+    laplacian.reconstruct(gil::execution::par(3), gil::view(reconstructed));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(src), gil::const_view(reconstructed)));
+}
+
+template <typename Image>
+void test_downsample_2x(std::ptrdiff_t width, std::ptrdiff_t height)
+{
+    Image src(width, height);
+    fill_random(src);
+    Image expected((width + 1) / 2, (height + 1) / 2);
+    Image downsampled(expected.dimensions());
+    filter_reference(gil::const_view(src), gil::view(expected), box_taps, 2);
+    gil::downsample_2x(gil::const_view(src), gil::view(downsampled));
+    BOOST_TEST_EQ(
+        max_channel_difference(gil::const_view(expected), gil::const_view(downsampled)), 0);
+}
+
+void test_downsample_2x()
+{
+    test_downsample_2x<gil::gray8_image_t>(38, 28);
+    test_downsample_2x<gil::gray8_image_t>(37, 29);
+    test_downsample_2x<gil::gray8_image_t>(1, 1);
+    test_downsample_2x<gil::rgb8_image_t>(35, 30);
+    test_downsample_2x<gil::rgba8_image_t>(36, 31);
+    test_downsample_2x<gil::rgb8_planar_image_t>(33, 27);
+    test_downsample_2x<gil::rgb16_image_t>(21, 18);
+    test_downsample_2x<gil::rgb16_planar_image_t>(20, 19);
+    test_downsample_2x<gil::gray16s_image_t>(22, 17);
+    test_downsample_2x<gil::rgb32f_image_t>(23, 19);
+    test_downsample_2x<gil::rgb32f_planar_image_t>(24, 13);
+
+    // Halves are rounded up
+    gil::gray8_image_t src(2, 2), dst(1, 1);
+    gil::view(src)(1, 1) = gil::gray8_pixel_t(2);
+    gil::downsample_2x(gil::const_view(src), gil::view(dst));
+    BOOST_TEST(gil::const_view(dst)(0, 0) == gil::gray8_pixel_t(1));
+
+    gil::gray8_image_t wrong(2, 1);
+    BOOST_TEST_THROWS(
+        gil::downsample_2x(gil::const_view(src), gil::view(wrong)), std::invalid_argument);
+}
+
+template <typename Image>
+void test_mip_chain(std::ptrdiff_t width, std::ptrdiff_t height)
+{
+    using pixel_t = typename Image::value_type;
+    Image src(width, height);
+    fill_random(src);
+
+    auto const chain = gil::build_mip_chain(gil::const_view(src));
+    BOOST_TEST(chain.level(chain.levels() - 1).dimensions() == gil::point_t(1, 1));
+    BOOST_TEST_EQ(max_channel_difference(
+        gil::const_view(gil::image<pixel_t, false>(chain.level(0))),
+        gil::const_view(gil::image<pixel_t, false>(gil::const_view(src)))), 0);
+    for (std::size_t i = 1; i < chain.levels(); ++i)
+    {
+        gil::image<pixel_t, false> expected(chain.level(i).dimensions());
+        gil::downsample_2x(chain.level(i - 1), gil::view(expected));
+        BOOST_TEST(gil::equal_pixels(gil::const_view(expected), chain.level(i)));
+    }
+
+    // Large enough to be split into bands of rows built in parallel
+    gil::mip_chain<pixel_t> const limited(gil::execution::par(3), gil::const_view(src), 3);
+    BOOST_TEST_EQ(limited.levels(), (std::min)(chain.levels(), std::size_t(3)));
+    for (std::size_t i = 0; i < limited.levels(); ++i)
+        BOOST_TEST(gil::equal_pixels(chain.level(i), limited.level(i)));
+
+    // Levels down to 1x1, the smallest of them built after the bands
+    auto const parallel = gil::build_mip_chain(gil::execution::par(3), gil::const_view(src));
+    BOOST_TEST_EQ(parallel.levels(), chain.levels());
+    for (std::size_t i = 0; i < parallel.levels(); ++i)
+        BOOST_TEST(gil::equal_pixels(chain.level(i), parallel.level(i)));
+}
+
+void test_mip_chain()
+{
+    test_mip_chain<gil::gray8_image_t>(1, 1);
+    test_mip_chain<gil::gray8_image_t>(7, 1);
+    test_mip_chain<gil::rgb8_image_t>(321, 243);
+    test_mip_chain<gil::rgb8_planar_image_t>(300, 257);
+    test_mip_chain<gil::rgb32f_image_t>(203, 181);
+    test_mip_chain<gil::gray8_image_t>(1203, 917);
+}
+
+int main()
+{
+    test_level_dimensions();
+    test_reduce();
+    test_expand();
+    test_constant_levels();
+    test_gaussian_levels();
+    test_laplacian_reconstruction();
+    test_parallel();
+    test_downsample_2x();
+    test_mip_chain();
+
+    return ::boost::report_errors();
+}
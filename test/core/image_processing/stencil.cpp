@@ -0,0 +1,202 @@
+//
+// Copyright 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil.hpp>
+#include <boost/gil/image_processing/stencil.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "core/image/test_fixture.hpp"
+
+namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
+
+// Asymmetric stencil with distinct weight of every neighbour
+std::vector<gil::point_t> const stencil = {{-2, -1}, {0, -1}, {0, 0}, {1, 0}, {-1, 2}, {3, 1}};
+
+struct weighted_sum
+{
+    template <typename Neighbourhood>
+    auto operator()(Neighbourhood const& n) const -> gil::gray32s_pixel_t
+    {
+        std::int32_t sum = 0;
+        for (std::size_t i = 0; i < n.size(); ++i)
+            sum += static_cast<std::int32_t>(i + 1) * gil::at_c<0>(n[i]);
+        return gil::gray32s_pixel_t(sum);
+    }
+};
+
+template <typename View>
+auto reference(View const& view, gil::boundary_mode mode, std::uint8_t constant)
+    -> gil::gray32s_image_t
+{
+    gil::gray32s_image_t result(view.dimensions());
+    for (std::ptrdiff_t y = 0; y < view.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < view.width(); ++x)
+        {
+            std::int32_t sum = 0;
+            for (std::size_t i = 0; i < stencil.size(); ++i)
+            {
+                std::ptrdiff_t const sx =
+                    gil::extend_coordinate(x + stencil[i].x, view.width(), mode);
+                std::ptrdiff_t const sy =
+                    gil::extend_coordinate(y + stencil[i].y, view.height(), mode);
+                std::int32_t const sample = sx < 0 || sy < 0 ? constant : view(sx, sy)[0];
+                sum += static_cast<std::int32_t>(i + 1) * sample;
+            }
+            gil::view(result)(x, y) = gil::gray32s_pixel_t(sum);
+        }
+    }
+    return result;
+}
+
+void test_boundary_modes()
+{
+    for (std::ptrdiff_t width : {1, 3, 40})
+    {
+        auto const image = fixture::generate_image<gil::gray8_image_t>(
+            width, 23, fixture::random_value<std::uint8_t>(
+                static_cast<std::uint32_t>(width), 0, 255));
+        auto const src = gil::const_view(image);
+        for (auto mode : {gil::boundary_mode::constant, gil::boundary_mode::replicate,
+            gil::boundary_mode::reflect, gil::boundary_mode::reflect_101,
+            gil::boundary_mode::wrap})
+        {
+            gil::gray32s_image_t result(src.dimensions());
+            gil::apply_stencil(src, gil::view(result), stencil, weighted_sum{}, mode,
+                gil::gray8_pixel_t(9));
+            auto const expected = reference(src, mode, 9);
+            BOOST_TEST(gil::equal_pixels(gil::const_view(result), gil::const_view(expected)));
+        }
+    }
+}
+
+void test_boundary_options()
+{
+    auto const image = fixture::generate_image<gil::gray8_image_t>(
+        31, 17, fixture::random_value<std::uint8_t>(1, 0, 255));
+    auto const src = gil::const_view(image);
+
+    gil::gray32s_image_t result(src.dimensions());
+    gil::apply_stencil(src, gil::view(result), stencil, weighted_sum{});
+    auto const replicated = reference(src, gil::boundary_mode::replicate, 0);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(result), gil::const_view(replicated)));
+
+    gil::apply_stencil(src, gil::view(result), stencil, weighted_sum{},
+        gil::boundary_option::extend_zero);
+    auto const zero = reference(src, gil::boundary_mode::constant, 0);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(result), gil::const_view(zero)));
+
+    // Only pixels which neighbours are all inside the view, x in [2, 28), y in [1, 15)
+    gil::gray32s_image_t ignored(src.dimensions(), gil::gray32s_pixel_t(-1), 0);
+    gil::gray32s_image_t zeroed(src.dimensions(), gil::gray32s_pixel_t(-1), 0);
+    gil::apply_stencil(src, gil::view(ignored), stencil, weighted_sum{},
+        gil::boundary_option::output_ignore);
+    gil::apply_stencil(src, gil::view(zeroed), stencil, weighted_sum{},
+        gil::boundary_option::output_zero);
+    bool all_match = true;
+    for (std::ptrdiff_t y = 0; y < src.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < src.width(); ++x)
+        {
+            bool const inside = x >= 2 && x < 28 && y >= 1 && y < 15;
+            auto const computed = gil::const_view(zero)(x, y);
+            all_match = all_match &&
+                gil::const_view(ignored)(x, y) == (inside ? computed : gil::gray32s_pixel_t(-1)) &&
+                gil::const_view(zeroed)(x, y) == (inside ? computed : gil::gray32s_pixel_t(0));
+        }
+    }
+    BOOST_TEST(all_match);
+}
+
+void test_padded_subimage_and_parallel()
+{
+    auto const image = fixture::generate_image<gil::gray8_image_t>(
+        130, 90, fixture::random_value<std::uint8_t>(2, 0, 255));
+    auto const src = gil::subimage_view(gil::const_view(image), 4, 3, 120, 80);
+
+    // Neighbours outside the subimage are read from the surrounding image
+    gil::gray32s_image_t padded(src.dimensions());
+    gil::apply_stencil(src, gil::view(padded), stencil, weighted_sum{},
+        gil::boundary_option::extend_padded);
+    auto const full = reference(gil::const_view(image), gil::boundary_mode::replicate, 0);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(padded),
+        gil::subimage_view(gil::const_view(full), 4, 3, 120, 80)));
+
+    gil::gray32s_image_t sequential(src.dimensions());
+    gil::gray32s_image_t parallel(src.dimensions());
+    gil::apply_stencil(src, gil::view(sequential), stencil, weighted_sum{},
+        gil::boundary_mode::reflect_101, gil::gray8_pixel_t(0));
+    gil::apply_stencil(gil::execution::par(3), src, gil::view(parallel), stencil, weighted_sum{},
+        gil::boundary_mode::reflect_101, gil::gray8_pixel_t(0));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(parallel), gil::const_view(sequential)));
+}
+
+// Weighted sums of the first view, minus of the second, plus twice of the third
+struct weighted_sums_of_three
+{
+    template <typename Window0, typename Window1, typename Window2>
+    auto operator()(Window0 const& n0, Window1 const& n1, Window2 const& n2) const
+        -> gil::gray32s_pixel_t
+    {
+        auto const sum = weighted_sum{};
+        return gil::gray32s_pixel_t(
+            gil::at_c<0>(sum(n0)) - gil::at_c<0>(sum(n1)) + 2 * gil::at_c<0>(sum(n2)));
+    }
+};
+
+void test_three_sources()
+{
+    auto const image0 = fixture::generate_image<gil::gray8_image_t>(
+        31, 17, fixture::random_value<std::uint8_t>(3, 0, 255));
+    auto const image1 = fixture::generate_image<gil::gray8_image_t>(
+        31, 17, fixture::random_value<std::uint8_t>(4, 0, 255));
+    auto const image2 = fixture::generate_image<gil::gray8_image_t>(
+        31, 17, fixture::random_value<std::uint8_t>(5, 0, 255));
+    auto const expected0 = reference(gil::const_view(image0), gil::boundary_mode::constant, 0);
+    auto const expected1 = reference(gil::const_view(image1), gil::boundary_mode::constant, 0);
+    auto const expected2 = reference(gil::const_view(image2), gil::boundary_mode::constant, 0);
+
+    for (std::size_t threads : {std::size_t(1), std::size_t(3)})
+    {
+        gil::gray32s_image_t result(image0.dimensions(), gil::gray32s_pixel_t(-1), 0);
+        gil::apply_stencil(gil::execution::par(threads), gil::const_view(image0),
+            gil::const_view(image1), gil::const_view(image2), gil::view(result), stencil,
+            weighted_sums_of_three{});
+
+        // Only pixels which neighbours are all inside the views, x in [2, 28), y in [1, 15)
+        bool all_match = true;
+        for (std::ptrdiff_t y = 0; y < result.height(); ++y)
+        {
+            for (std::ptrdiff_t x = 0; x < result.width(); ++x)
+            {
+                bool const inside = x >= 2 && x < 28 && y >= 1 && y < 15;
+                std::int32_t const sum = gil::const_view(expected0)(x, y)[0]
+                    - gil::const_view(expected1)(x, y)[0]
+                    + 2 * gil::const_view(expected2)(x, y)[0];
+                all_match = all_match &&
+                    gil::const_view(result)(x, y)[0] == (inside ? sum : -1);
+            }
+        }
+        BOOST_TEST(all_match);
+    }
+}
+
+int main()
+{
+    test_boundary_modes();
+    test_boundary_options();
+    test_padded_subimage_and_parallel();
+    test_three_sources();
+
+    return ::boost::report_errors();
+}
@@ -0,0 +1,126 @@
+//
+// Copyright 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil.hpp>
+#include <boost/gil/image_processing/summed_area_table.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+#include "core/image/test_fixture.hpp"
+
+namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
+
+std::ptrdiff_t const width = 97;
+std::ptrdiff_t const height = 131;
+
+template <typename View>
+std::uint64_t brute_force_sum(
+    View const& view, std::ptrdiff_t x, std::ptrdiff_t y, std::ptrdiff_t w, std::ptrdiff_t h,
+    std::size_t channel, bool squared)
+{
+    std::uint64_t sum = 0;
+    for (std::ptrdiff_t j = y; j < y + h; ++j)
+    {
+        for (std::ptrdiff_t i = x; i < x + w; ++i)
+        {
+            std::uint64_t const v = view(i, j)[channel];
+            sum += squared ? v * v : v;
+        }
+    }
+    return sum;
+}
+
+template <typename Table, typename View>
+void check_random_rectangles(Table const& table, View const& view)
+{
+    std::mt19937 rng(5);
+    bool all_match = true;
+    for (int n = 0; n < 200; ++n)
+    {
+        std::ptrdiff_t const x = std::uniform_int_distribution<std::ptrdiff_t>(0, width)(rng);
+        std::ptrdiff_t const y = std::uniform_int_distribution<std::ptrdiff_t>(0, height)(rng);
+        std::ptrdiff_t const w = std::uniform_int_distribution<std::ptrdiff_t>(0, width - x)(rng);
+        std::ptrdiff_t const h = std::uniform_int_distribution<std::ptrdiff_t>(0, height - y)(rng);
+        for (std::size_t c = 0; c < table.num_channels(); ++c)
+        {
+            all_match = all_match &&
+                static_cast<std::uint64_t>(table.rect_sum(x, y, w, h, c)) ==
+                    brute_force_sum(view, x, y, w, h, c, false);
+            if (table.has_squares())
+            {
+                all_match = all_match &&
+                    static_cast<std::uint64_t>(table.rect_square_sum(x, y, w, h, c)) ==
+                        brute_force_sum(view, x, y, w, h, c, true);
+            }
+        }
+    }
+    BOOST_TEST(all_match);
+}
+
+void test_gray()
+{
+    auto const image = fixture::generate_image<gil::rgb8_image_t>(
+        width, height, fixture::random_value<std::uint8_t>(17, 0, 255));
+    auto const gray = gil::nth_channel_view(gil::const_view(image), 1);
+
+    gil::summed_area_table<> const table(gray);
+    BOOST_TEST_EQ(table.width(), width);
+    BOOST_TEST_EQ(table.height(), height);
+    BOOST_TEST_EQ(table.num_channels(), 1u);
+    BOOST_TEST(!table.has_squares());
+    BOOST_TEST_EQ(table.at(0, 0), 0.0);
+    BOOST_TEST_EQ(table.at(1, 1), static_cast<double>(gray(0, 0)));
+    BOOST_TEST_EQ(table.rect_sum(3, 4, 0, 10), 0.0);
+    check_random_rectangles(table, gray);
+}
+
+void test_rgb_with_squares()
+{
+    auto const image = fixture::generate_image<gil::rgb8_image_t>(
+        width, height, fixture::random_value<std::uint8_t>(17, 0, 255));
+    gil::summed_area_table<std::uint64_t> const table(gil::const_view(image), true);
+    BOOST_TEST_EQ(table.num_channels(), 3u);
+    BOOST_TEST(table.has_squares());
+    check_random_rectangles(table, gil::const_view(image));
+
+    gil::summed_area_table<std::int64_t> const signed_table(gil::const_view(image), true);
+    check_random_rectangles(signed_table, gil::const_view(image));
+}
+
+void test_parallel_build()
+{
+    auto const image = fixture::generate_image<gil::rgb8_image_t>(
+        width, height, fixture::random_value<std::uint8_t>(17, 0, 255));
+    gil::rgb8_planar_image_t planar(image.dimensions());
+    gil::copy_pixels(gil::const_view(image), gil::view(planar));
+
+    gil::summed_area_table<> const table(gil::execution::par(4), gil::const_view(planar), true);
+    check_random_rectangles(table, gil::const_view(image));
+}
+
+void test_empty_view()
+{
+    gil::gray8_image_t image;
+    gil::summed_area_table<> const table(gil::const_view(image));
+    BOOST_TEST_EQ(table.width(), 0);
+    BOOST_TEST_EQ(table.rect_sum(0, 0, 0, 0), 0.0);
+}
+
+int main()
+{
+    test_gray();
+    test_rgb_with_squares();
+    test_parallel_build();
+    test_empty_view();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,95 @@
+//
+// Copyright 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil/algorithm.hpp>
+#include <boost/gil/gray.hpp>
+#include <boost/gil/image_view.hpp>
+#include <boost/gil/image_view_factory.hpp>
+#include <boost/gil/rgb.hpp>
+#include <boost/gil/image_processing/threshold.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "core/image/test_fixture.hpp"
+
+namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
+
+std::ptrdiff_t const width = 97;
+std::ptrdiff_t const height = 131;
+
+template <typename View>
+void check_threshold_adaptive_mean(View const& src, std::size_t kernel_size)
+{
+    gil::image<typename View::value_type> result(src.dimensions());
+    std::uint8_t const constant = 3;
+    gil::threshold_adaptive(
+        src, gil::view(result), 255, kernel_size, gil::threshold_adaptive_method::mean,
+        gil::threshold_direction::regular, constant);
+
+    // Mean of window with zero samples outside of the image
+    bool all_match = true;
+    std::ptrdiff_t const half = static_cast<std::ptrdiff_t>(kernel_size / 2);
+    for (std::ptrdiff_t y = 0; y < src.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < src.width(); ++x)
+        {
+            std::ptrdiff_t const x0 = std::max<std::ptrdiff_t>(x - half, 0);
+            std::ptrdiff_t const y0 = std::max<std::ptrdiff_t>(y - half, 0);
+            std::ptrdiff_t const x1 = std::min<std::ptrdiff_t>(x + half + 1, src.width());
+            std::ptrdiff_t const y1 = std::min<std::ptrdiff_t>(y + half + 1, src.height());
+            for (std::size_t c = 0; c < gil::num_channels<View>::value; ++c)
+            {
+                std::uint64_t sum = 0;
+                for (std::ptrdiff_t j = y0; j < y1; ++j)
+                    for (std::ptrdiff_t i = x0; i < x1; ++i)
+                        sum += src(i, j)[c];
+                auto const mean = static_cast<std::uint8_t>(sum / (kernel_size * kernel_size));
+                std::uint8_t const expected = src(x, y)[c] > mean - constant ? 255 : 0;
+                all_match = all_match && gil::view(result)(x, y)[c] == expected;
+            }
+        }
+    }
+    BOOST_TEST(all_match);
+}
+
+void test_threshold_adaptive_mean()
+{
+    auto const image = fixture::generate_image<gil::rgb8_image_t>(
+        width, height, fixture::random_value<std::uint8_t>(17, 0, 255));
+    gil::gray8_image_t gray_image(width, height);
+    gil::copy_pixels(gil::nth_channel_view(gil::const_view(image), 0), gil::view(gray_image));
+
+    // Window larger than the image is clipped on both sides of every pixel
+    for (std::size_t kernel_size : {1u, 7u, 301u})
+    {
+        check_threshold_adaptive_mean(gil::const_view(gray_image), kernel_size);
+        check_threshold_adaptive_mean(gil::const_view(image), kernel_size);
+    }
+}
+
+void test_threshold_adaptive_mean_in_place()
+{
+    auto image = fixture::generate_image<gil::gray8_image_t>(
+        40, 30, fixture::random_value<std::uint8_t>(5, 0, 255));
+    gil::gray8_image_t expected(image.dimensions());
+    gil::threshold_adaptive(gil::const_view(image), gil::view(expected), 255, 5);
+    gil::threshold_adaptive(gil::view(image), gil::view(image), 255, 5);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(image)));
+}
+
+int main()
+{
+    test_threshold_adaptive_mean();
+    test_threshold_adaptive_mean_in_place();
+
+    return ::boost::report_errors();
+}
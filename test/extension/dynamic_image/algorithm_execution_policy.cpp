@@ -0,0 +1,183 @@
+//
+// Copyright 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil.hpp>
+#include <boost/gil/extension/dynamic_image/algorithm.hpp>
+#include <boost/gil/extension/dynamic_image/any_image.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace gil = boost::gil;
+
+using any_image_t = gil::any_image<gil::gray8_image_t, gil::rgb8_image_t>;
+
+std::ptrdiff_t const width = 128;
+std::ptrdiff_t const height = 97;
+
+gil::rgb8_image_t make_gradient_image()
+{
+    gil::rgb8_image_t image(width, height);
+    auto v = gil::view(image);
+    for (std::ptrdiff_t y = 0; y < v.height(); ++y)
+        for (std::ptrdiff_t x = 0; x < v.width(); ++x)
+            v(x, y) = gil::rgb8_pixel_t(
+                static_cast<std::uint8_t>(x),
+                static_cast<std::uint8_t>(y),
+                static_cast<std::uint8_t>(x * y));
+    return image;
+}
+
+void test_copy_pixels()
+{
+    auto const src = make_gradient_image();
+    any_image_t any_dst(gil::rgb8_image_t(width, height));
+
+    gil::copy_pixels(gil::execution::par(4), gil::const_view(src), gil::view(any_dst));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(src), gil::view(any_dst)));
+
+    any_image_t any_src(src);
+    gil::rgb8_image_t dst(width, height);
+    gil::copy_pixels(gil::execution::par(4), gil::view(any_src), gil::view(dst));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(src), gil::const_view(dst)));
+
+    any_image_t any_dst2(gil::rgb8_image_t(width, height));
+    gil::copy_pixels(gil::execution::par(4), gil::view(any_src), gil::view(any_dst2));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(src), gil::view(any_dst2)));
+
+    any_image_t any_gray(gil::gray8_image_t(width, height));
+    BOOST_TEST_THROWS(
+        gil::copy_pixels(gil::execution::par(4), gil::view(any_src), gil::view(any_gray)),
+        std::bad_cast);
+}
+
+void test_copy_and_convert_pixels()
+{
+    auto const src = make_gradient_image();
+    gil::gray8_image_t expected(width, height);
+    gil::copy_and_convert_pixels(gil::const_view(src), gil::view(expected));
+
+    any_image_t any_src(src);
+    gil::gray8_image_t dst(width, height);
+    gil::copy_and_convert_pixels(gil::execution::par(4), gil::view(any_src), gil::view(dst));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(dst)));
+
+    any_image_t any_dst(gil::gray8_image_t(width, height));
+    gil::copy_and_convert_pixels(gil::execution::par(4), gil::const_view(src), gil::view(any_dst));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::view(any_dst)));
+
+    any_image_t any_dst2(gil::gray8_image_t(width, height));
+    gil::copy_and_convert_pixels(gil::execution::par(4),
+        gil::view(any_src), gil::view(any_dst2), gil::default_color_converter());
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::view(any_dst2)));
+}
+
+void test_fill_pixels()
+{
+    gil::rgb8_pixel_t const red(255, 0, 0);
+    any_image_t any_image(gil::rgb8_image_t(width, height));
+    gil::fill_pixels(gil::execution::par(4), gil::view(any_image), red);
+
+    gil::rgb8_image_t expected(width, height, red);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::view(any_image)));
+
+    any_image_t any_gray(gil::gray8_image_t(width, height));
+    BOOST_TEST_THROWS(
+        gil::fill_pixels(gil::execution::par(4), gil::view(any_gray), red),
+        std::bad_cast);
+}
+
+// Sums first channel, shared by bands, of either view type
+struct sum_first_channel
+{
+    std::atomic<std::uint64_t>* sum;
+
+    template <typename Pixel>
+    void operator()(Pixel const& p) const
+    {
+        *sum += static_cast<std::uint64_t>(gil::at_c<0>(p));
+    }
+};
+
+struct invert_channels
+{
+    template <typename Pixel>
+    Pixel operator()(Pixel const& p) const
+    {
+        Pixel result;
+        gil::static_transform(p, result, [](std::uint8_t c) {
+            return static_cast<std::uint8_t>(255 - c);
+        });
+        return result;
+    }
+};
+
+void test_for_each_pixel()
+{
+    auto const src = make_gradient_image();
+    std::uint64_t expected = 0;
+    gil::for_each_pixel(gil::const_view(src), [&expected](gil::rgb8_pixel_t const& p) {
+        expected += gil::at_c<0>(p);
+    });
+
+    any_image_t any_src(src);
+    std::atomic<std::uint64_t> sum{0};
+    gil::for_each_pixel(gil::execution::par(4), gil::view(any_src), sum_first_channel{&sum});
+    BOOST_TEST_EQ(sum.load(), expected);
+}
+
+void test_generate_pixels()
+{
+    // Generated value has to be assignable to pixels of every view type
+    using any_gray_image_t = gil::any_image<gil::gray8_image_t, gil::gray16_image_t>;
+    any_gray_image_t any_image(gil::gray8_image_t(width, height));
+    gil::generate_pixels(gil::execution::par(4), gil::view(any_image), [] {
+        return std::uint8_t(42);
+    });
+
+    gil::gray8_image_t expected(width, height, gil::gray8_pixel_t(42));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::view(any_image)));
+}
+
+void test_transform_pixels()
+{
+    auto const src = make_gradient_image();
+    gil::rgb8_image_t expected(width, height);
+    gil::transform_pixels(gil::const_view(src), gil::view(expected), invert_channels());
+
+    // Function object has to accept every pair of view types, so use views of single type
+    using any_rgb_image_t = gil::any_image<gil::rgb8_image_t>;
+    any_rgb_image_t any_src(src);
+    gil::rgb8_image_t dst(width, height);
+    gil::transform_pixels(gil::execution::par(4), gil::view(any_src), gil::view(dst),
+        invert_channels());
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(dst)));
+
+    any_rgb_image_t any_dst(gil::rgb8_image_t(width, height));
+    gil::transform_pixels(gil::execution::par(4), gil::const_view(src), gil::view(any_dst),
+        invert_channels());
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::view(any_dst)));
+
+    any_rgb_image_t any_dst2(gil::rgb8_image_t(width, height));
+    gil::transform_pixels(gil::execution::par(4), gil::view(any_src), gil::view(any_dst2),
+        invert_channels());
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::view(any_dst2)));
+}
+
+int main()
+{
+    test_copy_pixels();
+    test_copy_and_convert_pixels();
+    test_fill_pixels();
+    test_for_each_pixel();
+    test_generate_pixels();
+    test_transform_pixels();
+
+    return ::boost::report_errors();
+}
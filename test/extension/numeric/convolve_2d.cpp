@@ -10,7 +10,11 @@
 
 #include <boost/core/lightweight_test.hpp>
 
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
 
 namespace gil = boost::gil;
 
@@ -60,9 +64,216 @@ void test_convolve_2d_with_normalized_mean_filter()
     BOOST_TEST(gil::equal_pixels(out_view, dst_view));
 }
 
+// Straightforward per-pixel definition of convolve_2d used as reference
+template <typename SrcView, typename Kernel>
+float reference_convolve_at(
+    SrcView const& src, Kernel const& kernel, std::ptrdiff_t x, std::ptrdiff_t y,
+    gil::boundary_option option)
+{
+    auto const k = static_cast<std::ptrdiff_t>(kernel.size());
+    auto const cx = static_cast<std::ptrdiff_t>(kernel.center_x());
+    auto const cy = static_cast<std::ptrdiff_t>(kernel.center_y());
+    float sum = 0.0f;
+    for (std::ptrdiff_t i = 0; i < k; ++i)
+    {
+        for (std::ptrdiff_t j = 0; j < k; ++j)
+        {
+            std::ptrdiff_t sx = x + cx - j;
+            std::ptrdiff_t sy = y + cy - i;
+            bool const inside = sx >= 0 && sx < src.width() && sy >= 0 && sy < src.height();
+            if (!inside && option == gil::boundary_option::extend_zero)
+                continue;
+            if (option == gil::boundary_option::extend_constant)
+            {
+                sx = std::min(std::max<std::ptrdiff_t>(sx, 0), src.width() - 1);
+                sy = std::min(std::max<std::ptrdiff_t>(sy, 0), src.height() - 1);
+            }
+            // locator reads past the view bounds for extend_padded
+            auto const loc = src.xy_at(0, 0);
+            sum += static_cast<float>(gil::at_c<0>(loc(sx, sy))) * kernel.begin()[j * k + i];
+        }
+    }
+    return sum;
+}
+
+template <typename Kernel>
+void test_convolve_2d_matches_reference(Kernel const& kernel, bool exact)
+{
+    std::ptrdiff_t const width = 23;
+    std::ptrdiff_t const height = 17;
+    std::ptrdiff_t const pad = 8;
+
+    // Source is a subimage of a larger image, so that extend_padded reads real pixels
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> dist(0, 255);
+    gil::gray8_image_t padded(width + 2 * pad, height + 2 * pad);
+    for (auto& p : gil::view(padded))
+        p = gil::gray8_pixel_t(static_cast<std::uint8_t>(dist(rng)));
+    auto const src = gil::subimage_view(gil::const_view(padded), pad, pad, width, height);
+    auto const k = static_cast<std::ptrdiff_t>(kernel.size());
+
+    for (auto option : {
+        gil::boundary_option::output_ignore,
+        gil::boundary_option::output_zero,
+        gil::boundary_option::extend_padded,
+        gil::boundary_option::extend_zero,
+        gil::boundary_option::extend_constant})
+    {
+        gil::gray32f_image_t dst(width, height, gil::gray32f_pixel_t(-1.0f));
+        gil::detail::convolve_2d(src, kernel, gil::view(dst), option);
+
+        auto const left = k - 1 - static_cast<std::ptrdiff_t>(kernel.center_x());
+        auto const top = k - 1 - static_cast<std::ptrdiff_t>(kernel.center_y());
+        bool all_match = true;
+        for (std::ptrdiff_t y = 0; y < height; ++y)
+        {
+            for (std::ptrdiff_t x = 0; x < width; ++x)
+            {
+                bool const interior = x >= left && x < width - (k - 1 - left) &&
+                                      y >= top && y < height - (k - 1 - top);
+                float expected = reference_convolve_at(src, kernel, x, y, option);
+                if (!interior && option == gil::boundary_option::output_ignore)
+                    expected = -1.0f;
+                else if (!interior && option == gil::boundary_option::output_zero)
+                    expected = 0.0f;
+
+                float const actual = gil::at_c<0>(gil::view(dst)(x, y));
+                float const tolerance = exact ? 0.0f : 1e-3f * (1.0f + std::abs(expected));
+                bool const match = std::abs(actual - expected) <= tolerance;
+                all_match = all_match && match;
+            }
+        }
+        BOOST_TEST(all_match);
+    }
+}
+
+void test_convolve_2d_separable_float_kernel()
+{
+    // Outer product of [1 2 3 2 1] and [0.1 0.3 0.2], asymmetric, off-centre anchor
+    float const col[] = {1.0f, 2.0f, 3.0f, 2.0f, 1.0f};
+    float const row[] = {0.1f, 0.3f, 0.2f, 0.0f, 0.4f};
+    std::vector<float> v;
+    for (float c : col)
+        for (float r : row)
+            v.push_back(c * r);
+    gil::detail::kernel_2d<float> kernel(v.begin(), v.size(), 1, 3);
+    test_convolve_2d_matches_reference(kernel, false);
+}
+
+void test_convolve_2d_non_separable_float_kernel()
+{
+    std::vector<float> v = {
+        0.1f, 0.2f, -0.3f,
+        0.7f, 0.0f, 0.25f,
+        -0.5f, 0.3f, 0.9f};
+    gil::detail::kernel_2d<float> kernel(v.begin(), v.size(), 0, 2);
+    test_convolve_2d_matches_reference(kernel, false);
+}
+
+void test_convolve_2d_integer_kernels_are_exact()
+{
+    // Sobel is separable, Laplacian is not, both take fixed-point path for 8-bit source
+    std::vector<float> sobel = {-1, 0, 1, -2, 0, 2, -1, 0, 1};
+    gil::detail::kernel_2d<float> sobel_kernel(sobel.begin(), sobel.size(), 1, 1);
+    test_convolve_2d_matches_reference(sobel_kernel, true);
+
+    std::vector<float> laplace = {0, 1, 0, 1, -4, 1, 0, 1, 0};
+    gil::detail::kernel_2d<float> laplace_kernel(laplace.begin(), laplace.size(), 1, 1);
+    test_convolve_2d_matches_reference(laplace_kernel, true);
+
+    // Binomial kernel with dyadic weights
+    std::vector<float> binomial;
+    float const b[] = {1, 4, 6, 4, 1};
+    for (float r : b)
+        for (float c : b)
+            binomial.push_back(r * c / 256.0f);
+    gil::detail::kernel_2d<float> binomial_kernel(binomial.begin(), binomial.size(), 2, 2);
+    test_convolve_2d_matches_reference(binomial_kernel, true);
+}
+
+void test_convolve_2d_large_kernel_integer_view()
+{
+    // Large kernels would be cheaper through FFT, but integral destinations truncate
+    // the sums, so they must match direct accumulation in float exactly
+    std::ptrdiff_t const size = 256;
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> sample_dist(0, 255);
+    gil::gray8_image_t src(size, size);
+    for (auto& p : gil::view(src))
+        p = gil::gray8_pixel_t(static_cast<std::uint8_t>(sample_dist(rng)));
+    auto const src_view = gil::const_view(src);
+
+    for (std::size_t k : {15u, 25u})
+    {
+        std::uniform_real_distribution<float> weight_dist(0.0f, 1.0f);
+        std::vector<float> v(k * k);
+        float sum = 0.0f;
+        for (auto& w : v)
+        {
+            w = weight_dist(rng);
+            sum += w;
+        }
+        for (auto& w : v)
+            w *= 0.99f / sum;
+        gil::detail::kernel_2d<float> kernel(v.begin(), v.size(), k / 2, k / 3);
+
+        gil::gray8_image_t dst(size, size);
+        gil::detail::convolve_2d(src_view, kernel, gil::view(dst));
+
+        // Same order of accumulation as direct path, rows top to bottom, columns left to right
+        auto const n = static_cast<std::ptrdiff_t>(k);
+        auto const cx = static_cast<std::ptrdiff_t>(kernel.center_x());
+        auto const cy = static_cast<std::ptrdiff_t>(kernel.center_y());
+        std::size_t mismatches = 0;
+        for (std::ptrdiff_t y = 0; y < size; ++y)
+        {
+            for (std::ptrdiff_t x = 0; x < size; ++x)
+            {
+                float acc = 0.0f;
+                for (std::ptrdiff_t i = n - 1; i >= 0; --i)
+                {
+                    for (std::ptrdiff_t j = n - 1; j >= 0; --j)
+                    {
+                        std::ptrdiff_t const sx = x + cx - j;
+                        std::ptrdiff_t const sy = y + cy - i;
+                        if (sx < 0 || sx >= size || sy < 0 || sy >= size)
+                            continue;
+                        acc += kernel.begin()[j * n + i] *
+                               static_cast<float>(gil::at_c<0>(src_view(sx, sy)));
+                    }
+                }
+                if (gil::at_c<0>(gil::view(dst)(x, y)) != static_cast<std::uint8_t>(acc))
+                    ++mismatches;
+            }
+        }
+        BOOST_TEST_EQ(mismatches, 0u);
+    }
+}
+
+void test_convolve_2d_rgb()
+{
+    gil::rgb8_image_t src(9, 9, gil::rgb8_pixel_t(0, 0, 0));
+    gil::view(src)(4, 4) = gil::rgb8_pixel_t(9, 18, 27);
+    std::vector<float> v(9, 1.0f / 9.0f);
+    gil::detail::kernel_2d<float> kernel(v.begin(), v.size(), 1, 1);
+
+    gil::rgb32f_image_t dst(9, 9);
+    gil::detail::convolve_2d(gil::const_view(src), kernel, gil::view(dst));
+    auto const p = gil::view(dst)(3, 5);
+    BOOST_TEST(std::abs(gil::at_c<0>(p) - 1.0f) < 1e-5f);
+    BOOST_TEST(std::abs(gil::at_c<1>(p) - 2.0f) < 1e-5f);
+    BOOST_TEST(std::abs(gil::at_c<2>(p) - 3.0f) < 1e-5f);
+    BOOST_TEST_EQ(gil::at_c<0>(gil::view(dst)(2, 2)), 0.0f);
+}
+
 int main()
 {
     test_convolve_2d_with_normalized_mean_filter();
+    test_convolve_2d_separable_float_kernel();
+    test_convolve_2d_non_separable_float_kernel();
+    test_convolve_2d_integer_kernels_are_exact();
+    test_convolve_2d_large_kernel_integer_view();
+    test_convolve_2d_rgb();
 
     return ::boost::report_errors();
 }
@@ -10,8 +10,11 @@
 
 #include <boost/core/lightweight_test.hpp>
 
+#include <cstddef>
+#include <random>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 #include "test_fixture.hpp"
 #include "core/image/test_fixture.hpp"
@@ -64,10 +67,78 @@ struct test_image_1x1_kernel_3x3_identity
     }
 };
 
+struct test_matches_transposed_rows
+{
+    // Column pass must give the same results as row pass over transposed view,
+    // for images spanning several blocks of columns, processed in place as well
+    static void run()
+    {
+        using pixel_t = gil::rgb32f_pixel_t;
+        std::mt19937 rng(3);
+        std::uniform_int_distribution<int> dist(0, 255);
+
+        gil::rgb32f_image_t img(300, 37);
+        for (auto& p : gil::view(img))
+        {
+            p = pixel_t(static_cast<float>(dist(rng)), static_cast<float>(dist(rng)),
+                static_cast<float>(dist(rng)));
+        }
+        // Padding, so that extend_padded reads rows above and below the view
+        auto const src = gil::subimage_view(gil::const_view(img), 0, 6, 300, 25);
+
+        std::vector<float> const weights = {0.5f, -1.0f, 2.0f, 0.25f, 1.5f, -0.75f, 0.125f};
+        for (std::size_t center : {std::size_t(0), std::size_t(2), std::size_t(6)})
+        {
+            gil::kernel_1d<float> const kernel(weights.begin(), weights.size(), center);
+            for (auto option : {gil::boundary_option::output_ignore,
+                     gil::boundary_option::output_zero, gil::boundary_option::extend_padded,
+                     gil::boundary_option::extend_zero, gil::boundary_option::extend_constant})
+            {
+                // Rows left by output_ignore keep the source
+                gil::rgb32f_image_t expected(src.dimensions());
+                gil::rgb32f_image_t actual(src.dimensions());
+                gil::copy_pixels(src, gil::view(expected));
+                gil::copy_pixels(src, gil::view(actual));
+                gil::correlate_rows<pixel_t>(gil::transposed_view(src), kernel,
+                    gil::transposed_view(gil::view(expected)), option);
+                gil::correlate_cols<pixel_t>(src, kernel, gil::view(actual), option);
+                BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(actual)));
+
+                gil::copy_pixels(src, gil::view(expected));
+                gil::convolve_rows<pixel_t>(gil::transposed_view(src), kernel,
+                    gil::transposed_view(gil::view(expected)), option);
+                gil::rgb32f_image_t in_place(src.dimensions());
+                gil::copy_pixels(src, gil::view(in_place));
+                auto const in_place_view = gil::view(in_place);
+                if (option == gil::boundary_option::extend_padded)
+                    gil::convolve_cols<pixel_t>(src, kernel, in_place_view, option);
+                else
+                    gil::convolve_cols<pixel_t>(in_place_view, kernel, in_place_view, option);
+                BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(in_place)));
+            }
+        }
+
+        // Fixed-size kernel and image shorter than the kernel
+        gil::kernel_1d_fixed<float, 5> const fixed(weights.begin(), 1);
+        auto const short_src = gil::subimage_view(src, 0, 0, 300, 3);
+        gil::rgb32f_image_t expected(short_src.dimensions());
+        gil::rgb32f_image_t actual(short_src.dimensions());
+        for (auto option :
+            {gil::boundary_option::output_zero, gil::boundary_option::extend_constant})
+        {
+            gil::convolve_rows_fixed<pixel_t>(gil::transposed_view(short_src), fixed,
+                gil::transposed_view(gil::view(expected)), option);
+            gil::convolve_cols_fixed<pixel_t>(short_src, fixed, gil::view(actual), option);
+            BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(actual)));
+        }
+    }
+};
+
 int main()
 {
     test_image_1x1_kernel_1x1_identity::run();
     test_image_1x1_kernel_3x3_identity::run();
+    test_matches_transposed_rows::run();
 
     return ::boost::report_errors();
 }
@@ -0,0 +1,252 @@
+//
+// Copyright 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil.hpp>
+#include <boost/gil/extension/numeric/convolve.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "core/image/test_fixture.hpp"
+
+namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
+
+using kernel_t = gil::kernel_1d<float>;
+
+std::vector<gil::boundary_option> const options = {
+    gil::boundary_option::output_ignore, gil::boundary_option::output_zero,
+    gil::boundary_option::extend_padded, gil::boundary_option::extend_zero,
+    gil::boundary_option::extend_constant};
+
+std::vector<kernel_t> make_kernels()
+{
+    std::vector<kernel_t> kernels;
+    std::vector<float> const box(9, 1.0f / 9.0f);
+    kernels.emplace_back(box.begin(), box.size(), 4);
+    std::vector<float> const sharpen = {-0.5f, 2.0f, -0.5f};
+    kernels.emplace_back(sharpen.begin(), sharpen.size(), 1);
+    std::vector<float> gaussian;
+    for (int i = -5; i <= 5; ++i)
+        gaussian.push_back(std::exp(-static_cast<float>(i * i) / 8.0f));
+    float const sum = std::accumulate(gaussian.begin(), gaussian.end(), 0.0f);
+    for (auto& w : gaussian)
+        w /= sum;
+    kernels.emplace_back(gaussian.begin(), gaussian.size(), 5);
+    kernels.emplace_back(gaussian.begin(), gaussian.size(), 2);
+    std::vector<float> const derivative = {-1.0f, 0.0f, 1.0f, 0.3f};
+    kernels.emplace_back(derivative.begin(), derivative.size(), 3);
+    return kernels;
+}
+
+// Correlation along rows in double precision, rounded and saturated, with samples
+// of rows left by output_ignore set to prefill value
+template <typename View>
+std::vector<double> reference_rows(
+    View const& view, kernel_t const& kernel, gil::boundary_option option, double prefill)
+{
+    using channel_t = typename gil::channel_type<View>::type;
+    double const lowest = static_cast<double>(gil::channel_traits<channel_t>::min_value());
+    double const highest = static_cast<double>(gil::channel_traits<channel_t>::max_value());
+    std::size_t const channels = gil::num_channels<View>::value;
+    auto const width = view.width();
+    auto const k = static_cast<std::ptrdiff_t>(kernel.size());
+    auto const left = static_cast<std::ptrdiff_t>(kernel.left_size());
+    bool const output_only = option == gil::boundary_option::output_ignore ||
+                             option == gil::boundary_option::output_zero;
+    double const outside = option == gil::boundary_option::output_zero ? 0.0 : prefill;
+
+    std::vector<double> result;
+    for (std::ptrdiff_t y = 0; y < view.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < width; ++x)
+        {
+            for (std::size_t c = 0; c < channels; ++c)
+            {
+                if (output_only && (width < k || x < left || x >= width - (k - 1 - left)))
+                {
+                    result.push_back(outside);
+                    continue;
+                }
+                double sum = 0.0;
+                for (std::ptrdiff_t i = 0; i < k; ++i)
+                {
+                    std::ptrdiff_t sx = x - left + i;
+                    double sample = 0.0;
+                    if (option == gil::boundary_option::extend_padded || (sx >= 0 && sx < width))
+                    {
+                        sample = (*view.xy_at(0, y).x_at(sx, 0))[c];
+                    }
+                    else if (option == gil::boundary_option::extend_constant)
+                    {
+                        sx = (std::min)((std::max)(sx, std::ptrdiff_t(0)), width - 1);
+                        sample = view(sx, y)[c];
+                    }
+                    sum += static_cast<double>(kernel[static_cast<std::size_t>(i)]) * sample;
+                }
+                result.push_back((std::min)((std::max)(std::floor(sum + 0.5), lowest), highest));
+            }
+        }
+    }
+    return result;
+}
+
+template <typename View>
+double max_difference(View const& view, std::vector<double> const& expected)
+{
+    double result = 0.0;
+    std::size_t i = 0;
+    for (std::ptrdiff_t y = 0; y < view.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < view.width(); ++x)
+        {
+            for (std::size_t c = 0; c < gil::num_channels<View>::value; ++c)
+            {
+                double const v = view(x, y)[c];
+                result = (std::max)(result, std::abs(v - expected[i++]));
+            }
+        }
+    }
+    return result;
+}
+
+void test_rows_and_cols_match_reference()
+{
+    // Padding around the view is read by extend_padded
+    auto const image = fixture::generate_image<gil::rgb8_image_t>(
+        150, 90, fixture::random_value<std::uint8_t>(1, 0, 255));
+    auto const src = gil::subimage_view(gil::const_view(image), 10, 10, 130, 70);
+    std::uint8_t const prefill = 7;
+
+    for (auto const& kernel : make_kernels())
+    {
+        for (auto option : options)
+        {
+            gil::rgb8_pixel_t const fill(prefill, prefill, prefill);
+            gil::rgb8_image_t rows(src.dimensions(), fill, 0);
+            gil::correlate_rows_fixed_point(src, kernel, gil::view(rows), option);
+            BOOST_TEST_LE(max_difference(gil::const_view(rows),
+                reference_rows(src, kernel, option, prefill)), 1.0);
+
+            gil::rgb8_image_t cols(src.dimensions(), fill, 0);
+            gil::correlate_cols_fixed_point(src, kernel, gil::view(cols), option);
+            BOOST_TEST_LE(max_difference(gil::transposed_view(gil::const_view(cols)),
+                reference_rows(gil::transposed_view(src), kernel, option, prefill)), 1.0);
+        }
+
+        // Planar pixels are loaded and stored channel by channel
+        gil::rgb8_planar_image_t planar(src.dimensions());
+        gil::copy_pixels(src, gil::view(planar));
+        gil::rgb8_image_t expected(src.dimensions());
+        gil::correlate_rows_fixed_point(src, kernel, gil::view(expected),
+            gil::boundary_option::extend_constant);
+        gil::correlate_rows_fixed_point(gil::const_view(planar), kernel, gil::view(planar),
+            gil::boundary_option::extend_constant);
+        BOOST_TEST(gil::equal_pixels(gil::const_view(planar), gil::const_view(expected)));
+    }
+}
+
+void test_16bit_and_saturation()
+{
+    // Weights of 16-bit samples are quantized to 2^-14 of their sum of magnitudes
+    // at best, so 16-bit results are accurate to about 2^-13 relative to the maximum
+    auto const image = fixture::generate_image<gil::gray16_image_t>(
+        70, 300, fixture::random_value<std::uint16_t>(2, 0, 65535));
+    auto const src = gil::const_view(image);
+    for (auto const& kernel : make_kernels())
+    {
+        gil::gray16_image_t result(src.dimensions());
+        gil::correlate_cols_fixed_point(
+            src, kernel, gil::view(result), gil::boundary_option::extend_constant);
+        BOOST_TEST_LE(max_difference(gil::transposed_view(gil::const_view(result)),
+            reference_rows(gil::transposed_view(src), kernel,
+                gil::boundary_option::extend_constant, 0.0)), 8.0);
+    }
+
+    // Weights too large for int16 are applied in floating-point arithmetic
+    std::vector<float> const large = {0.0f, 40000.0f, -40000.5f};
+    kernel_t const kernel(large.begin(), large.size(), 1);
+    gil::gray8_image_t gray(src.dimensions());
+    gil::copy_pixels(gil::color_converted_view<gil::gray8_pixel_t>(src), gil::view(gray));
+    gil::gray8_image_t result(src.dimensions());
+    gil::correlate_rows_fixed_point(gil::const_view(gray), kernel, gil::view(result));
+    BOOST_TEST_LE(max_difference(gil::const_view(result), reference_rows(gil::const_view(gray),
+        kernel, gil::boundary_option::extend_zero, 0.0)), 0.0);
+}
+
+void test_constant_image_and_in_place()
+{
+    gil::rgb8_image_t constant(41, 29, gil::rgb8_pixel_t(200, 3, 255), 0);
+    auto const kernel = make_kernels()[2];
+    gil::rgb8_image_t result(constant.dimensions());
+    gil::convolve_rows_fixed_point(gil::const_view(constant), kernel, gil::view(result),
+        gil::boundary_option::extend_constant);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(constant), gil::const_view(result)));
+    gil::convolve_cols_fixed_point(gil::const_view(constant), kernel, gil::view(result),
+        gil::boundary_option::extend_constant);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(constant), gil::const_view(result)));
+
+    auto const image = fixture::generate_image<gil::rgb8_image_t>(
+        300, 40, fixture::random_value<std::uint8_t>(3, 0, 255));
+    for (auto option : options)
+    {
+        if (option == gil::boundary_option::extend_padded)
+            continue;
+        gil::rgb8_image_t expected(image);
+        gil::rgb8_image_t in_place(image);
+        gil::convolve_cols_fixed_point(
+            gil::const_view(image), kernel, gil::view(expected), option);
+        gil::convolve_cols_fixed_point(gil::view(in_place), kernel, gil::view(in_place), option);
+        BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(in_place)));
+
+        gil::copy_pixels(gil::const_view(image), gil::view(expected));
+        gil::copy_pixels(gil::const_view(image), gil::view(in_place));
+        gil::convolve_rows_fixed_point(
+            gil::const_view(image), kernel, gil::view(expected), option);
+        gil::convolve_rows_fixed_point(gil::view(in_place), kernel, gil::view(in_place), option);
+        BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(in_place)));
+    }
+}
+
+void test_float_destination()
+{
+    auto const image = fixture::generate_image<gil::gray8_image_t>(
+        50, 20, fixture::random_value<std::uint8_t>(4, 0, 255));
+    auto const kernel = make_kernels()[1];
+    gil::gray32f_image_t result(image.dimensions());
+    gil::correlate_rows_fixed_point(gil::const_view(image), kernel, gil::view(result));
+
+    // Sharpening weights are exact in fixed point, results are not rounded nor saturated
+    bool all_match = true;
+    auto const src = gil::const_view(image);
+    for (std::ptrdiff_t y = 0; y < src.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 1; x + 1 < src.width(); ++x)
+        {
+            float const expected = 2.0f * src(x, y) - 0.5f * (src(x - 1, y) + src(x + 1, y));
+            float const actual = gil::at_c<0>(gil::const_view(result)(x, y));
+            all_match = all_match && std::abs(actual - expected) < 1e-3f;
+        }
+    }
+    BOOST_TEST(all_match);
+}
+
+int main()
+{
+    test_rows_and_cols_match_reference();
+    test_16bit_and_saturation();
+    test_constant_image_and_in_place();
+    test_float_destination();
+
+    return ::boost::report_errors();
+}
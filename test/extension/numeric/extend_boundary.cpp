@@ -11,6 +11,10 @@
 
 #include <boost/core/lightweight_test.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 namespace gil = boost::gil;
 
 std::uint8_t img[] =
@@ -236,6 +240,115 @@ void test_extend_img_with_padded()
     BOOST_TEST(gil::equal_pixels(src_view, gil::view(output)));
 }
 
+void test_extend_coordinate()
+{
+    // Row abcd extended by six samples on each side
+    auto extended_row = [](gil::boundary_mode mode) {
+        std::vector<std::ptrdiff_t> row;
+        for (std::ptrdiff_t x = -6; x < 10; ++x)
+            row.push_back(gil::extend_coordinate(x, 4, mode));
+        return row;
+    };
+    std::vector<std::ptrdiff_t> const constant =
+        {-1, -1, -1, -1, -1, -1, 0, 1, 2, 3, -1, -1, -1, -1, -1, -1};
+    std::vector<std::ptrdiff_t> const replicate =
+        {0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 3, 3, 3, 3, 3, 3};
+    std::vector<std::ptrdiff_t> const reflect =
+        {2, 3, 3, 2, 1, 0, 0, 1, 2, 3, 3, 2, 1, 0, 0, 1};
+    std::vector<std::ptrdiff_t> const reflect_101 =
+        {0, 1, 2, 3, 2, 1, 0, 1, 2, 3, 2, 1, 0, 1, 2, 3};
+    std::vector<std::ptrdiff_t> const wrap =
+        {2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1};
+    BOOST_TEST(extended_row(gil::boundary_mode::constant) == constant);
+    BOOST_TEST(extended_row(gil::boundary_mode::replicate) == replicate);
+    BOOST_TEST(extended_row(gil::boundary_mode::reflect) == reflect);
+    BOOST_TEST(extended_row(gil::boundary_mode::reflect_101) == reflect_101);
+    BOOST_TEST(extended_row(gil::boundary_mode::wrap) == wrap);
+
+    // Single sample is reflected onto itself
+    BOOST_TEST_EQ(gil::extend_coordinate(-3, 1, gil::boundary_mode::reflect_101), 0);
+    BOOST_TEST_EQ(gil::extend_coordinate(5, 1, gil::boundary_mode::reflect), 0);
+}
+
+void test_boundary_extended_view_matches_extend_boundary()
+{
+    gil::gray8c_view_t src_view =
+        gil::interleaved_view(9, 9, reinterpret_cast<const gil::gray8_pixel_t *>(img), 9);
+
+    auto zero = gil::boundary_extended_view(src_view, 2, gil::boundary_mode::constant);
+    auto expected_zero = gil::extend_boundary(src_view, 2, gil::boundary_option::extend_zero);
+    BOOST_TEST(zero.dimensions() == gil::point_t(13, 13));
+    BOOST_TEST(gil::equal_pixels(zero, gil::const_view(expected_zero)));
+
+    auto replicate = gil::boundary_extended_view(src_view, 2, gil::boundary_mode::replicate);
+    auto expected_replicate =
+        gil::extend_boundary(src_view, 2, gil::boundary_option::extend_constant);
+    BOOST_TEST(gil::equal_pixels(replicate, gil::const_view(expected_replicate)));
+
+    // Constant pixel and reads beyond the extended dimensions through locator
+    auto constant = gil::boundary_extended_view(
+        src_view, 1, gil::boundary_mode::constant, gil::gray8_pixel_t(7));
+    BOOST_TEST_EQ(constant(0, 0), gil::gray8_pixel_t(7));
+    BOOST_TEST_EQ(constant(1, 1), src_view(0, 0));
+    auto wrap = gil::boundary_extended_view(src_view, 0, gil::boundary_mode::wrap);
+    BOOST_TEST(wrap.dimensions() == src_view.dimensions());
+    BOOST_TEST_EQ(*(wrap.xy_at(0, 0) + gil::point_t(-1, 20)), src_view(8, 2));
+    auto reflect = gil::boundary_extended_view(src_view, 3, gil::boundary_mode::reflect);
+    BOOST_TEST_EQ(reflect(0, 4), src_view(2, 1));
+    BOOST_TEST_EQ(*(reflect.xy_at(0, 0) + gil::point_t(-1, 15)), src_view(3, 5));
+}
+
+void test_boundary_extended_view_of_rgb()
+{
+    gil::rgb8_image_t image(3, 2);
+    auto v = gil::view(image);
+    for (std::ptrdiff_t y = 0; y < 2; ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < 3; ++x)
+        {
+            auto const value = static_cast<std::uint8_t>(10 * y + x);
+            v(x, y) = gil::rgb8_pixel_t(value, value, static_cast<std::uint8_t>(100 + value));
+        }
+    }
+
+    auto extended = gil::boundary_extended_view(
+        gil::const_view(image), 2, gil::boundary_mode::reflect_101);
+    gil::rgb8_image_t copy(extended.dimensions());
+    gil::copy_pixels(extended, gil::view(copy));
+    bool all_match = true;
+    for (std::ptrdiff_t y = 0; y < copy.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < copy.width(); ++x)
+        {
+            auto const mode = gil::boundary_mode::reflect_101;
+            std::ptrdiff_t const sx = gil::extend_coordinate(x - 2, 3, mode);
+            std::ptrdiff_t const sy = gil::extend_coordinate(y - 2, 2, mode);
+            all_match = all_match && gil::const_view(copy)(x, y) == v(sx, sy);
+        }
+    }
+    BOOST_TEST(all_match);
+}
+
+void test_interior_region()
+{
+    gil::gray8_image_t image(10, 6);
+    auto const region = gil::interior_region(
+        gil::const_view(image), gil::point_t(2, 1), gil::point_t(3, 1));
+    BOOST_TEST_EQ(region.x_begin, 2);
+    BOOST_TEST_EQ(region.x_end, 7);
+    BOOST_TEST_EQ(region.y_begin, 1);
+    BOOST_TEST_EQ(region.y_end, 5);
+    BOOST_TEST(!region.empty());
+    BOOST_TEST(region.contains(2, 4));
+    BOOST_TEST(!region.contains(7, 4));
+
+    // Windows larger than the view leave no interior
+    auto const none = gil::interior_region(
+        gil::const_view(image), gil::point_t(4, 4), gil::point_t(4, 4));
+    BOOST_TEST(none.empty());
+    BOOST_TEST_LE(none.y_begin, 6);
+}
+
 int main()
 {
     test_extend_row_with_constant();
@@ -247,6 +360,10 @@ int main()
     test_extend_img_with_constant();
     test_extend_img_with_zero();
     test_extend_img_with_padded();
+    test_extend_coordinate();
+    test_boundary_extended_view_matches_extend_boundary();
+    test_boundary_extended_view_of_rgb();
+    test_interior_region();
 
     return ::boost::report_errors();
 }
@@ -0,0 +1,247 @@
+//
+// Copyright 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil.hpp>
+#include <boost/gil/extension/numeric/convolve.hpp>
+#include <boost/gil/extension/numeric/fft.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace gil = boost::gil;
+
+void test_fft_good_size()
+{
+    BOOST_TEST_EQ(gil::detail::fft_good_size(0), 2u);
+    BOOST_TEST_EQ(gil::detail::fft_good_size(3), 4u);
+    BOOST_TEST_EQ(gil::detail::fft_good_size(7), 8u);
+    BOOST_TEST_EQ(gil::detail::fft_good_size(11), 12u);
+    BOOST_TEST_EQ(gil::detail::fft_good_size(13), 16u);
+    BOOST_TEST_EQ(gil::detail::fft_good_size(29), 30u);
+    BOOST_TEST_EQ(gil::detail::fft_good_size(97), 100u);
+}
+
+void test_fft_plan_matches_dft()
+{
+    double const pi = 3.14159265358979323846;
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+    for (std::size_t n : {1, 2, 3, 4, 5, 6, 8, 12, 14, 15, 30, 64, 90})
+    {
+        std::vector<std::complex<float>> in(n), out(n);
+        for (auto& v : in)
+            v = std::complex<float>(dist(rng), dist(rng));
+
+        gil::detail::fft_plan const plan(n);
+        plan.forward(in.data(), 1, out.data());
+
+        double max_error = 0.0;
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            std::complex<double> sum = 0.0;
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                double const phase = -2.0 * pi * static_cast<double>(j * k % n) / static_cast<double>(n);
+                sum += std::complex<double>(in[j]) * std::polar(1.0, phase);
+            }
+            max_error = std::max(max_error, std::abs(sum - std::complex<double>(out[k])));
+        }
+        BOOST_TEST_LT(max_error, 1e-4);
+
+        std::vector<std::complex<float>> buffer;
+        plan.inverse(out.data(), buffer);
+        double max_roundtrip_error = 0.0;
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            max_roundtrip_error = std::max(max_roundtrip_error,
+                static_cast<double>(std::abs(out[j] / static_cast<float>(n) - in[j])));
+        }
+        BOOST_TEST_LT(max_roundtrip_error, 1e-5);
+    }
+}
+
+void test_fft_real_2d_roundtrip()
+{
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+    std::size_t const rows = 12;
+    std::size_t const cols = 15;
+    gil::detail::fft_real_2d const fft(rows, cols);
+    std::vector<float> data(rows * cols), result(rows * cols);
+    for (auto& v : data)
+        v = dist(rng);
+
+    std::vector<std::complex<float>> spectrum(fft.spectrum_size());
+    fft.forward(data.data(), spectrum.data());
+
+    // DC term is sum of all samples
+    double sum = 0.0;
+    for (auto v : data)
+        sum += v;
+    BOOST_TEST_LT(std::abs(spectrum[0] - std::complex<float>(static_cast<float>(sum))), 1e-4f);
+
+    fft.inverse(spectrum.data(), result.data());
+    bool all_match = true;
+    for (std::size_t i = 0; i < data.size(); ++i)
+    {
+        float const restored = result[i] / static_cast<float>(rows * cols);
+        all_match = all_match && std::abs(restored - data[i]) < 1e-5f;
+    }
+    BOOST_TEST(all_match);
+}
+
+// Straightforward per-pixel definition of convolve_2d used as reference
+template <typename SrcView, typename Kernel>
+float reference_convolve_at(
+    SrcView const& src, Kernel const& kernel, std::ptrdiff_t x, std::ptrdiff_t y,
+    gil::boundary_option option)
+{
+    auto const k = static_cast<std::ptrdiff_t>(kernel.size());
+    auto const cx = static_cast<std::ptrdiff_t>(kernel.center_x());
+    auto const cy = static_cast<std::ptrdiff_t>(kernel.center_y());
+    float sum = 0.0f;
+    for (std::ptrdiff_t i = 0; i < k; ++i)
+    {
+        for (std::ptrdiff_t j = 0; j < k; ++j)
+        {
+            std::ptrdiff_t sx = x + cx - j;
+            std::ptrdiff_t sy = y + cy - i;
+            bool const inside = sx >= 0 && sx < src.width() && sy >= 0 && sy < src.height();
+            if (!inside && option == gil::boundary_option::extend_zero)
+                continue;
+            if (option == gil::boundary_option::extend_constant)
+            {
+                sx = std::min(std::max<std::ptrdiff_t>(sx, 0), src.width() - 1);
+                sy = std::min(std::max<std::ptrdiff_t>(sy, 0), src.height() - 1);
+            }
+            // locator reads past the view bounds for extend_padded
+            auto const loc = src.xy_at(0, 0);
+            sum += static_cast<float>(gil::at_c<0>(loc(sx, sy))) * kernel.begin()[j * k + i];
+        }
+    }
+    return sum;
+}
+
+// Random non-separable kernel with off-center anchor
+gil::detail::kernel_2d<float> make_random_kernel(std::size_t size)
+{
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> dist(-0.5f, 1.0f);
+    std::vector<float> v(size * size);
+    float sum = 0.0f;
+    for (auto& w : v)
+    {
+        w = dist(rng);
+        sum += w;
+    }
+    for (auto& w : v)
+        w /= sum;
+    return gil::detail::kernel_2d<float>(v.begin(), v.size(), size / 3, size / 2);
+}
+
+void test_fft_convolve_2d_matches_reference()
+{
+    std::ptrdiff_t const width = 161;
+    std::ptrdiff_t const height = 97;
+    std::ptrdiff_t const pad = 16;
+
+    // Source is a subimage of a larger image, so that extend_padded reads real pixels
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> dist(0, 255);
+    gil::gray8_image_t padded(width + 2 * pad, height + 2 * pad);
+    for (auto& p : gil::view(padded))
+        p = gil::gray8_pixel_t(static_cast<std::uint8_t>(dist(rng)));
+    auto const src = gil::subimage_view(gil::const_view(padded), pad, pad, width, height);
+
+    auto const kernel = make_random_kernel(17);
+    auto const k = static_cast<std::ptrdiff_t>(kernel.size());
+    auto const left = k - 1 - static_cast<std::ptrdiff_t>(kernel.center_x());
+    auto const top = k - 1 - static_cast<std::ptrdiff_t>(kernel.center_y());
+
+    for (auto option : {
+        gil::boundary_option::output_ignore,
+        gil::boundary_option::output_zero,
+        gil::boundary_option::extend_padded,
+        gil::boundary_option::extend_zero,
+        gil::boundary_option::extend_constant})
+    {
+        gil::gray32f_image_t dst(width, height, gil::gray32f_pixel_t(-1.0f));
+        gil::detail::fft_convolve_2d(src, kernel, gil::view(dst), option);
+
+        bool all_match = true;
+        for (std::ptrdiff_t y = 0; y < height; ++y)
+        {
+            for (std::ptrdiff_t x = 0; x < width; ++x)
+            {
+                bool const interior = x >= left && x < width - (k - 1 - left) &&
+                                      y >= top && y < height - (k - 1 - top);
+                float expected = reference_convolve_at(src, kernel, x, y, option);
+                if (!interior && option == gil::boundary_option::output_ignore)
+                    expected = -1.0f;
+                else if (!interior && option == gil::boundary_option::output_zero)
+                    expected = 0.0f;
+
+                float const actual = gil::at_c<0>(gil::view(dst)(x, y));
+                all_match = all_match && std::abs(actual - expected) <= 1e-2f;
+            }
+        }
+        BOOST_TEST(all_match);
+    }
+}
+
+void test_convolve_2d_selects_fft_for_large_kernels()
+{
+    std::size_t const taps_3x3 = 9;
+    std::size_t const taps_31x31 = 31 * 31;
+    BOOST_TEST(!gil::detail::make_fft_convolution_plan(3, taps_3x3, 512, 512).use_fft());
+    BOOST_TEST(gil::detail::make_fft_convolution_plan(31, taps_31x31, 512, 512).use_fft());
+    // Separable kernel is cheaper to apply directly as two passes
+    BOOST_TEST(!gil::detail::make_fft_convolution_plan(31, 2 * 31, 512, 512).use_fft());
+
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> dist(0, 255);
+    gil::rgb8_image_t src(200, 150);
+    for (auto& p : gil::view(src))
+    {
+        p = gil::rgb8_pixel_t(
+            static_cast<std::uint8_t>(dist(rng)),
+            static_cast<std::uint8_t>(dist(rng)),
+            static_cast<std::uint8_t>(dist(rng)));
+    }
+
+    auto const kernel = make_random_kernel(31);
+    gil::rgb32f_image_t expected(src.dimensions());
+    gil::rgb32f_image_t actual(src.dimensions());
+    gil::detail::fft_convolve_2d(gil::const_view(src), kernel, gil::view(expected));
+    gil::detail::convolve_2d(gil::const_view(src), kernel, gil::view(actual));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(actual)));
+
+    // Spot check of the result against definition
+    auto const red = gil::nth_channel_view(gil::const_view(src), 0);
+    float const reference =
+        reference_convolve_at(red, kernel, 100, 75, gil::boundary_option::extend_zero);
+    BOOST_TEST_LT(std::abs(gil::at_c<0>(gil::view(actual)(100, 75)) - reference), 1e-2f);
+}
+
+int main()
+{
+    test_fft_good_size();
+    test_fft_plan_matches_dft();
+    test_fft_real_2d_roundtrip();
+    test_fft_convolve_2d_matches_reference();
+    test_convolve_2d_selects_fft_for_large_kernels();
+
+    return ::boost::report_errors();
+}
@@ -0,0 +1,180 @@
+//
+// Copyright 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil.hpp>
+#include <boost/gil/extension/numeric/affine.hpp>
+#include <boost/gil/extension/numeric/resample.hpp>
+#include <boost/gil/extension/numeric/sampler.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+
+namespace gil = boost::gil;
+
+namespace {
+
+// Maps rectangle 80x60 to a trapezoid inside 61x47 source, like rectification of a document
+gil::matrix3x3<double> const perspective(
+    0.55, 0.02, 0.0004,
+    -0.1, 0.7, 0.0015,
+    4.0, 3.0, 1.0);
+
+bool is_close(gil::point<double> const& lhs, gil::point<double> const& rhs)
+{
+    return std::abs(lhs.x - rhs.x) < 1e-9 && std::abs(lhs.y - rhs.y) < 1e-9;
+}
+
+template <typename View>
+int max_channel_difference(View const& a, View const& b)
+{
+    int max_difference = 0;
+    for (std::ptrdiff_t y = 0; y < a.height(); ++y)
+        for (std::ptrdiff_t x = 0; x < a.width(); ++x)
+            for (std::size_t c = 0; c < gil::num_channels<View>::value; ++c)
+                max_difference = (std::max)(max_difference, std::abs(
+                    int(a(x, y)[c]) - int(b(x, y)[c])));
+    return max_difference;
+}
+
+template <typename Image>
+void fill_random(Image& image)
+{
+    using channel_t = typename gil::channel_type<Image>::type;
+    std::mt19937 rng(11);
+    auto v = gil::view(image);
+    for (auto& p : v)
+        for (std::size_t c = 0; c < gil::num_channels<Image>::value; ++c)
+            p[c] = static_cast<channel_t>(rng() % 256);
+}
+
+} // namespace
+
+void test_matrix3x3_default_constructor()
+{
+    gil::matrix3x3<int> m1;
+    BOOST_TEST_EQ(m1.a, 1);
+    BOOST_TEST_EQ(m1.b, 0);
+    BOOST_TEST_EQ(m1.u, 0);
+    BOOST_TEST_EQ(m1.c, 0);
+    BOOST_TEST_EQ(m1.d, 1);
+    BOOST_TEST_EQ(m1.v, 0);
+    BOOST_TEST_EQ(m1.e, 0);
+    BOOST_TEST_EQ(m1.f, 0);
+    BOOST_TEST_EQ(m1.w, 1);
+}
+
+void test_matrix3x3_from_matrix3x2()
+{
+    gil::matrix3x2<double> const affine(1, 2, 3, 4, 5, 6);
+    gil::matrix3x3<double> const m1(affine);
+    gil::point<double> const p(3, -2);
+    BOOST_TEST(is_close(gil::transform(m1, p), gil::transform(affine, p)));
+}
+
+void test_matrix3x3_multiplication()
+{
+    gil::matrix3x3<double> const m1 =
+        gil::matrix3x3<double>(gil::matrix3x2<double>::get_rotate(0.3)) * perspective;
+    gil::point<double> const p(12, 7);
+    BOOST_TEST(is_close(gil::transform(m1, p),
+        gil::transform(perspective, gil::transform(gil::matrix3x2<double>::get_rotate(0.3), p))));
+}
+
+void test_matrix3x3_inverse()
+{
+    gil::matrix3x3<double> const m1 = gil::inverse(perspective);
+    gil::point<double> const p(12, 7);
+    BOOST_TEST(is_close(gil::transform(m1, gil::transform(perspective, p)), p));
+
+    gil::matrix3x3<double> const identity = m1 * perspective;
+    BOOST_TEST(is_close(gil::transform(identity, p), p));
+}
+
+void test_resample_identity()
+{
+    gil::rgb8_image_t src(37, 29);
+    fill_random(src);
+    gil::rgb8_image_t dst(37, 29);
+    gil::resample_pixels(gil::const_view(src), gil::view(dst), gil::matrix3x3<double>(),
+        gil::nearest_neighbor_sampler());
+    BOOST_TEST(gil::equal_pixels(gil::const_view(src), gil::const_view(dst)));
+}
+
+template <typename Image, typename Sampler>
+void test_resample_perspective(int tolerance)
+{
+    Image src(61, 47);
+    fill_random(src);
+
+    // Large enough to be split into bands of rows resampled in parallel
+    auto const mapping =
+        gil::matrix3x3<double>(gil::matrix3x2<double>::get_scale(0.5)) * perspective;
+    Image generic(160, 120), sequential(160, 120), parallel(160, 120);
+    gil::fill_pixels(gil::view(generic), typename Image::value_type(7));
+    gil::fill_pixels(gil::view(sequential), typename Image::value_type(7));
+    gil::fill_pixels(gil::view(parallel), typename Image::value_type(7));
+    gil::detail::resample_pixels_generic(
+        gil::const_view(src), gil::view(generic), mapping, Sampler());
+    gil::resample_pixels(gil::const_view(src), gil::view(sequential), mapping, Sampler());
+    gil::resample_pixels(gil::execution::par(3),
+        gil::const_view(src), gil::view(parallel), mapping, Sampler());
+
+    BOOST_TEST_LE(
+        max_channel_difference(gil::const_view(sequential), gil::const_view(generic)), tolerance);
+    BOOST_TEST_EQ(
+        max_channel_difference(gil::const_view(sequential), gil::const_view(parallel)), 0);
+}
+
+void test_resample_perspective()
+{
+    // Fixed-point path for 8-bit views
+    test_resample_perspective<gil::rgb8_image_t, gil::nearest_neighbor_sampler>(0);
+    test_resample_perspective<gil::rgb8_planar_image_t, gil::nearest_neighbor_sampler>(0);
+    test_resample_perspective<gil::gray8_image_t, gil::nearest_neighbor_sampler>(0);
+    test_resample_perspective<gil::rgb8_image_t, gil::bilinear_sampler>(1);
+    test_resample_perspective<gil::rgb8_planar_image_t, gil::bilinear_sampler>(1);
+    test_resample_perspective<gil::gray8_image_t, gil::bilinear_sampler>(1);
+    // Generic sampling of other views
+    test_resample_perspective<gil::rgb16_image_t, gil::nearest_neighbor_sampler>(0);
+    test_resample_perspective<gil::rgb16_image_t, gil::bilinear_sampler>(1);
+}
+
+void test_resample_horizon()
+{
+    // Destination rows below the horizon map to points at infinity, left unchanged
+    gil::matrix3x3<double> const horizon(1, 0, 0, 0, 1, -0.1, 0, 0, 1);
+    gil::gray8_image_t src(16, 16);
+    fill_random(src);
+    gil::gray8_image_t dst(16, 16);
+    gil::fill_pixels(gil::view(dst), gil::gray8_pixel_t(7));
+    gil::resample_pixels(gil::execution::par,
+        gil::const_view(src), gil::view(dst), horizon, gil::bilinear_sampler());
+    auto const dst_view = gil::const_view(dst);
+    for (std::ptrdiff_t x = 0; x < 16; ++x)
+    {
+        BOOST_TEST_EQ(dst_view(x, 0), gil::const_view(src)(x, 0));
+        BOOST_TEST_EQ(dst_view(x, 10), gil::gray8_pixel_t(7));
+        BOOST_TEST_EQ(dst_view(x, 15), gil::gray8_pixel_t(7));
+    }
+}
+
+int main()
+{
+    test_matrix3x3_default_constructor();
+    test_matrix3x3_from_matrix3x2();
+    test_matrix3x3_multiplication();
+    test_matrix3x3_inverse();
+    test_resample_identity();
+    test_resample_perspective();
+    test_resample_horizon();
+
+    return ::boost::report_errors();
+}
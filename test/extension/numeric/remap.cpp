@@ -0,0 +1,186 @@
+//
+// Copyright 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil.hpp>
+#include <boost/gil/extension/numeric/resample.hpp>
+#include <boost/gil/extension/numeric/sampler.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+
+namespace gil = boost::gil;
+
+// Radial lens distortion around center of 160x120 destination
+struct barrel_distortion
+{
+    gil::point<double> operator()(gil::point_t const& p) const
+    {
+        double const x = (static_cast<double>(p.x) - 80.0) / 80.0;
+        double const y = (static_cast<double>(p.y) - 60.0) / 80.0;
+        double const scale = 1.0 + 0.25 * (x * x + y * y);
+        return {30.0 + 36.0 * x * scale, 23.0 + 36.0 * y * scale};
+    }
+};
+
+// Source points baked into table, for resampling at the same coordinates as remap does
+struct table_points
+{
+    gil::remap_table const* table;
+};
+
+namespace boost { namespace gil {
+
+template <typename T>
+struct mapping_traits;
+
+template <>
+struct mapping_traits<barrel_distortion>
+{
+    using result_type = point<double>;
+};
+
+template <>
+struct mapping_traits<table_points>
+{
+    using result_type = point<double>;
+};
+
+inline point<double> transform(barrel_distortion const& mf, point_t const& src)
+{
+    return mf(src);
+}
+
+inline point<double> transform(table_points const& mf, point_t const& src)
+{
+    return remap_table::source_point((*mf.table)(src.x, src.y));
+}
+
+}} // namespace boost::gil
+
+template <typename Image>
+void fill_random(Image& image)
+{
+    using channel_t = typename gil::channel_type<Image>::type;
+    std::mt19937 rng(3);
+    auto v = gil::view(image);
+    for (auto& p : v)
+        for (std::size_t c = 0; c < gil::num_channels<Image>::value; ++c)
+            p[c] = static_cast<channel_t>(rng() % 256);
+}
+
+void test_table_entries()
+{
+    auto const mapping = gil::matrix3x2<double>::get_scale(0.5) *
+        gil::matrix3x2<double>::get_translate(-1.25, 0.75);
+    gil::remap_table const table(gil::point_t(4, 3), mapping);
+    BOOST_TEST_EQ(table.width(), 4);
+    BOOST_TEST_EQ(table.height(), 3);
+
+    // Pixel (3, 2) is mapped to (0.25, 1.75)
+    BOOST_TEST_EQ(table(3, 2).x, 0);
+    BOOST_TEST_EQ(table(3, 2).y, 1);
+    BOOST_TEST_EQ(table(3, 2).fraction_x, 64);
+    BOOST_TEST_EQ(table(3, 2).fraction_y, 192);
+    // Pixel (0, 0) is mapped to (-1.25, 0.75)
+    BOOST_TEST_EQ(table(0, 0).x, -2);
+    BOOST_TEST_EQ(table(0, 0).fraction_x, 192);
+    BOOST_TEST_EQ(gil::remap_table::source_point(table(0, 0)).x, -1.25);
+}
+
+void test_table_outside()
+{
+    auto const far_away = gil::matrix3x2<double>::get_translate(1e6, 0);
+    gil::remap_table const far_table(gil::point_t(2, 2), far_away);
+    BOOST_TEST_EQ(far_table(1, 1).x, std::int16_t(gil::remap_table::outside));
+
+    gil::matrix3x3<double> const horizon(1, 0, 0, 0, 1, -1, 0, 0, 1);
+    gil::remap_table const horizon_table(gil::point_t(2, 2), horizon);
+    BOOST_TEST_EQ(horizon_table(0, 0).x, 0);
+    BOOST_TEST_EQ(horizon_table(0, 1).x, std::int16_t(gil::remap_table::outside));
+
+    // Pixels mapped outside are left unchanged
+    gil::gray8_image_t src(4, 4);
+    fill_random(src);
+    gil::gray8_image_t dst(2, 2);
+    gil::fill_pixels(gil::view(dst), gil::gray8_pixel_t(7));
+    gil::remap(gil::const_view(src), gil::view(dst), far_table, gil::bilinear_sampler());
+    BOOST_TEST_EQ(gil::const_view(dst)(1, 1), gil::gray8_pixel_t(7));
+}
+
+template <typename Image, typename Sampler>
+void test_remap_equals_sampler()
+{
+    Image src(61, 47);
+    fill_random(src);
+    gil::remap_table const table(gil::point_t(160, 120), barrel_distortion());
+
+    // Larger than a single band of rows, so parallel remap really splits the work
+    Image expected(160, 120), sequential(160, 120), parallel(160, 120);
+    gil::fill_pixels(gil::view(expected), typename Image::value_type(7));
+    gil::fill_pixels(gil::view(sequential), typename Image::value_type(7));
+    gil::fill_pixels(gil::view(parallel), typename Image::value_type(7));
+    gil::resample_pixels(
+        gil::const_view(src), gil::view(expected), table_points{&table}, Sampler());
+    gil::remap(gil::const_view(src), gil::view(sequential), table, Sampler());
+    gil::remap(gil::execution::par(2),
+        gil::const_view(src), gil::view(parallel), table, Sampler());
+
+    BOOST_TEST(gil::equal_pixels(gil::const_view(sequential), gil::const_view(expected)));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(parallel), gil::const_view(expected)));
+}
+
+void test_remap_equals_sampler()
+{
+    // Fixed-point path for 8-bit views
+    test_remap_equals_sampler<gil::rgb8_image_t, gil::nearest_neighbor_sampler>();
+    test_remap_equals_sampler<gil::rgb8_image_t, gil::bilinear_sampler>();
+    test_remap_equals_sampler<gil::gray8_image_t, gil::nearest_neighbor_sampler>();
+    test_remap_equals_sampler<gil::gray8_image_t, gil::bilinear_sampler>();
+    // Generic sampling of other views
+    test_remap_equals_sampler<gil::rgb16_image_t, gil::bilinear_sampler>();
+}
+
+void test_remap_planar()
+{
+    gil::rgb8_planar_image_t src(61, 47);
+    fill_random(src);
+    gil::rgb8_image_t interleaved_src(61, 47);
+    gil::copy_pixels(gil::const_view(src), gil::view(interleaved_src));
+    gil::remap_table const table(gil::point_t(160, 120), barrel_distortion());
+
+    gil::rgb8_planar_image_t dst(160, 120);
+    gil::rgb8_image_t expected(160, 120), interleaved_dst(160, 120);
+    gil::remap(gil::const_view(src), gil::view(dst), table, gil::bilinear_sampler());
+    gil::remap(gil::const_view(interleaved_src), gil::view(expected), table,
+        gil::bilinear_sampler());
+    gil::copy_pixels(gil::const_view(dst), gil::view(interleaved_dst));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(interleaved_dst), gil::const_view(expected)));
+}
+
+void test_remap_dimensions_mismatch()
+{
+    gil::gray8_image_t src(4, 4), dst(3, 3);
+    gil::remap_table const table(gil::point_t(4, 4), gil::matrix3x2<double>());
+    BOOST_TEST_THROWS(
+        gil::remap(gil::const_view(src), gil::view(dst), table, gil::bilinear_sampler()),
+        std::invalid_argument);
+}
+
+int main()
+{
+    test_table_entries();
+    test_table_outside();
+    test_remap_equals_sampler();
+    test_remap_planar();
+    test_remap_dimensions_mismatch();
+
+    return ::boost::report_errors();
+}
@@ -12,7 +12,10 @@
 
 #include <boost/core/lightweight_test.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <cstdlib>
+#include <random>
 
 #include "test_utility_output_stream.hpp"
 
@@ -95,9 +98,118 @@ void test_bilinear_sampler_test()
     BOOST_TEST_EQ(gil::rgb8_pixel_t(0, 128, 0), dv(3, 3));
 }
 
+template <typename View>
+int max_channel_difference(View const& a, View const& b)
+{
+    int max_difference = 0;
+    for (std::ptrdiff_t y = 0; y < a.height(); ++y)
+        for (std::ptrdiff_t x = 0; x < a.width(); ++x)
+            for (std::size_t c = 0; c < gil::num_channels<View>::value; ++c)
+                max_difference = (std::max)(max_difference, std::abs(
+                    int(a(x, y)[c]) - int(b(x, y)[c])));
+    return max_difference;
+}
+
+template <typename Image, typename Sampler>
+int resample_fast_path_max_difference(gil::matrix3x2<double> const& m, Sampler sampler,
+    gil::point_t const& src_size = {61, 47}, gil::point_t const& dst_size = {80, 60})
+{
+    using channel_t = typename gil::channel_type<Image>::type;
+    std::mt19937 rng(7);
+    Image src(src_size);
+    auto src_view = gil::view(src);
+    for (auto& p : src_view)
+        for (std::size_t c = 0; c < gil::num_channels<Image>::value; ++c)
+            p[c] = static_cast<channel_t>(rng() % 256);
+
+    Image fast(dst_size), generic(dst_size);
+    gil::fill_pixels(gil::view(fast), typename Image::value_type(7));
+    gil::fill_pixels(gil::view(generic), typename Image::value_type(7));
+    gil::resample_pixels(gil::const_view(src), gil::view(fast), m, sampler);
+    gil::detail::resample_pixels_generic(gil::const_view(src), gil::view(generic), m, sampler);
+
+    return max_channel_difference(gil::const_view(fast), gil::const_view(generic));
+}
+
+template <typename Image>
+void test_affine_fast_path(gil::matrix3x2<double> const& m, int bilinear_tolerance)
+{
+    BOOST_TEST_EQ(resample_fast_path_max_difference<Image>(m, gil::nearest_neighbor_sampler()), 0);
+    BOOST_TEST_LE(
+        resample_fast_path_max_difference<Image>(m, gil::bilinear_sampler()), bilinear_tolerance);
+}
+
+void test_affine_fast_path()
+{
+    using matrix_t = gil::matrix3x2<double>;
+    matrix_t const scale = matrix_t::get_scale(0.5, 0.25);
+    matrix_t const translate = matrix_t::get_translate(-3.5, 2.5);
+    matrix_t const rotate = matrix_t::get_translate(-40, -30) * matrix_t::get_rotate(0.3) *
+        matrix_t::get_scale(0.7) * matrix_t::get_translate(30, 23);
+
+    // Axis-aligned mappings with dyadic steps match the samplers exactly
+    for (matrix_t const& m : {matrix_t(), scale, translate})
+    {
+        test_affine_fast_path<gil::rgb8_image_t>(m, 0);
+        test_affine_fast_path<gil::rgb8_planar_image_t>(m, 0);
+        test_affine_fast_path<gil::gray8_image_t>(m, 0);
+    }
+    // Fixed-point weights may differ from the floating-point samplers by one step
+    test_affine_fast_path<gil::rgb8_image_t>(rotate, 1);
+    test_affine_fast_path<gil::rgb8_planar_image_t>(rotate, 1);
+    test_affine_fast_path<gil::gray8_image_t>(rotate, 1);
+}
+
+template <typename Image>
+void test_affine_fast_path_wide(gil::matrix3x2<double> const& m)
+{
+    // Rounding of fixed-point steps must not accumulate along long rows
+    gil::point_t const size(4000, 64);
+    BOOST_TEST_EQ(resample_fast_path_max_difference<Image>(
+        m, gil::nearest_neighbor_sampler(), size, size), 0);
+    BOOST_TEST_LE(resample_fast_path_max_difference<Image>(
+        m, gil::bilinear_sampler(), size, size), 1);
+}
+
+void test_affine_fast_path_wide()
+{
+    using matrix_t = gil::matrix3x2<double>;
+    matrix_t const rotate = matrix_t::get_rotate(0.001) * matrix_t::get_scale(0.9);
+    matrix_t const scale = matrix_t::get_scale(0.7071, 0.3);
+    test_affine_fast_path_wide<gil::gray8_image_t>(rotate);
+    test_affine_fast_path_wide<gil::gray8_image_t>(scale);
+    test_affine_fast_path_wide<gil::rgb8_image_t>(rotate);
+    test_affine_fast_path_wide<gil::rgb8_planar_image_t>(scale);
+}
+
+void test_resize_view_fast_path()
+{
+    gil::rgb8_image_t src(31, 17);
+    auto src_view = gil::view(src);
+    for (std::ptrdiff_t y = 0; y < src_view.height(); ++y)
+        for (std::ptrdiff_t x = 0; x < src_view.width(); ++x)
+            src_view(x, y) = gil::rgb8_pixel_t(
+                static_cast<std::uint8_t>(x * 8), static_cast<std::uint8_t>(y * 15),
+                static_cast<std::uint8_t>((x * y) % 256));
+
+    // Same mapping as resample_subimage builds for an unrotated resize
+    gil::rgb8_image_t fast(70, 40), generic(70, 40);
+    auto const mapping = gil::matrix3x2<double>::get_translate(-34.5, -19.5) *
+        gil::matrix3x2<double>::get_scale(30.0 / 69.0, 16.0 / 39.0) *
+        gil::matrix3x2<double>::get_rotate(-0.0) *
+        gil::matrix3x2<double>::get_translate(15.0, 8.0);
+    gil::resize_view(gil::const_view(src), gil::view(fast), gil::bilinear_sampler());
+    gil::detail::resample_pixels_generic(
+        gil::const_view(src), gil::view(generic), mapping, gil::bilinear_sampler());
+    BOOST_TEST_LE(max_channel_difference(gil::const_view(fast), gil::const_view(generic)), 1);
+}
+
 int main()
 {
     test_bilinear_sampler_test();
+    test_affine_fast_path();
+    test_affine_fast_path_wide();
+    test_resize_view_fast_path();
 
     return ::boost::report_errors();
 }